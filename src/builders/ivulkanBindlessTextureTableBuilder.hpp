@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanBindlessTextureTable.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan bindless texture table builder interface
+     */
+    class IVulkanBindlessTextureTableBuilder
+    {
+    public:
+        /**
+         * @brief Specify the device the table is created on. The device must have descriptor indexing enabled
+         * 
+         * @param device The device the table is created on
+         * @returns Reference to the builder
+         */
+        virtual IVulkanBindlessTextureTableBuilder& withDevice(IVulkanDevice const * device) noexcept = 0;
+
+        /**
+         * @brief Specify the maximum number of textures in the table
+         * 
+         * @param capacity The table capacity
+         * @returns Reference to the builder
+         */
+        virtual IVulkanBindlessTextureTableBuilder& withCapacity(uint32_t capacity) noexcept = 0;
+
+        /**
+         * @brief Specify the number of frames in flight. Removed indices are reused once the frame they were removed in is next begun
+         * 
+         * @param frameCount The number of frames in flight
+         * @returns Reference to the builder
+         */
+        virtual IVulkanBindlessTextureTableBuilder& withFrameCount(uint32_t frameCount) noexcept = 0;
+
+        /**
+         * @brief Build the Vulkan bindless texture table
+         * 
+         * @returns The final Vulkan bindless texture table
+         */
+        virtual std::unique_ptr<IVulkanBindlessTextureTable> build() const = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanBindlessTextureTableBuilder() = default;
+    };
+}
@@ -44,6 +44,13 @@ namespace siofraEngine::systems
          */
         virtual IVulkanBufferBuilder& withMemoryPropertyFlags(VkMemoryPropertyFlags memoryPropertyFlags) noexcept = 0;
 
+        /**
+         * @brief Persistently map the buffer memory when it is built, rather than on every update. The memory must be host visible
+         * 
+         * @returns Reference to the builder
+         */
+        virtual IVulkanBufferBuilder& withPersistentMapping() noexcept = 0;
+
         /**
          * @brief Build the Vulkan buffer
          * 
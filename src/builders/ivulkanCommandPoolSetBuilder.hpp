@@ -0,0 +1,67 @@
+#pragma once
+
+#include <memory>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanCommandPoolSet.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan command pool set builder interface
+     */
+    class IVulkanCommandPoolSetBuilder
+    {
+    public:
+        /**
+         * @brief Specify the device used to create the command pools
+         * 
+         * @param device The device with which to create the command pools
+         * @returns Reference to the builder
+         */
+        virtual IVulkanCommandPoolSetBuilder& withDevice(IVulkanDevice const * device) noexcept = 0;
+
+        /**
+         * @brief Specify the command pool create flags
+         * 
+         * @param flags The command pool create flags
+         * @returns Reference to the builder
+         */
+        virtual IVulkanCommandPoolSetBuilder& withFlags(VkCommandPoolCreateFlags flags) noexcept = 0;
+
+        /**
+         * @brief Specify the queue family the command pools allocate command buffers for
+         * 
+         * @param queueFamilyIndex The command pool queue family index
+         * @returns Reference to the builder
+         */
+        virtual IVulkanCommandPoolSetBuilder& withQueueFamilyIndex(uint32_t queueFamilyIndex) noexcept = 0;
+
+        /**
+         * @brief Specify the number of frames in flight
+         * 
+         * @param frameCount The number of frames in flight
+         * @returns Reference to the builder
+         */
+        virtual IVulkanCommandPoolSetBuilder& withFrameCount(uint32_t frameCount) noexcept = 0;
+
+        /**
+         * @brief Specify the number of recording threads
+         * 
+         * @param threadCount The number of recording threads
+         * @returns Reference to the builder
+         */
+        virtual IVulkanCommandPoolSetBuilder& withThreadCount(uint32_t threadCount) noexcept = 0;
+
+        /**
+         * @brief Build the Vulkan command pool set
+         * 
+         * @returns The final Vulkan command pool set
+         */
+        virtual std::unique_ptr<IVulkanCommandPoolSet> build() const = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanCommandPoolSetBuilder() = default;
+    };
+}
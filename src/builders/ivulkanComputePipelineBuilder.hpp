@@ -0,0 +1,108 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanPipeline.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanShaderModule.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDescriptorSetLayout.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanPipelineCache.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanPipelineLayoutCache.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/vulkanSpecializationConstants.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan compute pipeline builder interface
+     */
+    class IVulkanComputePipelineBuilder
+    {
+    public:
+        /**
+         * @brief Specify the device used to create the pipeline
+         * 
+         * @param device The device with which to create the pipeline
+         * @returns Reference to the builder
+         */
+        virtual IVulkanComputePipelineBuilder& withDevice(IVulkanDevice const * device) noexcept = 0;
+
+        /**
+         * @brief Specify the pipeline cache used to accelerate pipeline creation
+         * 
+         * @param pipelineCache The pipeline cache, or nullptr to create the pipeline without one
+         * @returns Reference to the builder
+         */
+        virtual IVulkanComputePipelineBuilder& withPipelineCache(IVulkanPipelineCache const * pipelineCache) noexcept = 0;
+
+        /**
+         * @brief Specify the pipeline layout cache used to share pipeline layouts between pipelines. Without a cache the pipeline owns its layout
+         * 
+         * @param pipelineLayoutCache The pipeline layout cache used to share pipeline layouts
+         * @returns Reference to the builder
+         */
+        virtual IVulkanComputePipelineBuilder& withPipelineLayoutCache(IVulkanPipelineLayoutCache * pipelineLayoutCache) noexcept = 0;
+
+        /**
+         * @brief Specify the descriptor set layouts to include in the pipeline layout
+         * 
+         * @param descriptorSetLayouts The descriptor set layouts
+         * @returns Reference to the builder
+         */
+        virtual IVulkanComputePipelineBuilder& withDescriptorSetLayouts(std::vector<IVulkanDescriptorSetLayout const *> descriptorSetLayouts) noexcept = 0;
+
+        /**
+         * @brief Specify a push constant range
+         * 
+         * @param offset The start offset. Must be multiple of 4
+         * @param size The push constant size. Must be multiple of 4
+         * @returns Reference to the builder
+         */
+        virtual IVulkanComputePipelineBuilder& withPushConstantRange(uint32_t offset, uint32_t size) noexcept = 0;
+
+        /**
+         * @brief Specify the pipeline shader module for the compute stage
+         * 
+         * @param shaderModule The pipeline shader module
+         * @returns Reference to the builder
+         */
+        virtual IVulkanComputePipelineBuilder& withComputeStage(std::unique_ptr<IVulkanShaderModule> shaderModule) noexcept = 0;
+
+        /**
+         * @brief Specify the pipeline shader module for the compute stage with a custom entry point and specialization constants
+         * 
+         * @param shaderModule The pipeline shader module
+         * @param entryPoint Name of the shader entry point
+         * @param specializationConstants Values of the shader specialization constants
+         * @returns Reference to the builder
+         */
+        virtual IVulkanComputePipelineBuilder& withComputeStage(std::unique_ptr<IVulkanShaderModule> shaderModule, std::string entryPoint, VulkanSpecializationConstants specializationConstants) noexcept = 0;
+
+        /**
+         * @brief Specify the specialization constants of the compute stage
+         * 
+         * @param specializationConstants The specialization constants
+         * @returns Reference to the builder
+         */
+        virtual IVulkanComputePipelineBuilder& withSpecializationConstants(VulkanSpecializationConstants specializationConstants) noexcept = 0;
+
+        /**
+         * @brief Get a key identifying the pipeline state the builder would create. Shader modules and other objects are identified by their contents rather than their handles. Builders with equal keys create interchangeable pipelines
+         * 
+         * @returns The pipeline state key
+         */
+        virtual std::string getStateKey() const = 0;
+
+        /**
+         * @brief Build the Vulkan compute pipeline
+         * 
+         * @returns The final Vulkan compute pipeline
+         */
+        virtual std::unique_ptr<IVulkanPipeline> build() const = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanComputePipelineBuilder() = default;
+    };
+}
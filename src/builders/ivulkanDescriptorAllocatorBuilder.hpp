@@ -0,0 +1,68 @@
+#pragma once
+
+#include <memory>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDescriptorAllocator.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan descriptor allocator builder interface
+     */
+    class IVulkanDescriptorAllocatorBuilder
+    {
+    public:
+        /**
+         * @brief Specify the device the descriptor sets are allocated on
+         * 
+         * @param device The device the descriptor sets are allocated on
+         * @returns Reference to the builder
+         */
+        virtual IVulkanDescriptorAllocatorBuilder& withDevice(IVulkanDevice const * device) noexcept = 0;
+
+        /**
+         * @brief Specify the number of frames in flight. Each frame allocates from its own pools
+         * 
+         * @param frameCount The number of frames in flight
+         * @returns Reference to the builder
+         */
+        virtual IVulkanDescriptorAllocatorBuilder& withFrameCount(uint32_t frameCount) noexcept = 0;
+
+        /**
+         * @brief Specify the number of descriptors of a type required by a typical set of the layout class. Pool sizes are scaled from these counts
+         * 
+         * @param type The descriptor type
+         * @param descriptorsPerSet The number of descriptors of the type per set
+         * @returns Reference to the builder
+         */
+        virtual IVulkanDescriptorAllocatorBuilder& withPoolSize(VkDescriptorType type, uint32_t descriptorsPerSet) noexcept = 0;
+
+        /**
+         * @brief Specify the number of sets in the first pool of each frame. Each further pool doubles in size
+         * 
+         * @param setsPerPool The number of sets in the first pool
+         * @returns Reference to the builder
+         */
+        virtual IVulkanDescriptorAllocatorBuilder& withSetsPerPool(uint32_t setsPerPool) noexcept = 0;
+
+        /**
+         * @brief Specify the descriptor pool creation flags
+         * 
+         * @param flags The descriptor pool creation flags
+         * @returns Reference to the builder
+         */
+        virtual IVulkanDescriptorAllocatorBuilder& withFlags(VkDescriptorPoolCreateFlags flags) noexcept = 0;
+
+        /**
+         * @brief Build the Vulkan descriptor allocator
+         * 
+         * @returns The final Vulkan descriptor allocator
+         */
+        virtual std::unique_ptr<IVulkanDescriptorAllocator> build() const = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanDescriptorAllocatorBuilder() = default;
+    };
+}
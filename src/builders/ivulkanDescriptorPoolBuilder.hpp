@@ -37,6 +37,14 @@ namespace siofraEngine::systems
          */
         virtual IVulkanDescriptorPoolBuilder& withMaxSets(uint32_t maxSets) noexcept = 0;
 
+        /**
+         * @brief Specify the descriptor pool creation flags
+         * 
+         * @param flags The descriptor pool creation flags
+         * @returns Reference to the builder
+         */
+        virtual IVulkanDescriptorPoolBuilder& withFlags(VkDescriptorPoolCreateFlags flags) noexcept = 0;
+
         /**
          * @brief Build the Vulkan descriptor pool
          * 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanDescriptorSet.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanDescriptorPool.hpp"
@@ -38,6 +39,22 @@ namespace siofraEngine::systems
          */
         virtual IVulkanDescriptorSetBuilder& withDescriptorSetLayout(IVulkanDescriptorSetLayout const * descriptorSetLayout) noexcept = 0;
 
+        /**
+         * @brief Specify the number of descriptors in the layout's variable count binding
+         * 
+         * @param variableDescriptorCount The number of descriptors in the variable count binding
+         * @returns Reference to the builder
+         */
+        virtual IVulkanDescriptorSetBuilder& withVariableDescriptorCount(uint32_t variableDescriptorCount) noexcept = 0;
+
+        /**
+         * @brief Build the Vulkan descriptor sets with a single allocation
+         * 
+         * @param count Number of descriptor sets to allocate
+         * @returns The final Vulkan descriptor sets
+         */
+        virtual std::vector<std::unique_ptr<IVulkanDescriptorSet>> build(uint32_t count) const = 0;
+
         /**
          * @brief Build the Vulkan descriptor set
          * 
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDescriptorUpdateTemplate.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDescriptorSetLayout.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan descriptor update template builder interface
+     */
+    class IVulkanDescriptorUpdateTemplateBuilder
+    {
+    public:
+        /**
+         * @brief Specify the device used to create the descriptor update template
+         * 
+         * @param device The device with which to create the descriptor update template
+         * @returns Reference to the builder
+         */
+        virtual IVulkanDescriptorUpdateTemplateBuilder& withDevice(IVulkanDevice const * device) noexcept = 0;
+
+        /**
+         * @brief Specify the layout of the descriptor sets the template updates
+         * 
+         * @param descriptorSetLayout The descriptor set layout
+         * @returns Reference to the builder
+         */
+        virtual IVulkanDescriptorUpdateTemplateBuilder& withDescriptorSetLayout(IVulkanDescriptorSetLayout const * descriptorSetLayout) noexcept = 0;
+
+        /**
+         * @brief Specify a range of descriptors updated from the packed update data
+         * 
+         * @param binding The descriptor binding within the set
+         * @param arrayElement The first array element within the binding
+         * @param descriptorCount The number of descriptors to update
+         * @param descriptorType The descriptor type of the binding
+         * @param offset Offset in bytes of the first descriptor info within the update data
+         * @param stride Distance in bytes between consecutive descriptor infos within the update data
+         * @returns Reference to the builder
+         */
+        virtual IVulkanDescriptorUpdateTemplateBuilder& withEntry(uint32_t binding, uint32_t arrayElement, uint32_t descriptorCount, VkDescriptorType descriptorType, size_t offset, size_t stride) noexcept = 0;
+
+        /**
+         * @brief Build the Vulkan descriptor update template
+         * 
+         * @returns The final Vulkan descriptor update template
+         */
+        virtual std::unique_ptr<IVulkanDescriptorUpdateTemplate> build() const = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanDescriptorUpdateTemplateBuilder() = default;
+    };
+}
@@ -52,6 +52,14 @@ namespace siofraEngine::systems
          */
         virtual IVulkanDeviceBuilder& withQueueFamilySupport(VulkanDeviceQueueFamilies requiredQueueFamilies) noexcept = 0;
 
+        /**
+         * @brief Specify required optional device features
+         * 
+         * @param requiredFeatures Required optional device features
+         * @returns Reference to the builder
+         */
+        virtual IVulkanDeviceBuilder& withFeatureSupport(VulkanDeviceFeatures requiredFeatures) noexcept = 0;
+
         /**
          * @brief Specify required extensions
          * 
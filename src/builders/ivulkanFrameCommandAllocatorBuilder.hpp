@@ -0,0 +1,59 @@
+#pragma once
+
+#include <memory>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanFrameCommandAllocator.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan frame command allocator builder interface
+     */
+    class IVulkanFrameCommandAllocatorBuilder
+    {
+    public:
+        /**
+         * @brief Specify the device used to create the command pools and allocate command buffers
+         * 
+         * @param device The device with which to create the command pools and allocate command buffers
+         * @returns Reference to the builder
+         */
+        virtual IVulkanFrameCommandAllocatorBuilder& withDevice(IVulkanDevice const * device) noexcept = 0;
+
+        /**
+         * @brief Specify the queue family the command buffers are submitted to
+         * 
+         * @param queueFamilyIndex The command pool queue family index
+         * @returns Reference to the builder
+         */
+        virtual IVulkanFrameCommandAllocatorBuilder& withQueueFamilyIndex(uint32_t queueFamilyIndex) noexcept = 0;
+
+        /**
+         * @brief Specify the number of frames in flight
+         * 
+         * @param frameCount The number of frames in flight
+         * @returns Reference to the builder
+         */
+        virtual IVulkanFrameCommandAllocatorBuilder& withFrameCount(uint32_t frameCount) noexcept = 0;
+
+        /**
+         * @brief Specify the number of recording threads
+         * 
+         * @param threadCount The number of recording threads
+         * @returns Reference to the builder
+         */
+        virtual IVulkanFrameCommandAllocatorBuilder& withThreadCount(uint32_t threadCount) noexcept = 0;
+
+        /**
+         * @brief Build the Vulkan frame command allocator
+         * 
+         * @returns The final Vulkan frame command allocator
+         */
+        virtual std::unique_ptr<IVulkanFrameCommandAllocator> build() const = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanFrameCommandAllocatorBuilder() = default;
+    };
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <memory>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanGpuProfiler.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan GPU profiler builder interface
+     */
+    class IVulkanGpuProfilerBuilder
+    {
+    public:
+        /**
+         * @brief Specify the device to profile. Scopes are recorded on the graphics queue
+         * 
+         * @param device The device to profile
+         * @returns Reference to the builder
+         */
+        virtual IVulkanGpuProfilerBuilder& withDevice(IVulkanDevice const * device) noexcept = 0;
+
+        /**
+         * @brief Specify the number of frames in flight. Results are read back once a frame is reused
+         * 
+         * @param frameCount The number of frames in flight
+         * @returns Reference to the builder
+         */
+        virtual IVulkanGpuProfilerBuilder& withFrameCount(uint32_t frameCount) noexcept = 0;
+
+        /**
+         * @brief Specify the maximum number of scopes recorded per frame
+         * 
+         * @param maxScopes The maximum number of scopes
+         * @returns Reference to the builder
+         */
+        virtual IVulkanGpuProfilerBuilder& withMaxScopes(uint32_t maxScopes) noexcept = 0;
+
+        /**
+         * @brief Specify the number of recent durations each scope's statistics are calculated from
+         * 
+         * @param sampleCount The number of durations
+         * @returns Reference to the builder
+         */
+        virtual IVulkanGpuProfilerBuilder& withSampleCount(uint32_t sampleCount) noexcept = 0;
+
+        /**
+         * @brief Build the Vulkan GPU profiler
+         * 
+         * @returns The final Vulkan GPU profiler
+         */
+        virtual std::unique_ptr<IVulkanGpuProfiler> build() const = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanGpuProfilerBuilder() = default;
+    };
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanMemoryAllocator.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan memory allocator builder interface
+     */
+    class IVulkanMemoryAllocatorBuilder
+    {
+    public:
+        /**
+         * @brief Specify the physical device from which memory is allocated
+         * 
+         * @param physicalDevice The physical device from which memory is allocated
+         * @returns Reference to the builder
+         */
+        virtual IVulkanMemoryAllocatorBuilder& withPhysicalDevice(VkPhysicalDevice physicalDevice) noexcept = 0;
+
+        /**
+         * @brief Specify the logical device with which memory is allocated
+         * 
+         * @param logicalDevice The logical device with which memory is allocated
+         * @returns Reference to the builder
+         */
+        virtual IVulkanMemoryAllocatorBuilder& withLogicalDevice(VkDevice logicalDevice) noexcept = 0;
+
+        /**
+         * @brief Specify the preferred size of the device memory blocks which are sub-allocated
+         * 
+         * @param blockSize The preferred block size in bytes
+         * @returns Reference to the builder
+         */
+        virtual IVulkanMemoryAllocatorBuilder& withBlockSize(VkDeviceSize blockSize) noexcept = 0;
+
+        /**
+         * @brief Build the Vulkan memory allocator
+         * 
+         * @returns The final Vulkan memory allocator
+         */
+        virtual std::unique_ptr<IVulkanMemoryAllocator> build() const = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanMemoryAllocatorBuilder() = default;
+    };
+}
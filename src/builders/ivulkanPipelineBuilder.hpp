@@ -1,12 +1,16 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <vector>
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanPipeline.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanShaderModule.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanDescriptorSetLayout.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanRenderPass.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanPipelineCache.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanPipelineLayoutCache.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/vulkanSpecializationConstants.hpp"
 
 namespace siofraEngine::systems
 {
@@ -40,6 +44,22 @@ namespace siofraEngine::systems
          */
         virtual IVulkanPipelineBuilder& withRenderPass(IVulkanRenderPass const * renderPass) noexcept = 0;
 
+        /**
+         * @brief Specify the pipeline cache used to accelerate pipeline creation
+         * 
+         * @param pipelineCache The pipeline cache used to accelerate pipeline creation
+         * @returns Reference to the builder
+         */
+        virtual IVulkanPipelineBuilder& withPipelineCache(IVulkanPipelineCache const * pipelineCache) noexcept = 0;
+
+        /**
+         * @brief Specify the pipeline layout cache used to share pipeline layouts between pipelines. Without a cache the pipeline owns its layout
+         * 
+         * @param pipelineLayoutCache The pipeline layout cache used to share pipeline layouts
+         * @returns Reference to the builder
+         */
+        virtual IVulkanPipelineBuilder& withPipelineLayoutCache(IVulkanPipelineLayoutCache * pipelineLayoutCache) noexcept = 0;
+
         /**
          * @brief Specify the descriptor set layouts to include in the pipeline layout
          * 
@@ -96,6 +116,74 @@ namespace siofraEngine::systems
          */
         virtual IVulkanPipelineBuilder& withFragmentStage(std::unique_ptr<IVulkanShaderModule> shaderModule) noexcept = 0;
 
+        /**
+         * @brief Specify a pipeline shader module for the vertex stage with a custom entry point and specialization constants
+         * 
+         * @param shaderModule The pipeline shader module
+         * @param entryPoint Name of the shader entry point
+         * @param specializationConstants Values of the shader specialization constants
+         */
+        virtual IVulkanPipelineBuilder& withVertexStage(std::unique_ptr<IVulkanShaderModule> shaderModule, std::string entryPoint, VulkanSpecializationConstants specializationConstants) noexcept = 0;
+
+        /**
+         * @brief Specify a pipeline shader module for the fragment stage with a custom entry point and specialization constants
+         * 
+         * @param shaderModule The pipeline shader module
+         * @param entryPoint Name of the shader entry point
+         * @param specializationConstants Values of the shader specialization constants
+         */
+        virtual IVulkanPipelineBuilder& withFragmentStage(std::unique_ptr<IVulkanShaderModule> shaderModule, std::string entryPoint, VulkanSpecializationConstants specializationConstants) noexcept = 0;
+
+        /**
+         * @brief Specify a state which is set dynamically with command buffer commands rather than baked into the pipeline.
+         * Extended dynamic states require the EXTENDED_DYNAMIC_STATE device feature
+         * 
+         * @param dynamicState The dynamic state
+         * @returns Reference to the builder
+         */
+        virtual IVulkanPipelineBuilder& withDynamicState(VkDynamicState dynamicState) noexcept = 0;
+
+        /**
+         * @brief Specify the primitive topology. Defaults to triangle list
+         * 
+         * @param topology The primitive topology
+         * @returns Reference to the builder
+         */
+        virtual IVulkanPipelineBuilder& withTopology(VkPrimitiveTopology topology) noexcept = 0;
+
+        /**
+         * @brief Specify the triangle facing used for culling. Defaults to back face culling
+         * 
+         * @param cullMode The cull mode
+         * @returns Reference to the builder
+         */
+        virtual IVulkanPipelineBuilder& withCullMode(VkCullModeFlags cullMode) noexcept = 0;
+
+        /**
+         * @brief Specify the front facing triangle orientation. Defaults to counter clockwise
+         * 
+         * @param frontFace The front face orientation
+         * @returns Reference to the builder
+         */
+        virtual IVulkanPipelineBuilder& withFrontFace(VkFrontFace frontFace) noexcept = 0;
+
+        /**
+         * @brief Specify the depth test state. Defaults to testing and writing with a less than comparison
+         * 
+         * @param depthTestEnable Indicates if depth testing is enabled
+         * @param depthWriteEnable Indicates if depth writes are enabled
+         * @param depthCompareOp The depth comparison operator
+         * @returns Reference to the builder
+         */
+        virtual IVulkanPipelineBuilder& withDepthTest(bool depthTestEnable, bool depthWriteEnable, VkCompareOp depthCompareOp) noexcept = 0;
+
+        /**
+         * @brief Get a key identifying the pipeline state the builder would create. Shader modules and other objects are identified by their contents rather than their handles, and static state replaced by dynamic state is excluded. Builders with equal keys create interchangeable pipelines
+         * 
+         * @returns The pipeline state key
+         */
+        virtual std::string getStateKey() const = 0;
+
         /**
          * @brief Build the Vulkan pipeline
          * 
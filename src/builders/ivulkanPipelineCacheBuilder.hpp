@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanPipelineCache.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan pipeline cache builder interface
+     */
+    class IVulkanPipelineCacheBuilder
+    {
+    public:
+        /**
+         * @brief Specify the device used to create the pipeline cache
+         * 
+         * @param device The device with which to create the pipeline cache
+         * @returns Reference to the builder
+         */
+        virtual IVulkanPipelineCacheBuilder& withDevice(IVulkanDevice const * device) noexcept = 0;
+
+        /**
+         * @brief Specify the file the pipeline cache is loaded from and saved to
+         * 
+         * @param filePath Path of the pipeline cache file
+         * @returns Reference to the builder
+         */
+        virtual IVulkanPipelineCacheBuilder& withFilePath(std::string filePath) noexcept = 0;
+
+        /**
+         * @brief Build the Vulkan pipeline cache
+         * 
+         * @returns The final Vulkan pipeline cache
+         */
+        virtual std::unique_ptr<IVulkanPipelineCache> build() const = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanPipelineCacheBuilder() = default;
+    };
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanPipelineCompiler.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan pipeline compiler builder interface
+     */
+    class IVulkanPipelineCompilerBuilder
+    {
+    public:
+        /**
+         * @brief Specify the number of worker threads. Defaults to one less than the number of hardware threads
+         * 
+         * @param threadCount The number of worker threads
+         * @returns Reference to the builder
+         */
+        virtual IVulkanPipelineCompilerBuilder& withThreadCount(uint32_t threadCount) noexcept = 0;
+
+        /**
+         * @brief Specify the maximum number of pipelines created by a single pipeline creation call
+         * 
+         * @param batchSize The maximum number of pipelines per creation call
+         * @returns Reference to the builder
+         */
+        virtual IVulkanPipelineCompilerBuilder& withBatchSize(uint32_t batchSize) noexcept = 0;
+
+        /**
+         * @brief Build the Vulkan pipeline compiler
+         * 
+         * @returns The final Vulkan pipeline compiler
+         */
+        virtual std::unique_ptr<IVulkanPipelineCompiler> build() const = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanPipelineCompilerBuilder() = default;
+    };
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanPipelineLayout.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDescriptorSetLayout.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan pipeline layout builder interface
+     */
+    class IVulkanPipelineLayoutBuilder
+    {
+    public:
+        /**
+         * @brief Specify the device used to create the pipeline layout
+         * 
+         * @param device The device with which to create the pipeline layout
+         * @returns Reference to the builder
+         */
+        virtual IVulkanPipelineLayoutBuilder& withDevice(IVulkanDevice const * device) noexcept = 0;
+
+        /**
+         * @brief Specify the descriptor set layouts to include in the pipeline layout
+         * 
+         * @param descriptorSetLayouts The descriptor set layouts to include in the pipeline layout
+         * @returns Reference to the builder
+         */
+        virtual IVulkanPipelineLayoutBuilder& withDescriptorSetLayouts(std::vector<IVulkanDescriptorSetLayout const *> descriptorSetLayouts) noexcept = 0;
+
+        /**
+         * @brief Specify a push constant range
+         * 
+         * @param stageFlags The shader stages that will access the range of push constants
+         * @param offset The start offset of the range in bytes
+         * @param size The size of the range in bytes
+         * @returns Reference to the builder
+         */
+        virtual IVulkanPipelineLayoutBuilder& withPushConstantRange(VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size) noexcept = 0;
+
+        /**
+         * @brief Get a key identifying the configured layout state. Set layouts are identified by their bindings rather than their handles. Builders with equal keys build compatible pipeline layouts
+         * 
+         * @returns The layout state key
+         */
+        virtual std::string getStateKey() const = 0;
+
+        /**
+         * @brief Build the Vulkan pipeline layout
+         * 
+         * @returns The final Vulkan pipeline layout
+         */
+        virtual std::unique_ptr<IVulkanPipelineLayout> build() const = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanPipelineLayoutBuilder() = default;
+    };
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanQueryPool.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan query pool builder interface
+     */
+    class IVulkanQueryPoolBuilder
+    {
+    public:
+        /**
+         * @brief Specify the device used to create the query pool
+         * 
+         * @param device The device with which to create the query pool
+         * @returns Reference to the builder
+         */
+        virtual IVulkanQueryPoolBuilder& withDevice(IVulkanDevice const * device) noexcept = 0;
+
+        /**
+         * @brief Specify the type of the queries in the pool
+         * 
+         * @param queryType The query type
+         * @returns Reference to the builder
+         */
+        virtual IVulkanQueryPoolBuilder& withQueryType(VkQueryType queryType) noexcept = 0;
+
+        /**
+         * @brief Specify the number of queries in the pool
+         * 
+         * @param queryCount The number of queries
+         * @returns Reference to the builder
+         */
+        virtual IVulkanQueryPoolBuilder& withQueryCount(uint32_t queryCount) noexcept = 0;
+
+        /**
+         * @brief Build the Vulkan query pool
+         * 
+         * @returns The final Vulkan query pool
+         */
+        virtual std::unique_ptr<IVulkanQueryPool> build() const = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanQueryPoolBuilder() = default;
+    };
+}
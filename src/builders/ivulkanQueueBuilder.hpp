@@ -36,6 +36,14 @@ namespace siofraEngine::systems
          */
 		virtual IVulkanQueueBuilder& withQueueIndex(std::uint32_t queueIndex) noexcept = 0;
 
+        /**
+         * @brief Specify if submissions use vkQueueSubmit2. Requires the SYNCHRONIZATION_2 device feature
+         * 
+         * @param synchronization2 Indicates if synchronization2 is enabled
+         * @returns Reference to the Vulkan queue builder
+         */
+        virtual IVulkanQueueBuilder& withSynchronization2(bool synchronization2) noexcept = 0;
+
         /**
          * @brief Build the Vulkan queue
          * 
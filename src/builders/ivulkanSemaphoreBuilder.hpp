@@ -20,6 +20,22 @@ namespace siofraEngine::systems
          */
         virtual IVulkanSemaphoreBuilder& withDevice(IVulkanDevice const * device) noexcept = 0;
 
+        /**
+         * @brief Specify the semaphore type. Timeline semaphores require the timeline semaphore device feature
+         * 
+         * @param type The semaphore type
+         * @returns Reference to the builder
+         */
+        virtual IVulkanSemaphoreBuilder& withType(VkSemaphoreType type) noexcept = 0;
+
+        /**
+         * @brief Specify the initial counter value of a timeline semaphore
+         * 
+         * @param initialValue The initial counter value
+         * @returns Reference to the builder
+         */
+        virtual IVulkanSemaphoreBuilder& withInitialValue(uint64_t initialValue) noexcept = 0;
+
         /**
          * @brief Build the Vulkan semaphore
          * 
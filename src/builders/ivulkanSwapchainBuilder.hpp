@@ -38,6 +38,14 @@ namespace siofraEngine::systems
          */
         virtual IVulkanSwapchainBuilder& withExtents(uint32_t width, uint32_t height) noexcept = 0;
 
+        /**
+         * @brief Specify the swapchain being replaced, allowing the driver to reuse its resources
+         * 
+         * @param oldSwapchain The swapchain being replaced
+         * @returns Reference to the builder
+         */
+        virtual IVulkanSwapchainBuilder& withOldSwapchain(IVulkanSwapchain const * oldSwapchain) noexcept = 0;
+
         /**
          * @brief Build the Vulkan swapchain
          * 
@@ -45,6 +53,19 @@ namespace siofraEngine::systems
          */
         virtual std::unique_ptr<IVulkanSwapchain> build() const = 0;
 
+        /**
+         * @brief Build the swapchain handle and attachments without wrapping them, allowing an existing swapchain to be recreated in place
+         * 
+         * @param swapchain The swapchain handle to populate
+         * @param imageFormat The swapchain image format to populate
+         * @param depthAttachmentFormat The depth attachment format to populate
+         * @param extents The swapchain extents to populate
+         * @param swapChainImages The swapchain images to populate
+         * @param depthAttachments The depth attachments to populate, one per frame in flight
+         * @returns True if the swapchain was built, false if the surface has a zero extent, such as when the window is minimised
+         */
+        virtual bool buildHandles(VkSwapchainKHR & swapchain, VkFormat & imageFormat, VkFormat & depthAttachmentFormat, VkExtent2D & extents, std::vector<std::unique_ptr<IVulkanImage>> & swapChainImages, std::vector<std::unique_ptr<IVulkanImage>> & depthAttachments) const = 0;
+
         /**
          * @brief Interface destructor
          */
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanTransferManager.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan transfer manager builder interface
+     */
+    class IVulkanTransferManagerBuilder
+    {
+    public:
+        /**
+         * @brief Specify the device the transfers are performed on
+         * 
+         * @param device The device the transfers are performed on
+         * @returns Reference to the builder
+         */
+        virtual IVulkanTransferManagerBuilder& withDevice(IVulkanDevice const * device) noexcept = 0;
+
+        /**
+         * @brief Specify the number of batches which may be in flight at once
+         * 
+         * @param batchCount The number of batches
+         * @returns Reference to the builder
+         */
+        virtual IVulkanTransferManagerBuilder& withBatchCount(uint32_t batchCount) noexcept = 0;
+
+        /**
+         * @brief Specify the mutex guarding submission to the device queues. The transfer manager holds it while submitting, and every other
+         * thread must hold it while submitting to or presenting on the graphics queue, or any queue sharing its handle
+         * 
+         * @param queueMutex The queue mutex
+         * @returns Reference to the builder
+         */
+        virtual IVulkanTransferManagerBuilder& withQueueMutex(std::mutex * queueMutex) noexcept = 0;
+
+        /**
+         * @brief Build the Vulkan transfer manager
+         * 
+         * @returns The final Vulkan transfer manager
+         */
+        virtual std::unique_ptr<IVulkanTransferManager> build() const = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanTransferManagerBuilder() = default;
+    };
+}
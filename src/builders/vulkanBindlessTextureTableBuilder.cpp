@@ -0,0 +1,71 @@
+#include "systems/renderer/vulkan/vulkanComponents/builders/vulkanBindlessTextureTableBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanBindlessTextureTable::Builder::Builder(IVulkanDescriptorSetLayoutBuilder& vulkanDescriptorSetLayoutBuilder, IVulkanDescriptorPoolBuilder& vulkanDescriptorPoolBuilder, IVulkanDescriptorSetBuilder& vulkanDescriptorSetBuilder) :
+        vulkanDescriptorSetLayoutBuilder{vulkanDescriptorSetLayoutBuilder},
+        vulkanDescriptorPoolBuilder{vulkanDescriptorPoolBuilder},
+        vulkanDescriptorSetBuilder{vulkanDescriptorSetBuilder}
+    {
+
+    }
+
+    IVulkanBindlessTextureTableBuilder& VulkanBindlessTextureTable::Builder::withDevice(IVulkanDevice const * device) noexcept
+    {
+        this->device = device;
+        return *this;
+    }
+
+    IVulkanBindlessTextureTableBuilder& VulkanBindlessTextureTable::Builder::withCapacity(uint32_t capacity) noexcept
+    {
+        this->capacity = capacity;
+        return *this;
+    }
+
+    IVulkanBindlessTextureTableBuilder& VulkanBindlessTextureTable::Builder::withFrameCount(uint32_t frameCount) noexcept
+    {
+        this->frameCount = frameCount;
+        return *this;
+    }
+
+    std::unique_ptr<IVulkanBindlessTextureTable> VulkanBindlessTextureTable::Builder::build() const
+    {
+        if (!device->isFeatureEnabled(VulkanDeviceFeatures::DESCRIPTOR_INDEXING))
+        {
+            throw std::runtime_error("Failed to create bindless texture table, descriptor indexing is not enabled on the device");
+        }
+
+        if (capacity == 0 || frameCount == 0)
+        {
+            throw std::runtime_error("Failed to create bindless texture table, capacity and frame count must be non-zero");
+        }
+
+        // Update unused while pending allows writing free slots while the set is bound by in flight frames. Removed slots are only
+        // reused once the frames which may still sample them have completed, so a written slot is never in use
+        VkDescriptorBindingFlags bindingFlags = VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT |
+            VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT |
+            VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT |
+            VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT;
+
+        std::unique_ptr<IVulkanDescriptorSetLayout> descriptorSetLayout = vulkanDescriptorSetLayoutBuilder
+            .withDevice(device)
+            .withLayoutBinding(0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, capacity, VK_SHADER_STAGE_ALL, bindingFlags)
+            .build();
+
+        std::unique_ptr<IVulkanDescriptorPool> descriptorPool = vulkanDescriptorPoolBuilder
+            .withDevice(device)
+            .withPoolSize(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, capacity)
+            .withMaxSets(1)
+            .withFlags(VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT)
+            .build();
+
+        std::unique_ptr<IVulkanDescriptorSet> descriptorSet = vulkanDescriptorSetBuilder
+            .withDevice(device)
+            .withDescriptorPool(descriptorPool.get())
+            .withDescriptorSetLayout(descriptorSetLayout.get())
+            .withVariableDescriptorCount(capacity)
+            .build();
+
+        return std::make_unique<VulkanBindlessTextureTable>(std::move(descriptorSetLayout), std::move(descriptorPool), std::move(descriptorSet), capacity, frameCount, device);
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stdexcept>
+#include "systems/renderer/vulkan/vulkanComponents/vulkanBindlessTextureTable.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanBindlessTextureTableBuilder.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanDescriptorSetLayoutBuilder.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanDescriptorPoolBuilder.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanDescriptorSetBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan bindless texture table builder
+     */
+    class VulkanBindlessTextureTable::Builder : public IVulkanBindlessTextureTableBuilder
+    {
+    public:
+        /**
+         * @brief Vulkan bindless texture table builder constructor
+         * 
+         * @param vulkanDescriptorSetLayoutBuilder Vulkan descriptor set layout builder
+         * @param vulkanDescriptorPoolBuilder Vulkan descriptor pool builder
+         * @param vulkanDescriptorSetBuilder Vulkan descriptor set builder
+         */
+        Builder(IVulkanDescriptorSetLayoutBuilder& vulkanDescriptorSetLayoutBuilder, IVulkanDescriptorPoolBuilder& vulkanDescriptorPoolBuilder, IVulkanDescriptorSetBuilder& vulkanDescriptorSetBuilder);
+
+        /**
+         * @brief Specify the device the table is created on. The device must have descriptor indexing enabled
+         * 
+         * @param device The device the table is created on
+         * @returns Reference to the builder
+         */
+        IVulkanBindlessTextureTableBuilder& withDevice(IVulkanDevice const * device) noexcept override;
+
+        /**
+         * @brief Specify the maximum number of textures in the table
+         * 
+         * @param capacity The table capacity
+         * @returns Reference to the builder
+         */
+        IVulkanBindlessTextureTableBuilder& withCapacity(uint32_t capacity) noexcept override;
+
+        /**
+         * @brief Specify the number of frames in flight. Removed indices are reused once the frame they were removed in is next begun
+         * 
+         * @param frameCount The number of frames in flight
+         * @returns Reference to the builder
+         */
+        IVulkanBindlessTextureTableBuilder& withFrameCount(uint32_t frameCount) noexcept override;
+
+        /**
+         * @brief Build the Vulkan bindless texture table
+         * 
+         * @returns The final Vulkan bindless texture table
+         */
+        std::unique_ptr<IVulkanBindlessTextureTable> build() const override;
+
+    private:
+        /**
+         * @brief Vulkan descriptor set layout builder
+         */
+        IVulkanDescriptorSetLayoutBuilder& vulkanDescriptorSetLayoutBuilder;
+
+        /**
+         * @brief Vulkan descriptor pool builder
+         */
+        IVulkanDescriptorPoolBuilder& vulkanDescriptorPoolBuilder;
+
+        /**
+         * @brief Vulkan descriptor set builder
+         */
+        IVulkanDescriptorSetBuilder& vulkanDescriptorSetBuilder;
+
+        /**
+         * @brief The device the table is created on
+         */
+        IVulkanDevice const * device{ nullptr };
+
+        /**
+         * @brief The table capacity
+         */
+        uint32_t capacity{ 4096 };
+
+        /**
+         * @brief The number of frames in flight
+         */
+        uint32_t frameCount{ 2 };
+    };
+}
@@ -26,6 +26,12 @@ namespace siofraEngine::systems
         return *this;
     }
 
+    IVulkanBufferBuilder& VulkanBuffer::Builder::withPersistentMapping() noexcept
+    {
+        this->persistentMapping = true;
+        return *this;
+    }
+
     std::unique_ptr<IVulkanBuffer> VulkanBuffer::Builder::build() const
     {
         VkDevice logicalDevice = device->getLogicalDevice();
@@ -45,35 +51,31 @@ namespace siofraEngine::systems
         VkMemoryRequirements memoryRequirments{ };
         vkGetBufferMemoryRequirements(logicalDevice, buffer, &memoryRequirments);
 
-        VkMemoryAllocateInfo memoryAllocInfo{ };
-        memoryAllocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        memoryAllocInfo.allocationSize = memoryRequirments.size;
-        memoryAllocInfo.memoryTypeIndex = findMemoryTypeIndex(device, memoryRequirments.memoryTypeBits, memoryPropertyFlags);
-
-        VkDeviceMemory bufferMemory{ VK_NULL_HANDLE };
-        if (vkAllocateMemory(logicalDevice, &memoryAllocInfo, nullptr, &bufferMemory) != VK_SUCCESS)
+        VulkanMemoryAllocation bufferMemory{ };
+        try
         {
-            throw std::runtime_error("Failed to allocate buffer memory");
+            bufferMemory = device->getMemoryAllocator()->allocate(memoryRequirments, memoryPropertyFlags, true);
+        }
+        catch (...)
+        {
+            vkDestroyBuffer(logicalDevice, buffer, nullptr);
+            throw;
         }
 
-        vkBindBufferMemory(logicalDevice, buffer, bufferMemory, 0);
-
-        return std::make_unique<VulkanBuffer>(buffer, bufferMemory, device);
-    }
-
-    uint32_t VulkanBuffer::Builder::findMemoryTypeIndex(IVulkanDevice const * device, uint32_t allowedTypes, VkMemoryPropertyFlags properties) const
-    {
-        VkPhysicalDeviceMemoryProperties memoryProperties{ };
-        vkGetPhysicalDeviceMemoryProperties(device->getPhysicalDevice(), &memoryProperties);
+        if (vkBindBufferMemory(logicalDevice, buffer, bufferMemory.memory, bufferMemory.offset) != VK_SUCCESS)
+        {
+            // Return the sub-allocation to its block, as no buffer will own it
+            device->getMemoryAllocator()->free(bufferMemory);
+            vkDestroyBuffer(logicalDevice, buffer, nullptr);
+            throw std::runtime_error("Failed to bind buffer memory");
+        }
 
-        for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++)
+        void * mappedMemory{ nullptr };
+        if (persistentMapping)
         {
-            if ((allowedTypes & (1 << i)) && (memoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
-            {
-                return i;
-            }
+            mappedMemory = device->getMemoryAllocator()->map(bufferMemory);
         }
 
-        throw std::runtime_error("Failed to find buffer memory type index");
+        return std::make_unique<VulkanBuffer>(buffer, bufferMemory, mappedMemory, device);
     }
 }
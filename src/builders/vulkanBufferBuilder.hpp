@@ -44,6 +44,13 @@ namespace siofraEngine::systems
          */
         IVulkanBufferBuilder& withMemoryPropertyFlags(VkMemoryPropertyFlags memoryPropertyFlags) noexcept override;
 
+        /**
+         * @brief Persistently map the buffer memory when it is built, rather than on every update. The memory must be host visible
+         * 
+         * @returns Reference to the builder
+         */
+        IVulkanBufferBuilder& withPersistentMapping() noexcept override;
+
         /**
          * @brief Build the Vulkan buffer
          * 
@@ -73,13 +80,8 @@ namespace siofraEngine::systems
         VkMemoryPropertyFlags memoryPropertyFlags{ };
 
         /**
-         * @brief Find the index of the required memory type, within the physical device memory properties, which satisfies the buffer memory requirements and the desired memory types
-         * 
-         * @param device The device to search for the required memory type index
-         * @param allowedTypes The allowed buffer memory types
-         * @param properties The desired buffer memory types
-         * @returns The memory type index
+         * @brief Indicates if the buffer memory is persistently mapped
          */
-        uint32_t findMemoryTypeIndex(IVulkanDevice const * device, uint32_t allowedTypes, VkMemoryPropertyFlags properties) const;
+        bool persistentMapping{ false };
     };
 }
@@ -34,10 +34,11 @@ namespace siofraEngine::systems
             throw std::runtime_error("Failed to allocate command buffer(s)");
         }
 
+        bool synchronization2 = device->isFeatureEnabled(VulkanDeviceFeatures::SYNCHRONIZATION_2);
         std::vector<std::unique_ptr<IVulkanCommandBuffer>> commandBuffers(count);
         for(size_t i = 0; i < count; ++i)
         {
-            commandBuffers[i] = std::make_unique<VulkanCommandBuffer>(commandBufferHandles[i]);
+            commandBuffers[i] = std::make_unique<VulkanCommandBuffer>(commandBufferHandles[i], synchronization2);
         }
 
         return commandBuffers;
@@ -57,6 +58,6 @@ namespace siofraEngine::systems
             throw std::runtime_error("Failed to allocate command buffer(s)");
         }
 
-        return std::make_unique<VulkanCommandBuffer>(commandBuffer);
+        return std::make_unique<VulkanCommandBuffer>(commandBuffer, device->isFeatureEnabled(VulkanDeviceFeatures::SYNCHRONIZATION_2));
     }
 }
@@ -0,0 +1,62 @@
+#include "systems/renderer/vulkan/vulkanComponents/builders/vulkanCommandPoolSetBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanCommandPoolSet::Builder::Builder(IVulkanCommandPoolBuilder& vulkanCommandPoolBuilder) :
+        vulkanCommandPoolBuilder{vulkanCommandPoolBuilder}
+    {
+
+    }
+
+    IVulkanCommandPoolSetBuilder& VulkanCommandPoolSet::Builder::withDevice(IVulkanDevice const * device) noexcept
+    {
+        this->device = device;
+        return *this;
+    }
+
+    IVulkanCommandPoolSetBuilder& VulkanCommandPoolSet::Builder::withFlags(VkCommandPoolCreateFlags flags) noexcept
+    {
+        this->flags = flags;
+        return *this;
+    }
+
+    IVulkanCommandPoolSetBuilder& VulkanCommandPoolSet::Builder::withQueueFamilyIndex(uint32_t queueFamilyIndex) noexcept
+    {
+        this->queueFamilyIndex = queueFamilyIndex;
+        return *this;
+    }
+
+    IVulkanCommandPoolSetBuilder& VulkanCommandPoolSet::Builder::withFrameCount(uint32_t frameCount) noexcept
+    {
+        this->frameCount = frameCount;
+        return *this;
+    }
+
+    IVulkanCommandPoolSetBuilder& VulkanCommandPoolSet::Builder::withThreadCount(uint32_t threadCount) noexcept
+    {
+        this->threadCount = threadCount;
+        return *this;
+    }
+
+    std::unique_ptr<IVulkanCommandPoolSet> VulkanCommandPoolSet::Builder::build() const
+    {
+        if (frameCount == 0 || threadCount == 0)
+        {
+            throw std::runtime_error("Failed to create command pool set, frame and thread counts must be non-zero");
+        }
+
+        vulkanCommandPoolBuilder
+            .withDevice(device)
+            .withFlags(flags)
+            .withQueueFamilyIndex(queueFamilyIndex);
+
+        std::vector<std::unique_ptr<IVulkanCommandPool>> commandPools{ };
+        commandPools.reserve(static_cast<size_t>(frameCount) * threadCount);
+        for (uint32_t i = 0; i < frameCount * threadCount; ++i)
+        {
+            commandPools.push_back(vulkanCommandPoolBuilder.build());
+        }
+
+        return std::make_unique<VulkanCommandPoolSet>(std::move(commandPools), frameCount, threadCount);
+    }
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <stdexcept>
+#include "systems/renderer/vulkan/vulkanComponents/vulkanCommandPoolSet.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanCommandPoolSetBuilder.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanCommandPoolBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan command pool set builder
+     */
+    class VulkanCommandPoolSet::Builder : public IVulkanCommandPoolSetBuilder
+    {
+    public:
+        /**
+         * @brief Vulkan command pool set builder constructor
+         * 
+         * @param vulkanCommandPoolBuilder Vulkan command pool builder
+         */
+        Builder(IVulkanCommandPoolBuilder& vulkanCommandPoolBuilder);
+
+        /**
+         * @brief Specify the device used to create the command pools
+         * 
+         * @param device The device with which to create the command pools
+         * @returns Reference to the builder
+         */
+        IVulkanCommandPoolSetBuilder& withDevice(IVulkanDevice const * device) noexcept override;
+
+        /**
+         * @brief Specify the command pool create flags
+         * 
+         * @param flags The command pool create flags
+         * @returns Reference to the builder
+         */
+        IVulkanCommandPoolSetBuilder& withFlags(VkCommandPoolCreateFlags flags) noexcept override;
+
+        /**
+         * @brief Specify the queue family the command pools allocate command buffers for
+         * 
+         * @param queueFamilyIndex The command pool queue family index
+         * @returns Reference to the builder
+         */
+        IVulkanCommandPoolSetBuilder& withQueueFamilyIndex(uint32_t queueFamilyIndex) noexcept override;
+
+        /**
+         * @brief Specify the number of frames in flight
+         * 
+         * @param frameCount The number of frames in flight
+         * @returns Reference to the builder
+         */
+        IVulkanCommandPoolSetBuilder& withFrameCount(uint32_t frameCount) noexcept override;
+
+        /**
+         * @brief Specify the number of recording threads
+         * 
+         * @param threadCount The number of recording threads
+         * @returns Reference to the builder
+         */
+        IVulkanCommandPoolSetBuilder& withThreadCount(uint32_t threadCount) noexcept override;
+
+        /**
+         * @brief Build the Vulkan command pool set
+         * 
+         * @returns The final Vulkan command pool set
+         */
+        std::unique_ptr<IVulkanCommandPoolSet> build() const override;
+
+    private:
+        /**
+         * @brief Vulkan command pool builder
+         */
+        IVulkanCommandPoolBuilder& vulkanCommandPoolBuilder;
+
+        /**
+         * @brief The device with which to create the command pools
+         */
+        IVulkanDevice const * device{ nullptr };
+
+        /**
+         * @brief The command pool create flags. Pools are reset as a whole, so buffers are transient by default
+         */
+        VkCommandPoolCreateFlags flags{ VK_COMMAND_POOL_CREATE_TRANSIENT_BIT };
+
+        /**
+         * @brief The command pool queue family index
+         */
+        uint32_t queueFamilyIndex{ 0 };
+
+        /**
+         * @brief The number of frames in flight
+         */
+        uint32_t frameCount{ 2 };
+
+        /**
+         * @brief The number of recording threads
+         */
+        uint32_t threadCount{ 1 };
+    };
+}
@@ -0,0 +1,148 @@
+#include "systems/renderer/vulkan/vulkanComponents/builders/vulkanComputePipelineBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    IVulkanComputePipelineBuilder& VulkanComputePipeline::Builder::withDevice(IVulkanDevice const * device) noexcept
+    {
+        this->device = device;
+        return *this;
+    }
+
+    IVulkanComputePipelineBuilder& VulkanComputePipeline::Builder::withPipelineCache(IVulkanPipelineCache const * pipelineCache) noexcept
+    {
+        this->pipelineCache = pipelineCache;
+        return *this;
+    }
+
+    IVulkanComputePipelineBuilder& VulkanComputePipeline::Builder::withPipelineLayoutCache(IVulkanPipelineLayoutCache * pipelineLayoutCache) noexcept
+    {
+        this->pipelineLayoutCache = pipelineLayoutCache;
+        return *this;
+    }
+
+    IVulkanComputePipelineBuilder& VulkanComputePipeline::Builder::withDescriptorSetLayouts(std::vector<IVulkanDescriptorSetLayout const *> descriptorSetLayouts) noexcept
+    {
+        this->descriptorSetLayouts = descriptorSetLayouts;
+        return *this;
+    }
+
+    IVulkanComputePipelineBuilder& VulkanComputePipeline::Builder::withPushConstantRange(uint32_t offset, uint32_t size) noexcept
+    {
+        VkPushConstantRange pushConstantRange{ };
+        pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        pushConstantRange.offset = offset;
+        pushConstantRange.size = size;
+        pushConstantRanges.push_back(pushConstantRange);
+        return *this;
+    }
+
+    IVulkanComputePipelineBuilder& VulkanComputePipeline::Builder::withComputeStage(std::unique_ptr<IVulkanShaderModule> shaderModule) noexcept
+    {
+        this->computeShaderModule = std::move(shaderModule);
+        return *this;
+    }
+
+    IVulkanComputePipelineBuilder& VulkanComputePipeline::Builder::withComputeStage(std::unique_ptr<IVulkanShaderModule> shaderModule, std::string entryPoint, VulkanSpecializationConstants specializationConstants) noexcept
+    {
+        this->computeShaderModule = std::move(shaderModule);
+        this->computeEntryPoint = std::move(entryPoint);
+        this->specializationConstants = std::move(specializationConstants);
+        return *this;
+    }
+
+    IVulkanComputePipelineBuilder& VulkanComputePipeline::Builder::withSpecializationConstants(VulkanSpecializationConstants specializationConstants) noexcept
+    {
+        this->specializationConstants = std::move(specializationConstants);
+        return *this;
+    }
+
+    std::string VulkanComputePipeline::Builder::getStateKey() const
+    {
+        std::string stateKey{ "compute" };
+        auto append = [&stateKey](auto const & value) {
+            stateKey.append(reinterpret_cast<char const *>(&value), sizeof(value));
+        };
+
+        auto appendKey = [&stateKey](std::string const & key) {
+            size_t keySize = key.size();
+            stateKey.append(reinterpret_cast<char const *>(&keySize), sizeof(keySize));
+            stateKey.append(key);
+        };
+
+        // Objects are identified by their contents rather than handles, which may be reused once the objects are destroyed
+        append(device->getLogicalDevice());
+
+        append(pushConstantRanges.size());
+        for (auto const & pushConstantRange : pushConstantRanges)
+        {
+            append(pushConstantRange.offset);
+            append(pushConstantRange.size);
+        }
+
+        append(descriptorSetLayouts.size());
+        for (auto const & descriptorSetLayout : descriptorSetLayouts)
+        {
+            appendKey(descriptorSetLayout->getStateKey());
+        }
+
+        appendKey(computeShaderModule ? computeShaderModule->getStateKey() : std::string{ });
+        stateKey.append(computeEntryPoint.c_str(), computeEntryPoint.size() + 1);
+        specializationConstants.appendStateKey(stateKey);
+
+        return stateKey;
+    }
+
+    std::unique_ptr<IVulkanPipeline> VulkanComputePipeline::Builder::build() const
+    {
+        if (!computeShaderModule)
+        {
+            throw std::runtime_error("Failed to create compute pipeline, no compute stage specified");
+        }
+
+        std::shared_ptr<IVulkanPipelineLayout> pipelineLayout = buildPipelineLayout();
+
+        VkSpecializationInfo specializationInfo = specializationConstants.getSpecializationInfo();
+
+        VkPipelineShaderStageCreateInfo computeShaderCreateInfo{ };
+        computeShaderCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        computeShaderCreateInfo.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        computeShaderCreateInfo.module = computeShaderModule->getShaderModule();
+        computeShaderCreateInfo.pName = computeEntryPoint.c_str();
+        computeShaderCreateInfo.pSpecializationInfo = specializationConstants.empty() ? nullptr : &specializationInfo;
+
+        VkComputePipelineCreateInfo pipelineCreateInfo{ };
+        pipelineCreateInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        pipelineCreateInfo.stage = computeShaderCreateInfo;
+        pipelineCreateInfo.layout = pipelineLayout->getPipelineLayout();
+        pipelineCreateInfo.basePipelineHandle = VK_NULL_HANDLE;
+        pipelineCreateInfo.basePipelineIndex = -1;
+
+        VkPipelineCache pipelineCacheHandle = pipelineCache ? pipelineCache->getPipelineCache() : VK_NULL_HANDLE;
+
+        VkPipeline pipeline{ VK_NULL_HANDLE };
+        if (vkCreateComputePipelines(device->getLogicalDevice(), pipelineCacheHandle, 1, &pipelineCreateInfo, nullptr, &pipeline) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create compute pipeline");
+        }
+
+        return std::make_unique<VulkanComputePipeline>(pipeline, pipelineLayout, device);
+    }
+
+    std::shared_ptr<IVulkanPipelineLayout> VulkanComputePipeline::Builder::buildPipelineLayout() const
+    {
+        VulkanPipelineLayout::Builder pipelineLayoutBuilder;
+        pipelineLayoutBuilder
+            .withDevice(device)
+            .withDescriptorSetLayouts(descriptorSetLayouts);
+        for (auto const & pushConstantRange : pushConstantRanges)
+        {
+            pipelineLayoutBuilder.withPushConstantRange(pushConstantRange.stageFlags, pushConstantRange.offset, pushConstantRange.size);
+        }
+
+        if (pipelineLayoutCache)
+        {
+            return pipelineLayoutCache->getOrCreate(pipelineLayoutBuilder);
+        }
+        return pipelineLayoutBuilder.build();
+    }
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <stdexcept>
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanComputePipelineBuilder.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/vulkanComputePipeline.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/vulkanPipelineLayoutBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan compute pipeline builder
+     */
+    class VulkanComputePipeline::Builder : public IVulkanComputePipelineBuilder
+    {
+    public:
+        /**
+         * @brief Specify the device used to create the pipeline
+         * 
+         * @param device The device with which to create the pipeline
+         * @returns Reference to the builder
+         */
+        IVulkanComputePipelineBuilder& withDevice(IVulkanDevice const * device) noexcept override;
+
+        /**
+         * @brief Specify the pipeline cache used to accelerate pipeline creation
+         * 
+         * @param pipelineCache The pipeline cache, or nullptr to create the pipeline without one
+         * @returns Reference to the builder
+         */
+        IVulkanComputePipelineBuilder& withPipelineCache(IVulkanPipelineCache const * pipelineCache) noexcept override;
+
+        /**
+         * @brief Specify the pipeline layout cache used to share pipeline layouts between pipelines. Without a cache the pipeline owns its layout
+         * 
+         * @param pipelineLayoutCache The pipeline layout cache used to share pipeline layouts
+         * @returns Reference to the builder
+         */
+        IVulkanComputePipelineBuilder& withPipelineLayoutCache(IVulkanPipelineLayoutCache * pipelineLayoutCache) noexcept override;
+
+        /**
+         * @brief Specify the descriptor set layouts to include in the pipeline layout
+         * 
+         * @param descriptorSetLayouts The descriptor set layouts
+         * @returns Reference to the builder
+         */
+        IVulkanComputePipelineBuilder& withDescriptorSetLayouts(std::vector<IVulkanDescriptorSetLayout const *> descriptorSetLayouts) noexcept override;
+
+        /**
+         * @brief Specify a push constant range
+         * 
+         * @param offset The start offset. Must be multiple of 4
+         * @param size The push constant size. Must be multiple of 4
+         * @returns Reference to the builder
+         */
+        IVulkanComputePipelineBuilder& withPushConstantRange(uint32_t offset, uint32_t size) noexcept override;
+
+        /**
+         * @brief Specify the pipeline shader module for the compute stage
+         * 
+         * @param shaderModule The pipeline shader module
+         * @returns Reference to the builder
+         */
+        IVulkanComputePipelineBuilder& withComputeStage(std::unique_ptr<IVulkanShaderModule> shaderModule) noexcept override;
+
+        /**
+         * @brief Specify the pipeline shader module for the compute stage with a custom entry point and specialization constants
+         * 
+         * @param shaderModule The pipeline shader module
+         * @param entryPoint Name of the shader entry point
+         * @param specializationConstants Values of the shader specialization constants
+         * @returns Reference to the builder
+         */
+        IVulkanComputePipelineBuilder& withComputeStage(std::unique_ptr<IVulkanShaderModule> shaderModule, std::string entryPoint, VulkanSpecializationConstants specializationConstants) noexcept override;
+
+        /**
+         * @brief Specify the specialization constants of the compute stage
+         * 
+         * @param specializationConstants The specialization constants
+         * @returns Reference to the builder
+         */
+        IVulkanComputePipelineBuilder& withSpecializationConstants(VulkanSpecializationConstants specializationConstants) noexcept override;
+
+        /**
+         * @brief Get a key identifying the pipeline state the builder would create. Shader modules and other objects are identified by their contents rather than their handles. Builders with equal keys create interchangeable pipelines
+         * 
+         * @returns The pipeline state key
+         */
+        std::string getStateKey() const override;
+
+        /**
+         * @brief Build the Vulkan compute pipeline
+         * 
+         * @returns The final Vulkan compute pipeline
+         */
+        std::unique_ptr<IVulkanPipeline> build() const override;
+
+    private:
+        /**
+         * @brief The device with which to create the pipeline
+         */
+        IVulkanDevice const * device{ nullptr };
+
+        /**
+         * @brief The pipeline cache used to accelerate pipeline creation
+         */
+        IVulkanPipelineCache const * pipelineCache{ nullptr };
+
+        /**
+         * @brief The pipeline layout cache used to share pipeline layouts between pipelines
+         */
+        IVulkanPipelineLayoutCache * pipelineLayoutCache{ nullptr };
+
+        /**
+         * @brief The descriptor set layouts to include in the pipeline layout
+         */
+        std::vector<IVulkanDescriptorSetLayout const *> descriptorSetLayouts{ };
+
+        /**
+         * @brief The push constant ranges to include in the pipeline layout
+         */
+        std::vector<VkPushConstantRange> pushConstantRanges{ };
+
+        /**
+         * @brief The pipeline compute stage shader module
+         */
+        std::unique_ptr<IVulkanShaderModule> computeShaderModule{ };
+
+        /**
+         * @brief The pipeline compute stage entry point
+         */
+        std::string computeEntryPoint{ "main" };
+
+        /**
+         * @brief The specialization constants of the compute stage
+         */
+        VulkanSpecializationConstants specializationConstants{ };
+
+        /**
+         * @brief Get the pipeline layout for the configured descriptor set layouts and push constant ranges, shared through the pipeline layout cache if one was specified
+         * 
+         * @returns The pipeline layout
+         */
+        std::shared_ptr<IVulkanPipelineLayout> buildPipelineLayout() const;
+    };
+}
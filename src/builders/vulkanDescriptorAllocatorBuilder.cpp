@@ -0,0 +1,47 @@
+#include "systems/renderer/vulkan/vulkanComponents/builders/vulkanDescriptorAllocatorBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    IVulkanDescriptorAllocatorBuilder& VulkanDescriptorAllocator::Builder::withDevice(IVulkanDevice const * device) noexcept
+    {
+        this->device = device;
+        return *this;
+    }
+
+    IVulkanDescriptorAllocatorBuilder& VulkanDescriptorAllocator::Builder::withFrameCount(uint32_t frameCount) noexcept
+    {
+        this->frameCount = frameCount;
+        return *this;
+    }
+
+    IVulkanDescriptorAllocatorBuilder& VulkanDescriptorAllocator::Builder::withPoolSize(VkDescriptorType type, uint32_t descriptorsPerSet) noexcept
+    {
+        VkDescriptorPoolSize poolSize{ };
+        poolSize.type = type;
+        poolSize.descriptorCount = descriptorsPerSet;
+        this->descriptorsPerSet.push_back(poolSize);
+        return *this;
+    }
+
+    IVulkanDescriptorAllocatorBuilder& VulkanDescriptorAllocator::Builder::withSetsPerPool(uint32_t setsPerPool) noexcept
+    {
+        this->setsPerPool = setsPerPool;
+        return *this;
+    }
+
+    IVulkanDescriptorAllocatorBuilder& VulkanDescriptorAllocator::Builder::withFlags(VkDescriptorPoolCreateFlags flags) noexcept
+    {
+        this->flags = flags;
+        return *this;
+    }
+
+    std::unique_ptr<IVulkanDescriptorAllocator> VulkanDescriptorAllocator::Builder::build() const
+    {
+        if (frameCount == 0 || setsPerPool == 0 || descriptorsPerSet.empty())
+        {
+            throw std::runtime_error("Failed to create descriptor allocator, frame count, sets per pool and pool sizes must be specified");
+        }
+
+        return std::make_unique<VulkanDescriptorAllocator>(frameCount, descriptorsPerSet, setsPerPool, flags, device);
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stdexcept>
+#include "systems/renderer/vulkan/vulkanComponents/vulkanDescriptorAllocator.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanDescriptorAllocatorBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan descriptor allocator builder
+     */
+    class VulkanDescriptorAllocator::Builder : public IVulkanDescriptorAllocatorBuilder
+    {
+    public:
+        /**
+         * @brief Specify the device the descriptor sets are allocated on
+         * 
+         * @param device The device the descriptor sets are allocated on
+         * @returns Reference to the builder
+         */
+        IVulkanDescriptorAllocatorBuilder& withDevice(IVulkanDevice const * device) noexcept override;
+
+        /**
+         * @brief Specify the number of frames in flight. Each frame allocates from its own pools
+         * 
+         * @param frameCount The number of frames in flight
+         * @returns Reference to the builder
+         */
+        IVulkanDescriptorAllocatorBuilder& withFrameCount(uint32_t frameCount) noexcept override;
+
+        /**
+         * @brief Specify the number of descriptors of a type required by a typical set of the layout class. Pool sizes are scaled from these counts
+         * 
+         * @param type The descriptor type
+         * @param descriptorsPerSet The number of descriptors of the type per set
+         * @returns Reference to the builder
+         */
+        IVulkanDescriptorAllocatorBuilder& withPoolSize(VkDescriptorType type, uint32_t descriptorsPerSet) noexcept override;
+
+        /**
+         * @brief Specify the number of sets in the first pool of each frame. Each further pool doubles in size
+         * 
+         * @param setsPerPool The number of sets in the first pool
+         * @returns Reference to the builder
+         */
+        IVulkanDescriptorAllocatorBuilder& withSetsPerPool(uint32_t setsPerPool) noexcept override;
+
+        /**
+         * @brief Specify the descriptor pool creation flags
+         * 
+         * @param flags The descriptor pool creation flags
+         * @returns Reference to the builder
+         */
+        IVulkanDescriptorAllocatorBuilder& withFlags(VkDescriptorPoolCreateFlags flags) noexcept override;
+
+        /**
+         * @brief Build the Vulkan descriptor allocator
+         * 
+         * @returns The final Vulkan descriptor allocator
+         */
+        std::unique_ptr<IVulkanDescriptorAllocator> build() const override;
+
+    private:
+        /**
+         * @brief The device the descriptor sets are allocated on
+         */
+        IVulkanDevice const * device{ nullptr };
+
+        /**
+         * @brief The number of frames in flight
+         */
+        uint32_t frameCount{ 2 };
+
+        /**
+         * @brief Descriptor counts per descriptor type required by a typical set of the layout class
+         */
+        std::vector<VkDescriptorPoolSize> descriptorsPerSet{ };
+
+        /**
+         * @brief The number of sets in the first pool of each frame
+         */
+        uint32_t setsPerPool{ 64 };
+
+        /**
+         * @brief The descriptor pool creation flags
+         */
+        VkDescriptorPoolCreateFlags flags{ 0 };
+    };
+}
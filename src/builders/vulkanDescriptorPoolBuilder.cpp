@@ -23,10 +23,17 @@ namespace siofraEngine::systems
         return *this;
     }
 
+    IVulkanDescriptorPoolBuilder& VulkanDescriptorPool::Builder::withFlags(VkDescriptorPoolCreateFlags flags) noexcept
+    {
+        this->flags = flags;
+        return *this;
+    }
+
     std::unique_ptr<IVulkanDescriptorPool> VulkanDescriptorPool::Builder::build() const
     {
         VkDescriptorPoolCreateInfo poolCreateInfo{ };
         poolCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolCreateInfo.flags = flags;
         poolCreateInfo.maxSets = maxSets;
         poolCreateInfo.pPoolSizes = poolSizes.data();
         poolCreateInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
@@ -37,6 +37,14 @@ namespace siofraEngine::systems
          */
         IVulkanDescriptorPoolBuilder& withMaxSets(uint32_t maxSets) noexcept override;
 
+        /**
+         * @brief Specify the descriptor pool creation flags
+         * 
+         * @param flags The descriptor pool creation flags
+         * @returns Reference to the builder
+         */
+        IVulkanDescriptorPoolBuilder& withFlags(VkDescriptorPoolCreateFlags flags) noexcept override;
+
         /**
          * @brief Build the Vulkan descriptor pool
          * 
@@ -59,5 +67,10 @@ namespace siofraEngine::systems
          * @brief The maximum number of descriptor sets that can be allocated from the pool
          */
         uint32_t maxSets{ 0 };
+
+        /**
+         * @brief The descriptor pool creation flags
+         */
+        VkDescriptorPoolCreateFlags flags{ 0 };
     };
 }
@@ -20,6 +20,44 @@ namespace siofraEngine::systems
         return *this;
     }
 
+    IVulkanDescriptorSetBuilder& VulkanDescriptorSet::Builder::withVariableDescriptorCount(uint32_t variableDescriptorCount) noexcept
+    {
+        this->variableDescriptorCount = variableDescriptorCount;
+        return *this;
+    }
+
+    std::vector<std::unique_ptr<IVulkanDescriptorSet>> VulkanDescriptorSet::Builder::build(uint32_t count) const
+    {
+        std::vector<VkDescriptorSetLayout> descriptorSetLayoutHandles(count, descriptorSetLayout->getDescriptorSetLayout());
+
+        VkDescriptorSetAllocateInfo setAllocInfo{ };
+        setAllocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        setAllocInfo.descriptorPool = descriptorPool->getDescriptorPool();
+        setAllocInfo.descriptorSetCount = count;
+        setAllocInfo.pSetLayouts = descriptorSetLayoutHandles.data();
+
+        std::vector<uint32_t> variableDescriptorCounts(count, variableDescriptorCount);
+        VkDescriptorSetVariableDescriptorCountAllocateInfo variableCountAllocInfo{ };
+        variableCountAllocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO;
+        variableCountAllocInfo.descriptorSetCount = count;
+        variableCountAllocInfo.pDescriptorCounts = variableDescriptorCounts.data();
+        setAllocInfo.pNext = variableDescriptorCount > 0 ? &variableCountAllocInfo : nullptr;
+
+        std::vector<VkDescriptorSet> descriptorSetHandles(count, VK_NULL_HANDLE);
+        if (vkAllocateDescriptorSets(device->getLogicalDevice(), &setAllocInfo, descriptorSetHandles.data()) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to allocate descriptor set(s)");
+        }
+
+        std::vector<std::unique_ptr<IVulkanDescriptorSet>> descriptorSets(count);
+        for(size_t i = 0; i < count; ++i)
+        {
+            descriptorSets[i] = std::make_unique<VulkanDescriptorSet>(descriptorSetHandles[i]);
+        }
+
+        return descriptorSets;
+    }
+
     std::unique_ptr<IVulkanDescriptorSet> VulkanDescriptorSet::Builder::build() const
     {
         VkDescriptorSetLayout descriptorSetLayoutHandle = descriptorSetLayout->getDescriptorSetLayout();
@@ -30,6 +68,12 @@ namespace siofraEngine::systems
         setAllocInfo.descriptorSetCount = 1;
         setAllocInfo.pSetLayouts = &descriptorSetLayoutHandle;
 
+        VkDescriptorSetVariableDescriptorCountAllocateInfo variableCountAllocInfo{ };
+        variableCountAllocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO;
+        variableCountAllocInfo.descriptorSetCount = 1;
+        variableCountAllocInfo.pDescriptorCounts = &variableDescriptorCount;
+        setAllocInfo.pNext = variableDescriptorCount > 0 ? &variableCountAllocInfo : nullptr;
+
         VkDescriptorSet descriptorSet{ VK_NULL_HANDLE };
         if (vkAllocateDescriptorSets(device->getLogicalDevice(), &setAllocInfo, &descriptorSet) != VK_SUCCESS)
         {
@@ -36,6 +36,22 @@ namespace siofraEngine::systems
          */
         IVulkanDescriptorSetBuilder& withDescriptorSetLayout(IVulkanDescriptorSetLayout const * descriptorSetLayout) noexcept override;
 
+        /**
+         * @brief Specify the number of descriptors in the layout's variable count binding
+         * 
+         * @param variableDescriptorCount The number of descriptors in the variable count binding
+         * @returns Reference to the builder
+         */
+        IVulkanDescriptorSetBuilder& withVariableDescriptorCount(uint32_t variableDescriptorCount) noexcept override;
+
+        /**
+         * @brief Build the Vulkan descriptor sets with a single allocation
+         * 
+         * @param count Number of descriptor sets to allocate
+         * @returns The final Vulkan descriptor sets
+         */
+        std::vector<std::unique_ptr<IVulkanDescriptorSet>> build(uint32_t count) const override;
+
         /**
          * @brief Build the Vulkan descriptor set
          * 
@@ -58,5 +74,10 @@ namespace siofraEngine::systems
          * @brief The descriptor set layout, specifying how the descriptor set is allocated
          */
         IVulkanDescriptorSetLayout const * descriptorSetLayout{ nullptr };
+
+        /**
+         * @brief The number of descriptors in the layout's variable count binding, or 0 if the layout has no variable count binding
+         */
+        uint32_t variableDescriptorCount{ 0 };
     };
 }
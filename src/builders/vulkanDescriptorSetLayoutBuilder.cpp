@@ -17,6 +17,20 @@ namespace siofraEngine::systems
         layoutBinding.stageFlags = stageFlags;
         layoutBinding.pImmutableSamplers = nullptr;
         layoutBindings.push_back(layoutBinding);
+        bindingFlags.push_back(0);
+        return *this;
+    }
+
+    IVulkanDescriptorSetLayoutBuilder& VulkanDescriptorSetLayout::Builder::withLayoutBinding(uint32_t binding, VkDescriptorType descriptorType, uint32_t descriptorCount, VkShaderStageFlags stageFlags, VkDescriptorBindingFlags bindingFlags) noexcept
+    {
+        withLayoutBinding(binding, descriptorType, descriptorCount, stageFlags);
+        this->bindingFlags.back() = bindingFlags;
+        return *this;
+    }
+
+    IVulkanDescriptorSetLayoutBuilder& VulkanDescriptorSetLayout::Builder::withFlags(VkDescriptorSetLayoutCreateFlags flags) noexcept
+    {
+        this->flags = flags;
         return *this;
     }
 
@@ -24,15 +38,58 @@ namespace siofraEngine::systems
     {
         VkDescriptorSetLayoutCreateInfo layoutCreateInfo{ };
         layoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        layoutCreateInfo.flags = flags;
         layoutCreateInfo.pBindings = layoutBindings.data();
         layoutCreateInfo.bindingCount = static_cast<uint32_t>(layoutBindings.size());
 
+        VkDescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsCreateInfo{ };
+        bindingFlagsCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+        bindingFlagsCreateInfo.pBindingFlags = bindingFlags.data();
+        bindingFlagsCreateInfo.bindingCount = static_cast<uint32_t>(bindingFlags.size());
+
+        uint32_t highestBinding{ 0 };
+        for (auto const & layoutBinding : layoutBindings)
+        {
+            highestBinding = std::max(highestBinding, layoutBinding.binding);
+        }
+
+        bool anyBindingFlags{ false };
+        for (size_t i = 0; i < bindingFlags.size(); ++i)
+        {
+            anyBindingFlags = anyBindingFlags || bindingFlags[i] != 0;
+            if ((bindingFlags[i] & VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT) != 0)
+            {
+                layoutCreateInfo.flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+            }
+            if ((bindingFlags[i] & VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT) != 0 && layoutBindings[i].binding != highestBinding)
+            {
+                throw std::runtime_error("Failed to create descriptor set layout, a variable descriptor count binding must be the highest numbered binding");
+            }
+        }
+        layoutCreateInfo.pNext = anyBindingFlags ? &bindingFlagsCreateInfo : nullptr;
+
         VkDescriptorSetLayout descriptorSetLayout{ VK_NULL_HANDLE };
         if (vkCreateDescriptorSetLayout(device->getLogicalDevice(), &layoutCreateInfo, nullptr, &descriptorSetLayout) != VK_SUCCESS)
         {
             throw std::runtime_error("Failed to create descriptor set layout");
         }
 
-        return std::make_unique<VulkanDescriptorSetLayout>(descriptorSetLayout, device);
+        std::string stateKey{ };
+        auto append = [&stateKey](auto const & value) {
+            stateKey.append(reinterpret_cast<char const *>(&value), sizeof(value));
+        };
+
+        append(layoutCreateInfo.flags);
+        append(layoutBindings.size());
+        for (size_t i = 0; i < layoutBindings.size(); ++i)
+        {
+            append(layoutBindings[i].binding);
+            append(layoutBindings[i].descriptorType);
+            append(layoutBindings[i].descriptorCount);
+            append(layoutBindings[i].stageFlags);
+            append(bindingFlags[i]);
+        }
+
+        return std::make_unique<VulkanDescriptorSetLayout>(descriptorSetLayout, std::move(stateKey), device);
     }
 }
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <stdexcept>
+#include <string>
 #include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanDescriptorSetLayoutBuilder.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/vulkanDescriptorSetLayout.hpp"
 
@@ -31,6 +33,28 @@ namespace siofraEngine::systems
          */
         IVulkanDescriptorSetLayoutBuilder& withLayoutBinding(uint32_t binding, VkDescriptorType descriptorType, uint32_t descriptorCount, VkShaderStageFlags stageFlags) noexcept override;
 
+        /**
+         * @brief Specify a descriptor set layout binding with binding flags. Update after bind bindings require a pool created with
+         * VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT, and a variable count binding must be the highest numbered binding
+         * 
+         * @param binding The binding number of this entry and corresponds to a resource of the same binding number in the shader stages
+         * @param descriptorType The type of resource descriptors are used for this binding
+         * @param descriptorCount The number of descriptors contained in the binding, or the upper bound for variable count bindings
+         * @param stageFlags The pipeline shader stages that can access a resource for this binding
+         * @param bindingFlags The descriptor binding flags
+         * @returns Reference to the builder
+         */
+        IVulkanDescriptorSetLayoutBuilder& withLayoutBinding(uint32_t binding, VkDescriptorType descriptorType, uint32_t descriptorCount, VkShaderStageFlags stageFlags, VkDescriptorBindingFlags bindingFlags) noexcept override;
+
+        /**
+         * @brief Specify the descriptor set layout creation flags, such as VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR for
+         * layouts whose descriptors are pushed with a command buffer
+         * 
+         * @param flags The descriptor set layout creation flags
+         * @returns Reference to the builder
+         */
+        IVulkanDescriptorSetLayoutBuilder& withFlags(VkDescriptorSetLayoutCreateFlags flags) noexcept override;
+
         /**
          * @brief Build the Vulkan descriptor set layout
          * 
@@ -48,5 +72,15 @@ namespace siofraEngine::systems
          * @brief The descriptor set layout bindings
          */
         std::vector<VkDescriptorSetLayoutBinding> layoutBindings{ };
+
+        /**
+         * @brief The descriptor binding flags of each layout binding
+         */
+        std::vector<VkDescriptorBindingFlags> bindingFlags{ };
+
+        /**
+         * @brief The descriptor set layout creation flags
+         */
+        VkDescriptorSetLayoutCreateFlags flags{ 0 };
     };
 }
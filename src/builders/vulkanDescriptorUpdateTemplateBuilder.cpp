@@ -0,0 +1,52 @@
+#include "systems/renderer/vulkan/vulkanComponents/builders/vulkanDescriptorUpdateTemplateBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    IVulkanDescriptorUpdateTemplateBuilder& VulkanDescriptorUpdateTemplate::Builder::withDevice(IVulkanDevice const * device) noexcept
+    {
+        this->device = device;
+        return *this;
+    }
+
+    IVulkanDescriptorUpdateTemplateBuilder& VulkanDescriptorUpdateTemplate::Builder::withDescriptorSetLayout(IVulkanDescriptorSetLayout const * descriptorSetLayout) noexcept
+    {
+        this->descriptorSetLayout = descriptorSetLayout;
+        return *this;
+    }
+
+    IVulkanDescriptorUpdateTemplateBuilder& VulkanDescriptorUpdateTemplate::Builder::withEntry(uint32_t binding, uint32_t arrayElement, uint32_t descriptorCount, VkDescriptorType descriptorType, size_t offset, size_t stride) noexcept
+    {
+        VkDescriptorUpdateTemplateEntry entry{ };
+        entry.dstBinding = binding;
+        entry.dstArrayElement = arrayElement;
+        entry.descriptorCount = descriptorCount;
+        entry.descriptorType = descriptorType;
+        entry.offset = offset;
+        entry.stride = stride;
+        entries.push_back(entry);
+        return *this;
+    }
+
+    std::unique_ptr<IVulkanDescriptorUpdateTemplate> VulkanDescriptorUpdateTemplate::Builder::build() const
+    {
+        if (entries.empty())
+        {
+            throw std::runtime_error("Failed to create descriptor update template, no entries specified");
+        }
+
+        VkDescriptorUpdateTemplateCreateInfo templateCreateInfo{ };
+        templateCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+        templateCreateInfo.descriptorUpdateEntryCount = static_cast<uint32_t>(entries.size());
+        templateCreateInfo.pDescriptorUpdateEntries = entries.data();
+        templateCreateInfo.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+        templateCreateInfo.descriptorSetLayout = descriptorSetLayout->getDescriptorSetLayout();
+
+        VkDescriptorUpdateTemplate descriptorUpdateTemplate{ VK_NULL_HANDLE };
+        if (vkCreateDescriptorUpdateTemplate(device->getLogicalDevice(), &templateCreateInfo, nullptr, &descriptorUpdateTemplate) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create descriptor update template");
+        }
+
+        return std::make_unique<VulkanDescriptorUpdateTemplate>(descriptorUpdateTemplate, device);
+    }
+}
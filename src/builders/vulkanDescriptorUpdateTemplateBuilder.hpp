@@ -0,0 +1,68 @@
+#pragma once
+
+#include <stdexcept>
+#include <vector>
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanDescriptorUpdateTemplateBuilder.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/vulkanDescriptorUpdateTemplate.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan descriptor update template builder
+     */
+    class VulkanDescriptorUpdateTemplate::Builder : public IVulkanDescriptorUpdateTemplateBuilder
+    {
+    public:
+        /**
+         * @brief Specify the device used to create the descriptor update template
+         * 
+         * @param device The device with which to create the descriptor update template
+         * @returns Reference to the builder
+         */
+        IVulkanDescriptorUpdateTemplateBuilder& withDevice(IVulkanDevice const * device) noexcept override;
+
+        /**
+         * @brief Specify the layout of the descriptor sets the template updates
+         * 
+         * @param descriptorSetLayout The descriptor set layout
+         * @returns Reference to the builder
+         */
+        IVulkanDescriptorUpdateTemplateBuilder& withDescriptorSetLayout(IVulkanDescriptorSetLayout const * descriptorSetLayout) noexcept override;
+
+        /**
+         * @brief Specify a range of descriptors updated from the packed update data
+         * 
+         * @param binding The descriptor binding within the set
+         * @param arrayElement The first array element within the binding
+         * @param descriptorCount The number of descriptors to update
+         * @param descriptorType The descriptor type of the binding
+         * @param offset Offset in bytes of the first descriptor info within the update data
+         * @param stride Distance in bytes between consecutive descriptor infos within the update data
+         * @returns Reference to the builder
+         */
+        IVulkanDescriptorUpdateTemplateBuilder& withEntry(uint32_t binding, uint32_t arrayElement, uint32_t descriptorCount, VkDescriptorType descriptorType, size_t offset, size_t stride) noexcept override;
+
+        /**
+         * @brief Build the Vulkan descriptor update template
+         * 
+         * @returns The final Vulkan descriptor update template
+         */
+        std::unique_ptr<IVulkanDescriptorUpdateTemplate> build() const override;
+
+    private:
+        /**
+         * @brief The device with which to create the descriptor update template
+         */
+        IVulkanDevice const * device{ nullptr };
+
+        /**
+         * @brief The layout of the descriptor sets the template updates
+         */
+        IVulkanDescriptorSetLayout const * descriptorSetLayout{ nullptr };
+
+        /**
+         * @brief The descriptor update template entries
+         */
+        std::vector<VkDescriptorUpdateTemplateEntry> entries{ };
+    };
+}
@@ -2,8 +2,9 @@
 
 namespace siofraEngine::systems
 {
-    VulkanDevice::Builder::Builder(IVulkanQueueBuilder& vulkanQueueBuilder) :
-        vulkanQueueBuilder{vulkanQueueBuilder}
+    VulkanDevice::Builder::Builder(IVulkanQueueBuilder& vulkanQueueBuilder, IVulkanMemoryAllocatorBuilder& vulkanMemoryAllocatorBuilder) :
+        vulkanQueueBuilder{vulkanQueueBuilder},
+        vulkanMemoryAllocatorBuilder{vulkanMemoryAllocatorBuilder}
     {
 
     }
@@ -21,6 +22,12 @@ namespace siofraEngine::systems
         return *this;
     }
 
+    IVulkanDeviceBuilder& VulkanDevice::Builder::withFeatureSupport(VulkanDeviceFeatures requiredFeatures) noexcept
+    {
+        this->requiredFeatures = this->requiredFeatures | requiredFeatures;
+        return *this;
+    }
+
     IVulkanDeviceBuilder& VulkanDevice::Builder::withExtensionSupport(std::vector<const char*> requiredExtensions) noexcept
     {
         this->requiredDeviceExtensions.insert(this->requiredDeviceExtensions.end(), requiredExtensions.begin(), requiredExtensions.end());
@@ -47,13 +54,20 @@ namespace siofraEngine::systems
 
     std::unique_ptr<IVulkanDevice> VulkanDevice::Builder::build() const
     {
-        VkPhysicalDevice physicalDevice = findPhysicalDevice(instance, surface, requiredQueueFamilies, requiredDeviceExtensions);
+        std::vector<const char*> deviceExtensions = requiredDeviceExtensions;
+        if ((requiredFeatures & VulkanDeviceFeatures::PUSH_DESCRIPTOR) == VulkanDeviceFeatures::PUSH_DESCRIPTOR)
+        {
+            deviceExtensions.push_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+        }
+
+        VkPhysicalDevice physicalDevice = findPhysicalDevice(instance, surface, requiredQueueFamilies, deviceExtensions, requiredFeatures);
         VulkanDevice::Builder::QueueFamilyIndicies queueFamilyIndicies = findDeviceQueueFamilyIndicies(physicalDevice, surface);
-        VkDevice logicalDevice = createLogicalDevice(physicalDevice, validationLayers, requiredDeviceExtensions, queueFamilyIndicies);
+        VkDevice logicalDevice = createLogicalDevice(physicalDevice, validationLayers, deviceExtensions, queueFamilyIndicies, requiredFeatures);
 
         vulkanQueueBuilder
             .withLogicalDevice(logicalDevice)
-            .withQueueIndex(0);
+            .withQueueIndex(0)
+            .withSynchronization2((requiredFeatures & VulkanDeviceFeatures::SYNCHRONIZATION_2) == VulkanDeviceFeatures::SYNCHRONIZATION_2);
 
         return std::make_unique<VulkanDevice>(
             physicalDevice,
@@ -61,10 +75,12 @@ namespace siofraEngine::systems
             vulkanQueueBuilder.withQueueFamilyIndex(queueFamilyIndicies.graphics).build(),
             vulkanQueueBuilder.withQueueFamilyIndex(queueFamilyIndicies.presentation).build(),
             vulkanQueueBuilder.withQueueFamilyIndex(queueFamilyIndicies.transfer).build(),
-            vulkanQueueBuilder.withQueueFamilyIndex(queueFamilyIndicies.compute).build());
+            vulkanQueueBuilder.withQueueFamilyIndex(queueFamilyIndicies.compute).build(),
+            vulkanMemoryAllocatorBuilder.withPhysicalDevice(physicalDevice).withLogicalDevice(logicalDevice).build(),
+            requiredFeatures);
     }
 
-    VkPhysicalDevice VulkanDevice::Builder::findPhysicalDevice(IVulkanInstance const *instance, IVulkanSurface const *surface, VulkanDeviceQueueFamilies const requiredQueueFamilies, std::vector<const char*> const requiredDeviceExtensions) const
+    VkPhysicalDevice VulkanDevice::Builder::findPhysicalDevice(IVulkanInstance const *instance, IVulkanSurface const *surface, VulkanDeviceQueueFamilies const requiredQueueFamilies, std::vector<const char*> const requiredDeviceExtensions, VulkanDeviceFeatures const requiredFeatures) const
     {
         uint32_t physicalDeviceCount{ 0 };
         vkEnumeratePhysicalDevices(instance->getInstance(), &physicalDeviceCount, nullptr);
@@ -77,6 +93,7 @@ namespace siofraEngine::systems
         {
             if(!findDeviceQueueFamilyIndicies(physicalDevice, surface).areValid(requiredQueueFamilies) ||
                 !checkPhysicalDeviceExtensionSupport(physicalDevice, requiredDeviceExtensions) ||
+                !checkPhysicalDeviceFeatureSupport(physicalDevice, requiredFeatures) ||
                 !checkPhysicalDeviceSwapchainSupport(physicalDevice, surface))
             {
                 continue;
@@ -93,7 +110,7 @@ namespace siofraEngine::systems
         return chosenPhysicalDevice;
     }
 
-    VkDevice VulkanDevice::Builder::createLogicalDevice(VkPhysicalDevice const physicalDevice, std::vector<const char*> const validationLayers, std::vector<const char*> requiredDeviceExtensions, QueueFamilyIndicies const queueFamilyIdicies) const
+    VkDevice VulkanDevice::Builder::createLogicalDevice(VkPhysicalDevice const physicalDevice, std::vector<const char*> const validationLayers, std::vector<const char*> requiredDeviceExtensions, QueueFamilyIndicies const queueFamilyIdicies, VulkanDeviceFeatures const requiredFeatures) const
     {
         std::vector<VkDeviceQueueCreateInfo> queueCreateInfos{ };
 
@@ -118,6 +135,42 @@ namespace siofraEngine::systems
         VkPhysicalDeviceFeatures deviceFeatures{ };
         deviceFeatures.samplerAnisotropy = VK_TRUE;
 
+        // Version feature structs are only chained when a feature needs them. Extension features such as push descriptors need none,
+        // and the structs are invalid on devices below their version
+        bool requiresVulkan12 = (requiredFeatures & VulkanDeviceFeatures::TIMELINE_SEMAPHORE) == VulkanDeviceFeatures::TIMELINE_SEMAPHORE ||
+            (requiredFeatures & VulkanDeviceFeatures::DESCRIPTOR_INDEXING) == VulkanDeviceFeatures::DESCRIPTOR_INDEXING;
+        bool requiresVulkan13 = (requiredFeatures & VulkanDeviceFeatures::SYNCHRONIZATION_2) == VulkanDeviceFeatures::SYNCHRONIZATION_2;
+        void * featureChain{ nullptr };
+
+        VkPhysicalDeviceVulkan13Features vulkan13Features{ };
+        vulkan13Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES;
+        vulkan13Features.synchronization2 = VK_TRUE;
+        if (requiresVulkan13)
+        {
+            featureChain = &vulkan13Features;
+        }
+
+        VkPhysicalDeviceVulkan12Features vulkan12Features{ };
+        vulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        vulkan12Features.pNext = featureChain;
+        vulkan12Features.timelineSemaphore = (requiredFeatures & VulkanDeviceFeatures::TIMELINE_SEMAPHORE) == VulkanDeviceFeatures::TIMELINE_SEMAPHORE;
+        if (requiresVulkan12)
+        {
+            featureChain = &vulkan12Features;
+        }
+
+        // Bindless descriptor arrays require update after bind, partially bound and variable count bindings
+        if ((requiredFeatures & VulkanDeviceFeatures::DESCRIPTOR_INDEXING) == VulkanDeviceFeatures::DESCRIPTOR_INDEXING)
+        {
+            vulkan12Features.descriptorIndexing = VK_TRUE;
+            vulkan12Features.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+            vulkan12Features.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+            vulkan12Features.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+            vulkan12Features.descriptorBindingPartiallyBound = VK_TRUE;
+            vulkan12Features.descriptorBindingVariableDescriptorCount = VK_TRUE;
+            vulkan12Features.runtimeDescriptorArray = VK_TRUE;
+        }
+
         VkDeviceCreateInfo deviceCreateInfo{ };
         deviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
         deviceCreateInfo.pQueueCreateInfos = queueCreateInfos.data();
@@ -125,6 +178,7 @@ namespace siofraEngine::systems
         deviceCreateInfo.enabledExtensionCount = static_cast<uint32_t>(requiredDeviceExtensions.size());
         deviceCreateInfo.ppEnabledExtensionNames = requiredDeviceExtensions.data();
         deviceCreateInfo.pEnabledFeatures = &deviceFeatures;
+        deviceCreateInfo.pNext = featureChain;
 
         if (validationLayers.size() > 0) {
             deviceCreateInfo.enabledLayerCount = static_cast<uint32_t>(validationLayers.size());
@@ -170,12 +224,16 @@ namespace siofraEngine::systems
                 queueFamilyIndicies.presentation = queuefamilyIndex;
             }
 
-            if (queuefamily.queueCount > 0 && queuefamily.queueFlags & VK_QUEUE_TRANSFER_BIT)
+            // Prefer a dedicated transfer family so uploads run alongside graphics work
+            bool dedicatedTransfer = !(queuefamily.queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT));
+            if (queuefamily.queueCount > 0 && queuefamily.queueFlags & VK_QUEUE_TRANSFER_BIT && (queueFamilyIndicies.transfer == -1 || dedicatedTransfer))
             {
                 queueFamilyIndicies.transfer = queuefamilyIndex;
             }
 
-            if (queuefamily.queueCount > 0 && queuefamily.queueFlags & VK_QUEUE_COMPUTE_BIT)
+            // Prefer a compute family without graphics support so compute work runs asynchronously to graphics
+            bool asyncCompute = !(queuefamily.queueFlags & VK_QUEUE_GRAPHICS_BIT);
+            if (queuefamily.queueCount > 0 && queuefamily.queueFlags & VK_QUEUE_COMPUTE_BIT && (queueFamilyIndicies.compute == -1 || asyncCompute))
             {
                 queueFamilyIndicies.compute = queuefamilyIndex;
             }
@@ -220,6 +278,75 @@ namespace siofraEngine::systems
         return true;
     }
 
+    bool VulkanDevice::Builder::checkPhysicalDeviceFeatureSupport(VkPhysicalDevice const physicalDevice, VulkanDeviceFeatures const requiredFeatures) const
+    {
+        if (requiredFeatures == VulkanDeviceFeatures::NONE)
+        {
+            return true;
+        }
+
+        // Vulkan 1.2 and 1.3 features may only be queried from devices supporting those versions
+        VkPhysicalDeviceProperties deviceProperties{ };
+        vkGetPhysicalDeviceProperties(physicalDevice, &deviceProperties);
+        bool requiresVulkan12 = (requiredFeatures & VulkanDeviceFeatures::TIMELINE_SEMAPHORE) == VulkanDeviceFeatures::TIMELINE_SEMAPHORE ||
+            (requiredFeatures & VulkanDeviceFeatures::DESCRIPTOR_INDEXING) == VulkanDeviceFeatures::DESCRIPTOR_INDEXING;
+        if (requiresVulkan12 && deviceProperties.apiVersion < VK_API_VERSION_1_2)
+        {
+            return false;
+        }
+
+        bool requiresVulkan13 = (requiredFeatures & VulkanDeviceFeatures::EXTENDED_DYNAMIC_STATE) == VulkanDeviceFeatures::EXTENDED_DYNAMIC_STATE ||
+            (requiredFeatures & VulkanDeviceFeatures::SYNCHRONIZATION_2) == VulkanDeviceFeatures::SYNCHRONIZATION_2;
+        if (requiresVulkan13 && deviceProperties.apiVersion < VK_API_VERSION_1_3)
+        {
+            return false;
+        }
+
+        // Extended dynamic state is core, and always supported, from Vulkan 1.3, so only synchronization2 needs the 1.3 features queried
+        bool queryVulkan13 = (requiredFeatures & VulkanDeviceFeatures::SYNCHRONIZATION_2) == VulkanDeviceFeatures::SYNCHRONIZATION_2;
+        if (!requiresVulkan12 && !queryVulkan13)
+        {
+            return true;
+        }
+
+        VkPhysicalDeviceVulkan13Features vulkan13Features{ };
+        vulkan13Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES;
+
+        VkPhysicalDeviceVulkan12Features vulkan12Features{ };
+        vulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        vulkan12Features.pNext = queryVulkan13 ? &vulkan13Features : nullptr;
+
+        VkPhysicalDeviceFeatures2 deviceFeatures{ };
+        deviceFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        deviceFeatures.pNext = &vulkan12Features;
+        vkGetPhysicalDeviceFeatures2(physicalDevice, &deviceFeatures);
+
+        if ((requiredFeatures & VulkanDeviceFeatures::TIMELINE_SEMAPHORE) == VulkanDeviceFeatures::TIMELINE_SEMAPHORE && !vulkan12Features.timelineSemaphore)
+        {
+            return false;
+        }
+
+        if ((requiredFeatures & VulkanDeviceFeatures::DESCRIPTOR_INDEXING) == VulkanDeviceFeatures::DESCRIPTOR_INDEXING &&
+            (!vulkan12Features.descriptorIndexing ||
+            !vulkan12Features.shaderSampledImageArrayNonUniformIndexing ||
+            !vulkan12Features.descriptorBindingSampledImageUpdateAfterBind ||
+            !vulkan12Features.descriptorBindingUpdateUnusedWhilePending ||
+            !vulkan12Features.descriptorBindingPartiallyBound ||
+            !vulkan12Features.descriptorBindingVariableDescriptorCount ||
+            !vulkan12Features.runtimeDescriptorArray))
+        {
+            return false;
+        }
+
+        // Extended dynamic state is core, and always supported, from Vulkan 1.3. Synchronization2 is core but optional
+        if ((requiredFeatures & VulkanDeviceFeatures::SYNCHRONIZATION_2) == VulkanDeviceFeatures::SYNCHRONIZATION_2 && !vulkan13Features.synchronization2)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
     bool VulkanDevice::Builder::checkPhysicalDeviceSwapchainSupport(VkPhysicalDevice const physicalDevice, IVulkanSurface const *surface) const
     {
         uint32_t formatCount{ 0 };
@@ -6,6 +6,7 @@
 #include "systems/renderer/vulkan/vulkanComponents/vulkanDevice.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanDeviceBuilder.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanQueueBuilder.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanMemoryAllocatorBuilder.hpp"
 
 namespace siofraEngine::systems
 {
@@ -19,8 +20,9 @@ namespace siofraEngine::systems
          * @brief Vulkan device builder constructor
          * 
          * @param vulkanQueueBuilder Vulkan queue builder
+         * @param vulkanMemoryAllocatorBuilder Vulkan memory allocator builder
          */
-        Builder(IVulkanQueueBuilder& vulkanQueueBuilder);
+        Builder(IVulkanQueueBuilder& vulkanQueueBuilder, IVulkanMemoryAllocatorBuilder& vulkanMemoryAllocatorBuilder);
         
         /**
          * @brief Specify minimum required Vulkan API version
@@ -39,6 +41,14 @@ namespace siofraEngine::systems
          */
         IVulkanDeviceBuilder& withQueueFamilySupport(VulkanDeviceQueueFamilies requiredQueueFamilies) noexcept override;
 
+        /**
+         * @brief Specify required optional device features
+         * 
+         * @param requiredFeatures Required optional device features
+         * @returns Reference to the builder
+         */
+        IVulkanDeviceBuilder& withFeatureSupport(VulkanDeviceFeatures requiredFeatures) noexcept override;
+
         /**
          * @brief Specify required extensions
          * 
@@ -84,6 +94,11 @@ namespace siofraEngine::systems
          */
         IVulkanQueueBuilder& vulkanQueueBuilder;
 
+        /**
+         * @brief Vulkan memory allocator builder
+         */
+        IVulkanMemoryAllocatorBuilder& vulkanMemoryAllocatorBuilder;
+
         /**
          * @brief Minimum Vulkan API major version number
          */
@@ -99,6 +114,11 @@ namespace siofraEngine::systems
          */
         VulkanDeviceQueueFamilies requiredQueueFamilies{ VulkanDeviceQueueFamilies::GRAPHICS | VulkanDeviceQueueFamilies::PRESENTATION };
 
+        /**
+         * @brief Required optional device features
+         */
+        VulkanDeviceFeatures requiredFeatures{ VulkanDeviceFeatures::NONE };
+
         /**
          * @brief Required extensions to support
          */
@@ -148,9 +168,10 @@ namespace siofraEngine::systems
          * @param surface The presentation surface
          * @param requiredQueueFamilies Required queue families
          * @param requiredDeviceExtensions Required extensions to support
+         * @param requiredFeatures Required optional device features
          * @returns A handle to the chosen physical device
          */
-        VkPhysicalDevice findPhysicalDevice(IVulkanInstance const *instance, IVulkanSurface const *surface, VulkanDeviceQueueFamilies const requiredQueueFamilies, std::vector<const char*> const requiredDeviceExtensions) const;
+        VkPhysicalDevice findPhysicalDevice(IVulkanInstance const *instance, IVulkanSurface const *surface, VulkanDeviceQueueFamilies const requiredQueueFamilies, std::vector<const char*> const requiredDeviceExtensions, VulkanDeviceFeatures const requiredFeatures) const;
 
         /**
          * @brief Create a logical device
@@ -159,9 +180,10 @@ namespace siofraEngine::systems
          * @param validationLayers Validation layers to enable
          * @param requiredDeviceExtensions Required device extensions
          * @param queueFamilyIdicies Queue family indicies
+         * @param requiredFeatures Optional device features to enable
          * @returns A handle to the create logical device
          */
-        VkDevice createLogicalDevice(VkPhysicalDevice const physicalDevice, std::vector<const char*> const validationLayers, std::vector<const char*> requiredDeviceExtensions, QueueFamilyIndicies const queueFamilyIdicies) const;
+        VkDevice createLogicalDevice(VkPhysicalDevice const physicalDevice, std::vector<const char*> const validationLayers, std::vector<const char*> requiredDeviceExtensions, QueueFamilyIndicies const queueFamilyIdicies, VulkanDeviceFeatures const requiredFeatures) const;
 
         /**
          * @brief Find a physical devices queue family indicies
@@ -182,6 +204,15 @@ namespace siofraEngine::systems
          */
         bool checkPhysicalDeviceExtensionSupport(VkPhysicalDevice const physicalDevice, std::vector<const char*> const requiredDeviceExtensions) const;
 
+        /**
+         * @brief Check if a physical device supports the required optional features
+         * 
+         * @param physicalDevice The physical device
+         * @param requiredFeatures Required optional device features
+         * @returns Whether or not the required features are supported
+         */
+        bool checkPhysicalDeviceFeatureSupport(VkPhysicalDevice const physicalDevice, VulkanDeviceFeatures const requiredFeatures) const;
+
         /**
          * @brief Check if a physical device has swapchain support
          * 
@@ -0,0 +1,48 @@
+#include "systems/renderer/vulkan/vulkanComponents/builders/vulkanFrameCommandAllocatorBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanFrameCommandAllocator::Builder::Builder(IVulkanCommandPoolSetBuilder& vulkanCommandPoolSetBuilder) :
+        vulkanCommandPoolSetBuilder{vulkanCommandPoolSetBuilder}
+    {
+
+    }
+
+    IVulkanFrameCommandAllocatorBuilder& VulkanFrameCommandAllocator::Builder::withDevice(IVulkanDevice const * device) noexcept
+    {
+        this->device = device;
+        return *this;
+    }
+
+    IVulkanFrameCommandAllocatorBuilder& VulkanFrameCommandAllocator::Builder::withQueueFamilyIndex(uint32_t queueFamilyIndex) noexcept
+    {
+        this->queueFamilyIndex = queueFamilyIndex;
+        return *this;
+    }
+
+    IVulkanFrameCommandAllocatorBuilder& VulkanFrameCommandAllocator::Builder::withFrameCount(uint32_t frameCount) noexcept
+    {
+        this->frameCount = frameCount;
+        return *this;
+    }
+
+    IVulkanFrameCommandAllocatorBuilder& VulkanFrameCommandAllocator::Builder::withThreadCount(uint32_t threadCount) noexcept
+    {
+        this->threadCount = threadCount;
+        return *this;
+    }
+
+    std::unique_ptr<IVulkanFrameCommandAllocator> VulkanFrameCommandAllocator::Builder::build() const
+    {
+        // Command buffers are only ever reset with their pool, so the pools need no per buffer reset flag
+        auto commandPoolSet = vulkanCommandPoolSetBuilder
+            .withDevice(device)
+            .withFlags(VK_COMMAND_POOL_CREATE_TRANSIENT_BIT)
+            .withQueueFamilyIndex(queueFamilyIndex)
+            .withFrameCount(frameCount)
+            .withThreadCount(threadCount)
+            .build();
+
+        return std::make_unique<VulkanFrameCommandAllocator>(std::move(commandPoolSet), device);
+    }
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "systems/renderer/vulkan/vulkanComponents/vulkanFrameCommandAllocator.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanFrameCommandAllocatorBuilder.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanCommandPoolSetBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan frame command allocator builder
+     */
+    class VulkanFrameCommandAllocator::Builder : public IVulkanFrameCommandAllocatorBuilder
+    {
+    public:
+        /**
+         * @brief Vulkan frame command allocator builder constructor
+         * 
+         * @param vulkanCommandPoolSetBuilder Vulkan command pool set builder
+         */
+        Builder(IVulkanCommandPoolSetBuilder& vulkanCommandPoolSetBuilder);
+
+        /**
+         * @brief Specify the device used to create the command pools and allocate command buffers
+         * 
+         * @param device The device with which to create the command pools and allocate command buffers
+         * @returns Reference to the builder
+         */
+        IVulkanFrameCommandAllocatorBuilder& withDevice(IVulkanDevice const * device) noexcept override;
+
+        /**
+         * @brief Specify the queue family the command buffers are submitted to
+         * 
+         * @param queueFamilyIndex The command pool queue family index
+         * @returns Reference to the builder
+         */
+        IVulkanFrameCommandAllocatorBuilder& withQueueFamilyIndex(uint32_t queueFamilyIndex) noexcept override;
+
+        /**
+         * @brief Specify the number of frames in flight
+         * 
+         * @param frameCount The number of frames in flight
+         * @returns Reference to the builder
+         */
+        IVulkanFrameCommandAllocatorBuilder& withFrameCount(uint32_t frameCount) noexcept override;
+
+        /**
+         * @brief Specify the number of recording threads
+         * 
+         * @param threadCount The number of recording threads
+         * @returns Reference to the builder
+         */
+        IVulkanFrameCommandAllocatorBuilder& withThreadCount(uint32_t threadCount) noexcept override;
+
+        /**
+         * @brief Build the Vulkan frame command allocator
+         * 
+         * @returns The final Vulkan frame command allocator
+         */
+        std::unique_ptr<IVulkanFrameCommandAllocator> build() const override;
+
+    private:
+        /**
+         * @brief Vulkan command pool set builder
+         */
+        IVulkanCommandPoolSetBuilder& vulkanCommandPoolSetBuilder;
+
+        /**
+         * @brief The device with which to create the command pools and allocate command buffers
+         */
+        IVulkanDevice const * device{ nullptr };
+
+        /**
+         * @brief The command pool queue family index
+         */
+        uint32_t queueFamilyIndex{ 0 };
+
+        /**
+         * @brief The number of frames in flight
+         */
+        uint32_t frameCount{ 2 };
+
+        /**
+         * @brief The number of recording threads
+         */
+        uint32_t threadCount{ 1 };
+    };
+}
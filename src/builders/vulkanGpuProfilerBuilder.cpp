@@ -0,0 +1,69 @@
+#include "systems/renderer/vulkan/vulkanComponents/builders/vulkanGpuProfilerBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanGpuProfiler::Builder::Builder(IVulkanQueryPoolBuilder& vulkanQueryPoolBuilder) :
+        vulkanQueryPoolBuilder{vulkanQueryPoolBuilder}
+    {
+
+    }
+
+    IVulkanGpuProfilerBuilder& VulkanGpuProfiler::Builder::withDevice(IVulkanDevice const * device) noexcept
+    {
+        this->device = device;
+        return *this;
+    }
+
+    IVulkanGpuProfilerBuilder& VulkanGpuProfiler::Builder::withFrameCount(uint32_t frameCount) noexcept
+    {
+        this->frameCount = frameCount;
+        return *this;
+    }
+
+    IVulkanGpuProfilerBuilder& VulkanGpuProfiler::Builder::withMaxScopes(uint32_t maxScopes) noexcept
+    {
+        this->maxScopes = maxScopes;
+        return *this;
+    }
+
+    IVulkanGpuProfilerBuilder& VulkanGpuProfiler::Builder::withSampleCount(uint32_t sampleCount) noexcept
+    {
+        this->sampleCount = sampleCount;
+        return *this;
+    }
+
+    std::unique_ptr<IVulkanGpuProfiler> VulkanGpuProfiler::Builder::build() const
+    {
+        if (frameCount == 0 || maxScopes == 0 || sampleCount == 0)
+        {
+            throw std::runtime_error("Failed to create GPU profiler, frame count, scope count and sample count must be non-zero");
+        }
+
+        uint32_t queueFamilyCount{ 0 };
+        vkGetPhysicalDeviceQueueFamilyProperties(device->getPhysicalDevice(), &queueFamilyCount, nullptr);
+        std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+        vkGetPhysicalDeviceQueueFamilyProperties(device->getPhysicalDevice(), &queueFamilyCount, queueFamilies.data());
+
+        uint32_t timestampValidBits = queueFamilies[device->getGraphicsQueue()->getFamilyIndex()].timestampValidBits;
+        if (timestampValidBits == 0)
+        {
+            throw std::runtime_error("Failed to create GPU profiler, the graphics queue does not support timestamps");
+        }
+        uint64_t timestampMask = timestampValidBits >= 64 ? ~0ull : (1ull << timestampValidBits) - 1;
+
+        VkPhysicalDeviceProperties physicalDeviceProperties{ };
+        vkGetPhysicalDeviceProperties(device->getPhysicalDevice(), &physicalDeviceProperties);
+
+        std::vector<std::unique_ptr<IVulkanQueryPool>> queryPools(frameCount);
+        for (uint32_t i = 0; i < frameCount; i++)
+        {
+            queryPools[i] = vulkanQueryPoolBuilder
+                .withDevice(device)
+                .withQueryType(VK_QUERY_TYPE_TIMESTAMP)
+                .withQueryCount(maxScopes * 2)
+                .build();
+        }
+
+        return std::make_unique<VulkanGpuProfiler>(std::move(queryPools), sampleCount, static_cast<double>(physicalDeviceProperties.limits.timestampPeriod), timestampMask);
+    }
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <stdexcept>
+#include "systems/renderer/vulkan/vulkanComponents/vulkanGpuProfiler.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanGpuProfilerBuilder.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanQueryPoolBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan GPU profiler builder
+     */
+    class VulkanGpuProfiler::Builder : public IVulkanGpuProfilerBuilder
+    {
+    public:
+        /**
+         * @brief Vulkan GPU profiler builder constructor
+         * 
+         * @param vulkanQueryPoolBuilder Vulkan query pool builder
+         */
+        Builder(IVulkanQueryPoolBuilder& vulkanQueryPoolBuilder);
+
+        /**
+         * @brief Specify the device to profile. Scopes are recorded on the graphics queue
+         * 
+         * @param device The device to profile
+         * @returns Reference to the builder
+         */
+        IVulkanGpuProfilerBuilder& withDevice(IVulkanDevice const * device) noexcept override;
+
+        /**
+         * @brief Specify the number of frames in flight. Results are read back once a frame is reused
+         * 
+         * @param frameCount The number of frames in flight
+         * @returns Reference to the builder
+         */
+        IVulkanGpuProfilerBuilder& withFrameCount(uint32_t frameCount) noexcept override;
+
+        /**
+         * @brief Specify the maximum number of scopes recorded per frame
+         * 
+         * @param maxScopes The maximum number of scopes
+         * @returns Reference to the builder
+         */
+        IVulkanGpuProfilerBuilder& withMaxScopes(uint32_t maxScopes) noexcept override;
+
+        /**
+         * @brief Specify the number of recent durations each scope's statistics are calculated from
+         * 
+         * @param sampleCount The number of durations
+         * @returns Reference to the builder
+         */
+        IVulkanGpuProfilerBuilder& withSampleCount(uint32_t sampleCount) noexcept override;
+
+        /**
+         * @brief Build the Vulkan GPU profiler
+         * 
+         * @returns The final Vulkan GPU profiler
+         */
+        std::unique_ptr<IVulkanGpuProfiler> build() const override;
+
+    private:
+        /**
+         * @brief Vulkan query pool builder
+         */
+        IVulkanQueryPoolBuilder& vulkanQueryPoolBuilder;
+
+        /**
+         * @brief The device to profile
+         */
+        IVulkanDevice const * device{ nullptr };
+
+        /**
+         * @brief The number of frames in flight
+         */
+        uint32_t frameCount{ 2 };
+
+        /**
+         * @brief The maximum number of scopes recorded per frame
+         */
+        uint32_t maxScopes{ 32 };
+
+        /**
+         * @brief The number of recent durations each scope's statistics are calculated from
+         */
+        uint32_t sampleCount{ 64 };
+    };
+}
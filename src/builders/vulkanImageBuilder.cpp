@@ -55,7 +55,7 @@ namespace siofraEngine::systems
     {
         VkImage image{ VK_NULL_HANDLE };
         VkImageView imageView{ VK_NULL_HANDLE };
-        VkDeviceMemory imageMemory{ VK_NULL_HANDLE };
+        VulkanMemoryAllocation imageMemory{ };
         bool managedImage{ false };
 
         if (existingImage != VK_NULL_HANDLE)
@@ -70,8 +70,20 @@ namespace siofraEngine::systems
                 throw std::runtime_error("Failed to create an image");
             }
 
-            if (!allocateImageMemory(device, image, memoryPropertyFlags, imageMemory))
+            bool allocated{ false };
+            try
             {
+                allocated = allocateImageMemory(device, image, tiling, memoryPropertyFlags, imageMemory);
+            }
+            catch (...)
+            {
+                vkDestroyImage(device->getLogicalDevice(), image, nullptr);
+                throw;
+            }
+
+            if (!allocated)
+            {
+                vkDestroyImage(device->getLogicalDevice(), image, nullptr);
                 throw std::runtime_error("Failed to allocate image memory");
             }
         }
@@ -124,33 +136,21 @@ namespace siofraEngine::systems
         return vkCreateImageView(device->getLogicalDevice(), &viewCreateInfo, nullptr, &imageView) == VK_SUCCESS;
     }
 
-    bool VulkanImage::Builder::allocateImageMemory(IVulkanDevice const * device, VkImage image, VkMemoryPropertyFlags memoryPropertyFlags, VkDeviceMemory& imageMemory) const
+    bool VulkanImage::Builder::allocateImageMemory(IVulkanDevice const * device, VkImage image, VkImageTiling tiling, VkMemoryPropertyFlags memoryPropertyFlags, VulkanMemoryAllocation& imageMemory) const
     {
         VkMemoryRequirements memoryRequirements{ };
         vkGetImageMemoryRequirements(device->getLogicalDevice(), image, &memoryRequirements);
 
-        VkMemoryAllocateInfo memoryAllocInfo{ };
-        memoryAllocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        memoryAllocInfo.allocationSize = memoryRequirements.size;
-        memoryAllocInfo.memoryTypeIndex = findMemoryTypeIndex(device, memoryRequirements.memoryTypeBits, memoryPropertyFlags);
+        imageMemory = device->getMemoryAllocator()->allocate(memoryRequirements, memoryPropertyFlags, tiling == VK_IMAGE_TILING_LINEAR);
 
-        return vkAllocateMemory(device->getLogicalDevice(), &memoryAllocInfo, nullptr, &imageMemory) == VK_SUCCESS &&
-            vkBindImageMemory(device->getLogicalDevice(), image, imageMemory, 0) == VK_SUCCESS;
-    }
-
-    uint32_t VulkanImage::Builder::findMemoryTypeIndex(IVulkanDevice const * device, uint32_t allowedTypes, VkMemoryPropertyFlags properties) const
-    {
-        VkPhysicalDeviceMemoryProperties memoryProperties{ };
-        vkGetPhysicalDeviceMemoryProperties(device->getPhysicalDevice(), &memoryProperties);
-
-        for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++)
+        if (vkBindImageMemory(device->getLogicalDevice(), image, imageMemory.memory, imageMemory.offset) != VK_SUCCESS)
         {
-            if ((allowedTypes & (1 << i)) && (memoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
-            {
-                return i;
-            }
+            // Return the sub-allocation to its block, as no image will own it
+            device->getMemoryAllocator()->free(imageMemory);
+            imageMemory = { };
+            return false;
         }
 
-        throw std::runtime_error("Failed to find image memory type index");
+        return true;
     }
 }
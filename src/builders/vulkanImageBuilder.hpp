@@ -166,20 +166,11 @@ namespace siofraEngine::systems
          * 
          * @param device The device with which to allocate the image memory
          * @param image The image for which to allocate memory
+         * @param tiling The image tiling
          * @param memoryPropertyFlags The image memory property flags
-         * @param imageMemory The image memory handle to be populated
-         * @returns True if the image memory was allocated, otherwise false
-         */
-        bool allocateImageMemory(IVulkanDevice const * device, VkImage image, VkMemoryPropertyFlags memoryPropertyFlags, VkDeviceMemory& imageMemory) const;
-
-        /**
-         * @brief Find the index of the required memory type, within the physical device memory properties, which satisfies the image memory requirements and the desired memory types
-         * 
-         * @param device The device to search for the required memory type index
-         * @param allowedTypes The allowed image memory types
-         * @param properties The desired memory types
-         * @returns The memory type index
+         * @param imageMemory The image memory allocation to be populated
+         * @returns True if the image memory was allocated and bound, otherwise false, in which case no memory remains allocated
          */
-        uint32_t findMemoryTypeIndex(IVulkanDevice const * device, uint32_t allowedTypes, VkMemoryPropertyFlags properties) const;
+        bool allocateImageMemory(IVulkanDevice const * device, VkImage image, VkImageTiling tiling, VkMemoryPropertyFlags memoryPropertyFlags, VulkanMemoryAllocation& imageMemory) const;
     };
 }
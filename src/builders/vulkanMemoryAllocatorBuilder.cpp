@@ -0,0 +1,27 @@
+#include "systems/renderer/vulkan/vulkanComponents/builders/vulkanMemoryAllocatorBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    IVulkanMemoryAllocatorBuilder& VulkanMemoryAllocator::Builder::withPhysicalDevice(VkPhysicalDevice physicalDevice) noexcept
+    {
+        this->physicalDevice = physicalDevice;
+        return *this;
+    }
+
+    IVulkanMemoryAllocatorBuilder& VulkanMemoryAllocator::Builder::withLogicalDevice(VkDevice logicalDevice) noexcept
+    {
+        this->logicalDevice = logicalDevice;
+        return *this;
+    }
+
+    IVulkanMemoryAllocatorBuilder& VulkanMemoryAllocator::Builder::withBlockSize(VkDeviceSize blockSize) noexcept
+    {
+        this->blockSize = blockSize;
+        return *this;
+    }
+
+    std::unique_ptr<IVulkanMemoryAllocator> VulkanMemoryAllocator::Builder::build() const
+    {
+        return std::make_unique<VulkanMemoryAllocator>(physicalDevice, logicalDevice, blockSize);
+    }
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "systems/renderer/vulkan/vulkanComponents/vulkanMemoryAllocator.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanMemoryAllocatorBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan memory allocator builder
+     */
+    class VulkanMemoryAllocator::Builder : public IVulkanMemoryAllocatorBuilder
+    {
+    public:
+        /**
+         * @brief Vulkan memory allocator builder constructor
+         */
+        Builder() = default;
+
+        /**
+         * @brief Specify the physical device from which memory is allocated
+         * 
+         * @param physicalDevice The physical device from which memory is allocated
+         * @returns Reference to the builder
+         */
+        IVulkanMemoryAllocatorBuilder& withPhysicalDevice(VkPhysicalDevice physicalDevice) noexcept override;
+
+        /**
+         * @brief Specify the logical device with which memory is allocated
+         * 
+         * @param logicalDevice The logical device with which memory is allocated
+         * @returns Reference to the builder
+         */
+        IVulkanMemoryAllocatorBuilder& withLogicalDevice(VkDevice logicalDevice) noexcept override;
+
+        /**
+         * @brief Specify the preferred size of the device memory blocks which are sub-allocated
+         * 
+         * @param blockSize The preferred block size in bytes
+         * @returns Reference to the builder
+         */
+        IVulkanMemoryAllocatorBuilder& withBlockSize(VkDeviceSize blockSize) noexcept override;
+
+        /**
+         * @brief Build the Vulkan memory allocator
+         * 
+         * @returns The final Vulkan memory allocator
+         */
+        std::unique_ptr<IVulkanMemoryAllocator> build() const override;
+
+    private:
+        /**
+         * @brief The physical device from which memory is allocated
+         */
+        VkPhysicalDevice physicalDevice{ VK_NULL_HANDLE };
+
+        /**
+         * @brief The logical device with which memory is allocated
+         */
+        VkDevice logicalDevice{ VK_NULL_HANDLE };
+
+        /**
+         * @brief The preferred block size in bytes
+         */
+        VkDeviceSize blockSize{ 64 * 1024 * 1024 };
+    };
+}
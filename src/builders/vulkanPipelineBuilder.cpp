@@ -20,6 +20,18 @@ namespace siofraEngine::systems
         return *this;
     }
 
+    IVulkanPipelineBuilder& VulkanPipeline::Builder::withPipelineCache(IVulkanPipelineCache const * pipelineCache) noexcept
+    {
+        this->pipelineCache = pipelineCache;
+        return *this;
+    }
+
+    IVulkanPipelineBuilder& VulkanPipeline::Builder::withPipelineLayoutCache(IVulkanPipelineLayoutCache * pipelineLayoutCache) noexcept
+    {
+        this->pipelineLayoutCache = pipelineLayoutCache;
+        return *this;
+    }
+
     IVulkanPipelineBuilder& VulkanPipeline::Builder::withDescriptorSetLayouts(std::vector<IVulkanDescriptorSetLayout const *> descriptorSetLayouts) noexcept 
     {
         this->descriptorSetLayouts = descriptorSetLayouts;
@@ -69,21 +81,269 @@ namespace siofraEngine::systems
         return *this;
     }
 
+    IVulkanPipelineBuilder& VulkanPipeline::Builder::withVertexStage(std::unique_ptr<IVulkanShaderModule> shaderModule, std::string entryPoint, VulkanSpecializationConstants specializationConstants) noexcept
+    {
+        this->vertexShaderModule = std::move(shaderModule);
+        this->vertexEntryPoint = std::move(entryPoint);
+        this->vertexSpecializationConstants = std::move(specializationConstants);
+        return *this;
+    }
+
+    IVulkanPipelineBuilder& VulkanPipeline::Builder::withFragmentStage(std::unique_ptr<IVulkanShaderModule> shaderModule, std::string entryPoint, VulkanSpecializationConstants specializationConstants) noexcept
+    {
+        this->fragmentShaderModule = std::move(shaderModule);
+        this->fragmentEntryPoint = std::move(entryPoint);
+        this->fragmentSpecializationConstants = std::move(specializationConstants);
+        return *this;
+    }
+
+    IVulkanPipelineBuilder& VulkanPipeline::Builder::withDynamicState(VkDynamicState dynamicState) noexcept
+    {
+        if (std::find(dynamicStates.begin(), dynamicStates.end(), dynamicState) == dynamicStates.end())
+        {
+            dynamicStates.push_back(dynamicState);
+        }
+        return *this;
+    }
+
+    IVulkanPipelineBuilder& VulkanPipeline::Builder::withTopology(VkPrimitiveTopology topology) noexcept
+    {
+        this->topology = topology;
+        return *this;
+    }
+
+    IVulkanPipelineBuilder& VulkanPipeline::Builder::withCullMode(VkCullModeFlags cullMode) noexcept
+    {
+        this->cullMode = cullMode;
+        return *this;
+    }
+
+    IVulkanPipelineBuilder& VulkanPipeline::Builder::withFrontFace(VkFrontFace frontFace) noexcept
+    {
+        this->frontFace = frontFace;
+        return *this;
+    }
+
+    IVulkanPipelineBuilder& VulkanPipeline::Builder::withDepthTest(bool depthTestEnable, bool depthWriteEnable, VkCompareOp depthCompareOp) noexcept
+    {
+        this->depthTestEnable = depthTestEnable;
+        this->depthWriteEnable = depthWriteEnable;
+        this->depthCompareOp = depthCompareOp;
+        return *this;
+    }
+
+    std::string VulkanPipeline::Builder::getStateKey() const
+    {
+        std::string stateKey{ "graphics" };
+        auto append = [&stateKey](auto const & value) {
+            stateKey.append(reinterpret_cast<char const *>(&value), sizeof(value));
+        };
+
+        auto appendKey = [&stateKey](std::string const & key) {
+            size_t keySize = key.size();
+            stateKey.append(reinterpret_cast<char const *>(&keySize), sizeof(keySize));
+            stateKey.append(key);
+        };
+
+        auto isDynamic = [this](VkDynamicState dynamicState) {
+            return std::find(dynamicStates.begin(), dynamicStates.end(), dynamicState) != dynamicStates.end();
+        };
+
+        // Objects are identified by their contents rather than handles, which may be reused once the objects are destroyed
+        append(device->getLogicalDevice());
+        appendKey(renderPass->getStateKey());
+
+        // Static values replaced by dynamic state are left out, so pipelines differing only in them, such as across a resize, share a key
+        bool dynamicViewport = isDynamic(VK_DYNAMIC_STATE_VIEWPORT) || isDynamic(VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT);
+        bool dynamicScissor = isDynamic(VK_DYNAMIC_STATE_SCISSOR) || isDynamic(VK_DYNAMIC_STATE_SCISSOR_WITH_COUNT);
+        if (!dynamicViewport || !dynamicScissor)
+        {
+            append(viewportExtents.width);
+            append(viewportExtents.height);
+        }
+
+        append(vertexInputBindingDescriptions.size());
+        for (auto const & bindingDescription : vertexInputBindingDescriptions)
+        {
+            append(bindingDescription.binding);
+            append(bindingDescription.stride);
+            append(bindingDescription.inputRate);
+        }
+
+        append(vertexInputAttributeDescriptions.size());
+        for (auto const & attributeDescription : vertexInputAttributeDescriptions)
+        {
+            append(attributeDescription.binding);
+            append(attributeDescription.location);
+            append(attributeDescription.format);
+            append(attributeDescription.offset);
+        }
+
+        append(pushConstantRanges.size());
+        for (auto const & pushConstantRange : pushConstantRanges)
+        {
+            append(pushConstantRange.stageFlags);
+            append(pushConstantRange.offset);
+            append(pushConstantRange.size);
+        }
+
+        append(descriptorSetLayouts.size());
+        for (auto const & descriptorSetLayout : descriptorSetLayouts)
+        {
+            appendKey(descriptorSetLayout->getStateKey());
+        }
+
+        // Dynamic states are sorted so the order they were added in does not split the cache
+        std::vector<VkDynamicState> sortedDynamicStates{ dynamicStates };
+        std::sort(sortedDynamicStates.begin(), sortedDynamicStates.end());
+        append(sortedDynamicStates.size());
+        for (auto const & dynamicState : sortedDynamicStates)
+        {
+            append(dynamicState);
+        }
+
+        // A dynamic topology must stay within the topology class of the static one, so only the class is keyed
+        append(isDynamic(VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY) ? getTopologyClass(topology) : static_cast<uint32_t>(topology));
+        if (!isDynamic(VK_DYNAMIC_STATE_CULL_MODE))
+        {
+            append(cullMode);
+        }
+        if (!isDynamic(VK_DYNAMIC_STATE_FRONT_FACE))
+        {
+            append(frontFace);
+        }
+        if (!isDynamic(VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE))
+        {
+            append(depthTestEnable);
+        }
+        if (!isDynamic(VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE))
+        {
+            append(depthWriteEnable);
+        }
+        if (!isDynamic(VK_DYNAMIC_STATE_DEPTH_COMPARE_OP))
+        {
+            append(depthCompareOp);
+        }
+
+        // Entry point names are null terminated so adjacent fields cannot run together
+        appendKey(vertexShaderModule ? vertexShaderModule->getStateKey() : std::string{ });
+        stateKey.append(vertexEntryPoint.c_str(), vertexEntryPoint.size() + 1);
+        vertexSpecializationConstants.appendStateKey(stateKey);
+
+        appendKey(fragmentShaderModule ? fragmentShaderModule->getStateKey() : std::string{ });
+        stateKey.append(fragmentEntryPoint.c_str(), fragmentEntryPoint.size() + 1);
+        fragmentSpecializationConstants.appendStateKey(stateKey);
+
+        return stateKey;
+    }
+
     std::unique_ptr<IVulkanPipeline> VulkanPipeline::Builder::build() const
     {
-        VkPipelineVertexInputStateCreateInfo vertexInputCreateInfo{ };
+        std::unique_ptr<CreateState> createState = prepare();
+
+        VkPipelineCache pipelineCacheHandle = pipelineCache ? pipelineCache->getPipelineCache() : VK_NULL_HANDLE;
+
+        VkPipeline pipeline{ VK_NULL_HANDLE };
+        if (vkCreateGraphicsPipelines(device->getLogicalDevice(), pipelineCacheHandle, 1, &createState->pipelineCreateInfo, nullptr, &pipeline) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create pipeline");
+        }
+
+        return std::make_unique<VulkanPipeline>(pipeline, createState->pipelineLayout, device);
+    }
+
+    std::vector<std::unique_ptr<IVulkanPipeline>> VulkanPipeline::Builder::buildBatch(std::vector<Builder const *> const & pipelineBuilders)
+    {
+        if (pipelineBuilders.empty())
+        {
+            return { };
+        }
+
+        IVulkanDevice const * device = pipelineBuilders.front()->device;
+        IVulkanPipelineCache const * pipelineCache = pipelineBuilders.front()->pipelineCache;
+        for (auto const & pipelineBuilder : pipelineBuilders)
+        {
+            if (pipelineBuilder->device != device || pipelineBuilder->pipelineCache != pipelineCache)
+            {
+                throw std::runtime_error("Failed to create pipelines, batched pipelines must share a device and pipeline cache");
+            }
+        }
+
+        std::vector<std::unique_ptr<CreateState>> createStates{ };
+        std::vector<VkGraphicsPipelineCreateInfo> pipelineCreateInfos{ };
+        for (auto const & pipelineBuilder : pipelineBuilders)
+        {
+            createStates.push_back(pipelineBuilder->prepare());
+            pipelineCreateInfos.push_back(createStates.back()->pipelineCreateInfo);
+        }
+
+        VkPipelineCache pipelineCacheHandle = pipelineCache ? pipelineCache->getPipelineCache() : VK_NULL_HANDLE;
+
+        std::vector<VkPipeline> pipelines(pipelineCreateInfos.size(), VK_NULL_HANDLE);
+        if (vkCreateGraphicsPipelines(device->getLogicalDevice(), pipelineCacheHandle, static_cast<uint32_t>(pipelineCreateInfos.size()), pipelineCreateInfos.data(), nullptr, pipelines.data()) != VK_SUCCESS)
+        {
+            // Pipelines which did compile are returned as valid handles and must be released too
+            for (size_t i = 0; i < pipelines.size(); ++i)
+            {
+                vkDestroyPipeline(device->getLogicalDevice(), pipelines[i], nullptr);
+            }
+            throw std::runtime_error("Failed to create pipelines");
+        }
+
+        std::vector<std::unique_ptr<IVulkanPipeline>> builtPipelines{ };
+        for (size_t i = 0; i < pipelines.size(); ++i)
+        {
+            builtPipelines.push_back(std::make_unique<VulkanPipeline>(pipelines[i], createStates[i]->pipelineLayout, device));
+        }
+
+        return builtPipelines;
+    }
+
+    uint32_t VulkanPipeline::Builder::getTopologyClass(VkPrimitiveTopology topology) noexcept
+    {
+        switch (topology)
+        {
+        case VK_PRIMITIVE_TOPOLOGY_POINT_LIST:
+            return 0;
+        case VK_PRIMITIVE_TOPOLOGY_LINE_LIST:
+        case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP:
+        case VK_PRIMITIVE_TOPOLOGY_LINE_LIST_WITH_ADJACENCY:
+        case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP_WITH_ADJACENCY:
+            return 1;
+        case VK_PRIMITIVE_TOPOLOGY_PATCH_LIST:
+            return 3;
+        default:
+            return 2;
+        }
+    }
+
+    std::unique_ptr<VulkanPipeline::Builder::CreateState> VulkanPipeline::Builder::prepare() const
+    {
+        for (auto const & dynamicState : dynamicStates)
+        {
+            // Only the states added by VK_EXT_extended_dynamic_state, core in Vulkan 1.3, need the feature. Core 1.0 states are always available
+            bool extendedDynamicState = dynamicState >= VK_DYNAMIC_STATE_CULL_MODE && dynamicState <= VK_DYNAMIC_STATE_STENCIL_OP;
+            if (extendedDynamicState && !device->isFeatureEnabled(VulkanDeviceFeatures::EXTENDED_DYNAMIC_STATE))
+            {
+                throw std::runtime_error("Failed to create pipeline, extended dynamic state is not enabled on the device");
+            }
+        }
+
+        auto createState = std::make_unique<CreateState>();
+
+        VkPipelineVertexInputStateCreateInfo & vertexInputCreateInfo = createState->vertexInputCreateInfo;
         vertexInputCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
         vertexInputCreateInfo.pVertexBindingDescriptions = vertexInputBindingDescriptions.data();
         vertexInputCreateInfo.vertexBindingDescriptionCount = static_cast<uint32_t>(vertexInputBindingDescriptions.size());
         vertexInputCreateInfo.pVertexAttributeDescriptions = vertexInputAttributeDescriptions.data();
         vertexInputCreateInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(vertexInputAttributeDescriptions.size());
 
-        VkPipelineInputAssemblyStateCreateInfo inputAssemblyStateCreateInfo{ };
+        VkPipelineInputAssemblyStateCreateInfo & inputAssemblyStateCreateInfo = createState->inputAssemblyStateCreateInfo;
         inputAssemblyStateCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-        inputAssemblyStateCreateInfo.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        inputAssemblyStateCreateInfo.topology = topology;
         inputAssemblyStateCreateInfo.primitiveRestartEnable = VK_FALSE;
 
-        VkViewport viewport{ };
+        VkViewport & viewport = createState->viewport;
         viewport.x = 0;
         viewport.y = 0;
         viewport.width = (float)viewportExtents.width;
@@ -91,44 +351,39 @@ namespace siofraEngine::systems
         viewport.minDepth = 0;
         viewport.maxDepth = 1;
 
-        VkRect2D scissor{ };
+        VkRect2D & scissor = createState->scissor;
         scissor.offset = { 0, 0 };
         scissor.extent = viewportExtents;
 
-        VkPipelineViewportStateCreateInfo viewportStateCreatInfo{ };
+        VkPipelineViewportStateCreateInfo & viewportStateCreatInfo = createState->viewportStateCreateInfo;
         viewportStateCreatInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
         viewportStateCreatInfo.pViewports = &viewport;
         viewportStateCreatInfo.viewportCount = 1;
         viewportStateCreatInfo.pScissors = &scissor;
         viewportStateCreatInfo.scissorCount = 1;
 
-        /*
-        std::vector<VkDynamicState> dynamicStateEnables;
-        dynamicStateEnables.push_back(VK_DYNAMIC_STATE_VIEWPORT);
-        dynamicStateEnables.push_back(VK_DYNAMIC_STATE_SCISSOR);
-
-        VkPipelineDynamicStateCreateInfo dynamicStateCreateInfo = {};
+        // Dynamic viewport and scissor values are ignored here and must be set on the command buffer
+        VkPipelineDynamicStateCreateInfo & dynamicStateCreateInfo = createState->dynamicStateCreateInfo;
         dynamicStateCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
-        dynamicStateCreateInfo.pDynamicStates = dynamicStateEnables.data();
-        dynamicStateCreateInfo.dynamicStateCount = static_cast<uint32_t>(dynamicStateEnables.size());
-        */
+        dynamicStateCreateInfo.pDynamicStates = dynamicStates.data();
+        dynamicStateCreateInfo.dynamicStateCount = static_cast<uint32_t>(dynamicStates.size());
 
-       VkPipelineRasterizationStateCreateInfo rasterizationStateCreateInfo{ };
+        VkPipelineRasterizationStateCreateInfo & rasterizationStateCreateInfo = createState->rasterizationStateCreateInfo;
         rasterizationStateCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
         rasterizationStateCreateInfo.depthClampEnable = VK_FALSE;
         rasterizationStateCreateInfo.rasterizerDiscardEnable = VK_FALSE;
         rasterizationStateCreateInfo.polygonMode = VK_POLYGON_MODE_FILL;
         rasterizationStateCreateInfo.lineWidth = 1.0f;
-        rasterizationStateCreateInfo.cullMode = VK_CULL_MODE_BACK_BIT;
-        rasterizationStateCreateInfo.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+        rasterizationStateCreateInfo.cullMode = cullMode;
+        rasterizationStateCreateInfo.frontFace = frontFace;
         rasterizationStateCreateInfo.depthBiasEnable = VK_FALSE;
 
-        VkPipelineMultisampleStateCreateInfo multisampleCreateInfo{ };
+        VkPipelineMultisampleStateCreateInfo & multisampleCreateInfo = createState->multisampleCreateInfo;
         multisampleCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
         multisampleCreateInfo.sampleShadingEnable = VK_FALSE;
         multisampleCreateInfo.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
 
-        VkPipelineColorBlendAttachmentState colourStateAttachment{ };
+        VkPipelineColorBlendAttachmentState & colourStateAttachment = createState->colourStateAttachment;
         colourStateAttachment.blendEnable = VK_TRUE;
         colourStateAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
         colourStateAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
@@ -141,46 +396,35 @@ namespace siofraEngine::systems
             VK_COLOR_COMPONENT_B_BIT |
             VK_COLOR_COMPONENT_A_BIT;
 
-        VkPipelineColorBlendStateCreateInfo colourBlendingCreateInfo{ };
+        VkPipelineColorBlendStateCreateInfo & colourBlendingCreateInfo = createState->colourBlendingCreateInfo;
         colourBlendingCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
         colourBlendingCreateInfo.logicOpEnable = VK_FALSE;
         colourBlendingCreateInfo.attachmentCount = 1;
         colourBlendingCreateInfo.pAttachments = &colourStateAttachment;
 
-        std::vector<VkDescriptorSetLayout> descriptorSetLayoutHandles{ };
-        for(auto const & descriptorSetLayout : descriptorSetLayouts)
-        {
-            descriptorSetLayoutHandles.push_back(descriptorSetLayout->getDescriptorSetLayout());
-        }
-        VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo{ };
-        pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-        pipelineLayoutCreateInfo.pSetLayouts = descriptorSetLayoutHandles.data();
-        pipelineLayoutCreateInfo.setLayoutCount = static_cast<uint32_t>(descriptorSetLayoutHandles.size());
-        pipelineLayoutCreateInfo.pushConstantRangeCount = static_cast<uint32_t>(pushConstantRanges.size());
-        pipelineLayoutCreateInfo.pPushConstantRanges = pushConstantRanges.data();
-
-        VkPipelineLayout pipelineLayout{ VK_NULL_HANDLE };
-        if (vkCreatePipelineLayout(device->getLogicalDevice(), &pipelineLayoutCreateInfo, nullptr, &pipelineLayout) != VK_SUCCESS)
-        {
-            throw std::runtime_error("Failed to create pipeline layout");
-        }
+        createState->pipelineLayout = buildPipelineLayout();
 
-        VkPipelineDepthStencilStateCreateInfo depthStencilCreateInfo{ };
+        VkPipelineDepthStencilStateCreateInfo & depthStencilCreateInfo = createState->depthStencilCreateInfo;
         depthStencilCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
-        depthStencilCreateInfo.depthTestEnable = VK_TRUE;
-        depthStencilCreateInfo.depthWriteEnable = VK_TRUE;
-        depthStencilCreateInfo.depthCompareOp = VK_COMPARE_OP_LESS;
+        depthStencilCreateInfo.depthTestEnable = depthTestEnable ? VK_TRUE : VK_FALSE;
+        depthStencilCreateInfo.depthWriteEnable = depthWriteEnable ? VK_TRUE : VK_FALSE;
+        depthStencilCreateInfo.depthCompareOp = depthCompareOp;
         depthStencilCreateInfo.depthBoundsTestEnable = VK_FALSE;
         depthStencilCreateInfo.stencilTestEnable = VK_FALSE;
 
-        std::vector<VkPipelineShaderStageCreateInfo> shaderStages{ };
+        std::vector<VkPipelineShaderStageCreateInfo> & shaderStages = createState->shaderStages;
         if(vertexShaderModule)
         {
             VkPipelineShaderStageCreateInfo vertexShaderCreateInfo = {};
 			vertexShaderCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
 			vertexShaderCreateInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
 			vertexShaderCreateInfo.module = vertexShaderModule->getShaderModule();
-			vertexShaderCreateInfo.pName = "main";
+			vertexShaderCreateInfo.pName = vertexEntryPoint.c_str();
+            if (!vertexSpecializationConstants.empty())
+            {
+                createState->vertexSpecializationInfo = vertexSpecializationConstants.getSpecializationInfo();
+                vertexShaderCreateInfo.pSpecializationInfo = &createState->vertexSpecializationInfo;
+            }
             shaderStages.push_back(vertexShaderCreateInfo);
         }
 
@@ -190,11 +434,16 @@ namespace siofraEngine::systems
 			vertexShaderCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
 			vertexShaderCreateInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
 			vertexShaderCreateInfo.module = fragmentShaderModule->getShaderModule();
-			vertexShaderCreateInfo.pName = "main";
+			vertexShaderCreateInfo.pName = fragmentEntryPoint.c_str();
+            if (!fragmentSpecializationConstants.empty())
+            {
+                createState->fragmentSpecializationInfo = fragmentSpecializationConstants.getSpecializationInfo();
+                vertexShaderCreateInfo.pSpecializationInfo = &createState->fragmentSpecializationInfo;
+            }
 			shaderStages.push_back(vertexShaderCreateInfo);
         }
 
-        VkGraphicsPipelineCreateInfo pipelineCreateInfo = {};
+        VkGraphicsPipelineCreateInfo & pipelineCreateInfo = createState->pipelineCreateInfo;
         pipelineCreateInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
         pipelineCreateInfo.pStages = shaderStages.data();
         pipelineCreateInfo.stageCount = static_cast<uint32_t>(shaderStages.size());
@@ -205,19 +454,31 @@ namespace siofraEngine::systems
         pipelineCreateInfo.pMultisampleState = &multisampleCreateInfo;
         pipelineCreateInfo.pColorBlendState = &colourBlendingCreateInfo;
         pipelineCreateInfo.pDepthStencilState = &depthStencilCreateInfo;
-        pipelineCreateInfo.pDynamicState = nullptr;
-        pipelineCreateInfo.layout = pipelineLayout;
+        pipelineCreateInfo.pDynamicState = dynamicStates.empty() ? nullptr : &dynamicStateCreateInfo;
+        pipelineCreateInfo.layout = createState->pipelineLayout->getPipelineLayout();
         pipelineCreateInfo.renderPass = renderPass->getRenderPass();
         pipelineCreateInfo.subpass = 0;
         pipelineCreateInfo.basePipelineHandle = VK_NULL_HANDLE;
         pipelineCreateInfo.basePipelineIndex = -1;
 
-        VkPipeline pipeline{ VK_NULL_HANDLE };
-        if (vkCreateGraphicsPipelines(device->getLogicalDevice(), VK_NULL_HANDLE, 1, &pipelineCreateInfo, nullptr, &pipeline) != VK_SUCCESS)
+        return createState;
+    }
+
+    std::shared_ptr<IVulkanPipelineLayout> VulkanPipeline::Builder::buildPipelineLayout() const
+    {
+        VulkanPipelineLayout::Builder pipelineLayoutBuilder;
+        pipelineLayoutBuilder
+            .withDevice(device)
+            .withDescriptorSetLayouts(descriptorSetLayouts);
+        for (auto const & pushConstantRange : pushConstantRanges)
         {
-            throw std::runtime_error("Failed to create pipeline");
+            pipelineLayoutBuilder.withPushConstantRange(pushConstantRange.stageFlags, pushConstantRange.offset, pushConstantRange.size);
         }
 
-        return std::make_unique<VulkanPipeline>(pipeline, pipelineLayout, device);
+        if (pipelineLayoutCache)
+        {
+            return pipelineLayoutCache->getOrCreate(pipelineLayoutBuilder);
+        }
+        return pipelineLayoutBuilder.build();
     }
 }
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <algorithm>
 #include <stdexcept>
 #include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanPipelineBuilder.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/vulkanPipeline.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/vulkanPipelineLayoutBuilder.hpp"
 
 namespace siofraEngine::systems
 {
@@ -36,6 +38,22 @@ namespace siofraEngine::systems
          */
         IVulkanPipelineBuilder& withRenderPass(IVulkanRenderPass const * renderPass) noexcept override;
 
+        /**
+         * @brief Specify the pipeline cache used to accelerate pipeline creation
+         * 
+         * @param pipelineCache The pipeline cache used to accelerate pipeline creation
+         * @returns Reference to the builder
+         */
+        IVulkanPipelineBuilder& withPipelineCache(IVulkanPipelineCache const * pipelineCache) noexcept override;
+
+        /**
+         * @brief Specify the pipeline layout cache used to share pipeline layouts between pipelines. Without a cache the pipeline owns its layout
+         * 
+         * @param pipelineLayoutCache The pipeline layout cache used to share pipeline layouts
+         * @returns Reference to the builder
+         */
+        IVulkanPipelineBuilder& withPipelineLayoutCache(IVulkanPipelineLayoutCache * pipelineLayoutCache) noexcept override;
+
         /**
          * @brief Specify the descriptor set layouts to include in the pipeline layout
          * 
@@ -92,6 +110,74 @@ namespace siofraEngine::systems
          */
         IVulkanPipelineBuilder& withFragmentStage(std::unique_ptr<IVulkanShaderModule> shaderModule) noexcept override;
 
+        /**
+         * @brief Specify a pipeline shader module for the vertex stage with a custom entry point and specialization constants
+         * 
+         * @param shaderModule The pipeline shader module
+         * @param entryPoint Name of the shader entry point
+         * @param specializationConstants Values of the shader specialization constants
+         */
+        IVulkanPipelineBuilder& withVertexStage(std::unique_ptr<IVulkanShaderModule> shaderModule, std::string entryPoint, VulkanSpecializationConstants specializationConstants) noexcept override;
+
+        /**
+         * @brief Specify a pipeline shader module for the fragment stage with a custom entry point and specialization constants
+         * 
+         * @param shaderModule The pipeline shader module
+         * @param entryPoint Name of the shader entry point
+         * @param specializationConstants Values of the shader specialization constants
+         */
+        IVulkanPipelineBuilder& withFragmentStage(std::unique_ptr<IVulkanShaderModule> shaderModule, std::string entryPoint, VulkanSpecializationConstants specializationConstants) noexcept override;
+
+        /**
+         * @brief Specify a state which is set dynamically with command buffer commands rather than baked into the pipeline.
+         * Extended dynamic states require the EXTENDED_DYNAMIC_STATE device feature
+         * 
+         * @param dynamicState The dynamic state
+         * @returns Reference to the builder
+         */
+        IVulkanPipelineBuilder& withDynamicState(VkDynamicState dynamicState) noexcept override;
+
+        /**
+         * @brief Specify the primitive topology. Defaults to triangle list
+         * 
+         * @param topology The primitive topology
+         * @returns Reference to the builder
+         */
+        IVulkanPipelineBuilder& withTopology(VkPrimitiveTopology topology) noexcept override;
+
+        /**
+         * @brief Specify the triangle facing used for culling. Defaults to back face culling
+         * 
+         * @param cullMode The cull mode
+         * @returns Reference to the builder
+         */
+        IVulkanPipelineBuilder& withCullMode(VkCullModeFlags cullMode) noexcept override;
+
+        /**
+         * @brief Specify the front facing triangle orientation. Defaults to counter clockwise
+         * 
+         * @param frontFace The front face orientation
+         * @returns Reference to the builder
+         */
+        IVulkanPipelineBuilder& withFrontFace(VkFrontFace frontFace) noexcept override;
+
+        /**
+         * @brief Specify the depth test state. Defaults to testing and writing with a less than comparison
+         * 
+         * @param depthTestEnable Indicates if depth testing is enabled
+         * @param depthWriteEnable Indicates if depth writes are enabled
+         * @param depthCompareOp The depth comparison operator
+         * @returns Reference to the builder
+         */
+        IVulkanPipelineBuilder& withDepthTest(bool depthTestEnable, bool depthWriteEnable, VkCompareOp depthCompareOp) noexcept override;
+
+        /**
+         * @brief Get a key identifying the pipeline state the builder would create. Shader modules and other objects are identified by their contents rather than their handles, and static state replaced by dynamic state is excluded. Builders with equal keys create interchangeable pipelines
+         * 
+         * @returns The pipeline state key
+         */
+        std::string getStateKey() const override;
+
         /**
          * @brief Build the Vulkan pipeline
          * 
@@ -99,7 +185,38 @@ namespace siofraEngine::systems
          */
         std::unique_ptr<IVulkanPipeline> build() const override;
 
+        /**
+         * @brief Build several Vulkan pipelines with a single pipeline creation call. The builders must share a device and pipeline cache
+         * 
+         * @param pipelineBuilders The configured pipeline builders
+         * @returns The final Vulkan pipelines, in the order of the builders
+         */
+        static std::vector<std::unique_ptr<IVulkanPipeline>> buildBatch(std::vector<Builder const *> const & pipelineBuilders);
+
     private:
+        /**
+         * @brief Pipeline creation state referenced by the graphics pipeline create info
+         */
+        struct CreateState
+        {
+            VkPipelineVertexInputStateCreateInfo vertexInputCreateInfo{ };
+            VkPipelineInputAssemblyStateCreateInfo inputAssemblyStateCreateInfo{ };
+            VkViewport viewport{ };
+            VkRect2D scissor{ };
+            VkPipelineViewportStateCreateInfo viewportStateCreateInfo{ };
+            VkPipelineDynamicStateCreateInfo dynamicStateCreateInfo{ };
+            VkPipelineRasterizationStateCreateInfo rasterizationStateCreateInfo{ };
+            VkPipelineMultisampleStateCreateInfo multisampleCreateInfo{ };
+            VkPipelineColorBlendAttachmentState colourStateAttachment{ };
+            VkPipelineColorBlendStateCreateInfo colourBlendingCreateInfo{ };
+            std::shared_ptr<IVulkanPipelineLayout> pipelineLayout{ nullptr };
+            VkPipelineDepthStencilStateCreateInfo depthStencilCreateInfo{ };
+            VkSpecializationInfo vertexSpecializationInfo{ };
+            VkSpecializationInfo fragmentSpecializationInfo{ };
+            std::vector<VkPipelineShaderStageCreateInfo> shaderStages{ };
+            VkGraphicsPipelineCreateInfo pipelineCreateInfo{ };
+        };
+
         /**
          * @brief The vulkan device which will be used to create the render pass
          */
@@ -110,6 +227,16 @@ namespace siofraEngine::systems
          */
         IVulkanRenderPass const * renderPass{ nullptr };
 
+        /**
+         * @brief The pipeline cache used to accelerate pipeline creation
+         */
+        IVulkanPipelineCache const * pipelineCache{ nullptr };
+
+        /**
+         * @brief The pipeline layout cache used to share pipeline layouts between pipelines
+         */
+        IVulkanPipelineLayoutCache * pipelineLayoutCache{ nullptr };
+
         /**
          * @brief The pipeline viewport extents
          */
@@ -125,6 +252,41 @@ namespace siofraEngine::systems
          */
         std::vector<VkVertexInputAttributeDescription> vertexInputAttributeDescriptions{ };
 
+        /**
+         * @brief The states set dynamically with command buffer commands
+         */
+        std::vector<VkDynamicState> dynamicStates{ };
+
+        /**
+         * @brief The primitive topology
+         */
+        VkPrimitiveTopology topology{ VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST };
+
+        /**
+         * @brief The triangle facing used for culling
+         */
+        VkCullModeFlags cullMode{ VK_CULL_MODE_BACK_BIT };
+
+        /**
+         * @brief The front facing triangle orientation
+         */
+        VkFrontFace frontFace{ VK_FRONT_FACE_COUNTER_CLOCKWISE };
+
+        /**
+         * @brief Indicates if depth testing is enabled
+         */
+        bool depthTestEnable{ true };
+
+        /**
+         * @brief Indicates if depth writes are enabled
+         */
+        bool depthWriteEnable{ true };
+
+        /**
+         * @brief The depth comparison operator
+         */
+        VkCompareOp depthCompareOp{ VK_COMPARE_OP_LESS };
+
          /**
          * @brief The push constant ranges to include in the pipeline layout
          */
@@ -140,9 +302,51 @@ namespace siofraEngine::systems
          */
         std::unique_ptr<IVulkanShaderModule> vertexShaderModule{ };
 
+        /**
+         * @brief The pipeline vertex stage entry point
+         */
+        std::string vertexEntryPoint{ "main" };
+
+        /**
+         * @brief The pipeline vertex stage specialization constants
+         */
+        VulkanSpecializationConstants vertexSpecializationConstants{ };
+
         /**
          * @brief The pipeline fragment stage shader module
          */
         std::unique_ptr<IVulkanShaderModule> fragmentShaderModule{ };
+
+        /**
+         * @brief The pipeline fragment stage entry point
+         */
+        std::string fragmentEntryPoint{ "main" };
+
+        /**
+         * @brief The pipeline fragment stage specialization constants
+         */
+        VulkanSpecializationConstants fragmentSpecializationConstants{ };
+
+        /**
+         * @brief Get the pipeline layout and populate the graphics pipeline create info
+         * 
+         * @returns The pipeline creation state, which holds a reference to the pipeline layout
+         */
+        std::unique_ptr<CreateState> prepare() const;
+
+        /**
+         * @brief Get the topology class of a primitive topology. A dynamic topology must belong to the class of the pipeline's static topology
+         * 
+         * @param topology The primitive topology
+         * @returns 0 for points, 1 for lines, 2 for triangles or 3 for patches
+         */
+        static uint32_t getTopologyClass(VkPrimitiveTopology topology) noexcept;
+
+        /**
+         * @brief Get the pipeline layout for the configured descriptor set layouts and push constant ranges, shared through the pipeline layout cache if one was specified
+         * 
+         * @returns The pipeline layout
+         */
+        std::shared_ptr<IVulkanPipelineLayout> buildPipelineLayout() const;
     };
 }
@@ -0,0 +1,92 @@
+#include "systems/renderer/vulkan/vulkanComponents/builders/vulkanPipelineCacheBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    IVulkanPipelineCacheBuilder& VulkanPipelineCache::Builder::withDevice(IVulkanDevice const * device) noexcept
+    {
+        this->device = device;
+        return *this;
+    }
+
+    IVulkanPipelineCacheBuilder& VulkanPipelineCache::Builder::withFilePath(std::string filePath) noexcept
+    {
+        this->filePath = filePath;
+        return *this;
+    }
+
+    std::unique_ptr<IVulkanPipelineCache> VulkanPipelineCache::Builder::build() const
+    {
+        std::vector<char> initialData = loadInitialData();
+
+        VkPipelineCacheCreateInfo pipelineCacheCreateInfo{ };
+        pipelineCacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        pipelineCacheCreateInfo.initialDataSize = initialData.size();
+        pipelineCacheCreateInfo.pInitialData = initialData.empty() ? nullptr : initialData.data();
+
+        VkPipelineCache pipelineCache{ VK_NULL_HANDLE };
+        if (vkCreatePipelineCache(device->getLogicalDevice(), &pipelineCacheCreateInfo, nullptr, &pipelineCache) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create pipeline cache");
+        }
+
+        return std::make_unique<VulkanPipelineCache>(pipelineCache, filePath, device);
+    }
+
+    std::vector<char> VulkanPipelineCache::Builder::loadInitialData() const
+    {
+        if (filePath.empty())
+        {
+            return { };
+        }
+
+        std::ifstream file(filePath, std::ios::binary);
+        if (!file)
+        {
+            return { };
+        }
+
+        std::error_code errorCode{ };
+        uintmax_t fileSize = std::filesystem::file_size(filePath, errorCode);
+        if (errorCode)
+        {
+            return { };
+        }
+
+        VkPhysicalDeviceProperties physicalDeviceProperties{ };
+        vkGetPhysicalDeviceProperties(device->getPhysicalDevice(), &physicalDeviceProperties);
+
+        // Validate the size against the file before allocating, so a corrupt header cannot request an arbitrary allocation
+        FileHeader fileHeader{ };
+        if (!file.read(reinterpret_cast<char *>(&fileHeader), sizeof(FileHeader)) ||
+            fileHeader.magic != fileMagic ||
+            fileHeader.driverVersion != physicalDeviceProperties.driverVersion ||
+            fileHeader.dataSize < sizeof(VkPipelineCacheHeaderVersionOne) ||
+            fileHeader.dataSize > maxFileDataSize ||
+            fileHeader.dataSize != fileSize - sizeof(FileHeader))
+        {
+            return { };
+        }
+
+        // Drivers should reject foreign data themselves, but not all do so reliably
+        VkPipelineCacheHeaderVersionOne cacheHeader{ };
+        if (!file.read(reinterpret_cast<char *>(&cacheHeader), sizeof(VkPipelineCacheHeaderVersionOne)) ||
+            cacheHeader.headerSize < sizeof(VkPipelineCacheHeaderVersionOne) ||
+            cacheHeader.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+            cacheHeader.vendorID != physicalDeviceProperties.vendorID ||
+            cacheHeader.deviceID != physicalDeviceProperties.deviceID ||
+            std::memcmp(cacheHeader.pipelineCacheUUID, physicalDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE) != 0)
+        {
+            return { };
+        }
+
+        std::vector<char> data(static_cast<size_t>(fileHeader.dataSize));
+        std::memcpy(data.data(), &cacheHeader, sizeof(VkPipelineCacheHeaderVersionOne));
+        size_t remainingSize = data.size() - sizeof(VkPipelineCacheHeaderVersionOne);
+        if (!file.read(data.data() + sizeof(VkPipelineCacheHeaderVersionOne), static_cast<std::streamsize>(remainingSize)))
+        {
+            return { };
+        }
+
+        return data;
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstring>
+#include <stdexcept>
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanPipelineCacheBuilder.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/vulkanPipelineCache.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan pipeline cache builder
+     */
+    class VulkanPipelineCache::Builder : public IVulkanPipelineCacheBuilder
+    {
+    public:
+        /**
+         * @brief Specify the device used to create the pipeline cache
+         * 
+         * @param device The device with which to create the pipeline cache
+         * @returns Reference to the builder
+         */
+        IVulkanPipelineCacheBuilder& withDevice(IVulkanDevice const * device) noexcept override;
+
+        /**
+         * @brief Specify the file the pipeline cache is loaded from and saved to
+         * 
+         * @param filePath Path of the pipeline cache file
+         * @returns Reference to the builder
+         */
+        IVulkanPipelineCacheBuilder& withFilePath(std::string filePath) noexcept override;
+
+        /**
+         * @brief Build the Vulkan pipeline cache. Cache data on disk is discarded if it was produced by a different device or driver
+         * 
+         * @returns The final Vulkan pipeline cache
+         */
+        std::unique_ptr<IVulkanPipelineCache> build() const override;
+
+    private:
+        /**
+         * @brief The device with which to create the pipeline cache
+         */
+        IVulkanDevice const * device{ nullptr };
+
+        /**
+         * @brief Path of the pipeline cache file
+         */
+        std::string filePath{ };
+
+        /**
+         * @brief Read the pipeline cache data from disk
+         * 
+         * @returns The pipeline cache data, or empty if there is no usable data
+         */
+        std::vector<char> loadInitialData() const;
+    };
+}
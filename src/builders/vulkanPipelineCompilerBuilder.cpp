@@ -0,0 +1,33 @@
+#include "systems/renderer/vulkan/vulkanComponents/builders/vulkanPipelineCompilerBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    IVulkanPipelineCompilerBuilder& VulkanPipelineCompiler::Builder::withThreadCount(uint32_t threadCount) noexcept
+    {
+        this->threadCount = threadCount;
+        return *this;
+    }
+
+    IVulkanPipelineCompilerBuilder& VulkanPipelineCompiler::Builder::withBatchSize(uint32_t batchSize) noexcept
+    {
+        this->batchSize = batchSize;
+        return *this;
+    }
+
+    std::unique_ptr<IVulkanPipelineCompiler> VulkanPipelineCompiler::Builder::build() const
+    {
+        if (batchSize == 0)
+        {
+            throw std::runtime_error("Failed to create pipeline compiler, batch size must be non-zero");
+        }
+
+        // Leave a hardware thread free for the thread queuing work, such as asset loading
+        uint32_t workerCount = threadCount;
+        if (workerCount == 0)
+        {
+            workerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+        }
+
+        return std::make_unique<VulkanPipelineCompiler>(workerCount, batchSize);
+    }
+}
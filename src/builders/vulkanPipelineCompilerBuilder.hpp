@@ -0,0 +1,50 @@
+#pragma once
+
+#include <algorithm>
+#include <stdexcept>
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanPipelineCompilerBuilder.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/vulkanPipelineCompiler.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan pipeline compiler builder
+     */
+    class VulkanPipelineCompiler::Builder : public IVulkanPipelineCompilerBuilder
+    {
+    public:
+        /**
+         * @brief Specify the number of worker threads. Defaults to one less than the number of hardware threads
+         * 
+         * @param threadCount The number of worker threads
+         * @returns Reference to the builder
+         */
+        IVulkanPipelineCompilerBuilder& withThreadCount(uint32_t threadCount) noexcept override;
+
+        /**
+         * @brief Specify the maximum number of pipelines created by a single pipeline creation call
+         * 
+         * @param batchSize The maximum number of pipelines per creation call
+         * @returns Reference to the builder
+         */
+        IVulkanPipelineCompilerBuilder& withBatchSize(uint32_t batchSize) noexcept override;
+
+        /**
+         * @brief Build the Vulkan pipeline compiler
+         * 
+         * @returns The final Vulkan pipeline compiler
+         */
+        std::unique_ptr<IVulkanPipelineCompiler> build() const override;
+
+    private:
+        /**
+         * @brief The number of worker threads, or 0 to derive it from the number of hardware threads
+         */
+        uint32_t threadCount{ 0 };
+
+        /**
+         * @brief The maximum number of pipelines per creation call
+         */
+        uint32_t batchSize{ 1 };
+    };
+}
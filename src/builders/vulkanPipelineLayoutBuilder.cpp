@@ -0,0 +1,79 @@
+#include "systems/renderer/vulkan/vulkanComponents/builders/vulkanPipelineLayoutBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    IVulkanPipelineLayoutBuilder& VulkanPipelineLayout::Builder::withDevice(IVulkanDevice const * device) noexcept
+    {
+        this->device = device;
+        return *this;
+    }
+
+    IVulkanPipelineLayoutBuilder& VulkanPipelineLayout::Builder::withDescriptorSetLayouts(std::vector<IVulkanDescriptorSetLayout const *> descriptorSetLayouts) noexcept
+    {
+        this->descriptorSetLayouts = descriptorSetLayouts;
+        return *this;
+    }
+
+    IVulkanPipelineLayoutBuilder& VulkanPipelineLayout::Builder::withPushConstantRange(VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size) noexcept
+    {
+        VkPushConstantRange pushConstantRange{ };
+        pushConstantRange.stageFlags = stageFlags;
+        pushConstantRange.offset = offset;
+        pushConstantRange.size = size;
+        pushConstantRanges.push_back(pushConstantRange);
+        return *this;
+    }
+
+    std::string VulkanPipelineLayout::Builder::getStateKey() const
+    {
+        std::string stateKey{ };
+        auto append = [&stateKey](auto const & value) {
+            stateKey.append(reinterpret_cast<char const *>(&value), sizeof(value));
+        };
+
+        // Set layouts are identified by their bindings rather than handles, which may be reused once the layouts are destroyed
+        append(device->getLogicalDevice());
+
+        append(descriptorSetLayouts.size());
+        for (auto const & descriptorSetLayout : descriptorSetLayouts)
+        {
+            std::string const & setLayoutKey = descriptorSetLayout->getStateKey();
+            append(setLayoutKey.size());
+            stateKey.append(setLayoutKey);
+        }
+
+        append(pushConstantRanges.size());
+        for (auto const & pushConstantRange : pushConstantRanges)
+        {
+            append(pushConstantRange.stageFlags);
+            append(pushConstantRange.offset);
+            append(pushConstantRange.size);
+        }
+
+        return stateKey;
+    }
+
+    std::unique_ptr<IVulkanPipelineLayout> VulkanPipelineLayout::Builder::build() const
+    {
+        std::vector<VkDescriptorSetLayout> descriptorSetLayoutHandles{ };
+        for(auto const & descriptorSetLayout : descriptorSetLayouts)
+        {
+            descriptorSetLayoutHandles.push_back(descriptorSetLayout->getDescriptorSetLayout());
+        }
+
+        VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo{ };
+        pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipelineLayoutCreateInfo.pSetLayouts = descriptorSetLayoutHandles.data();
+        pipelineLayoutCreateInfo.setLayoutCount = static_cast<uint32_t>(descriptorSetLayoutHandles.size());
+        pipelineLayoutCreateInfo.pushConstantRangeCount = static_cast<uint32_t>(pushConstantRanges.size());
+        pipelineLayoutCreateInfo.pPushConstantRanges = pushConstantRanges.data();
+
+        VkPipelineLayout pipelineLayout{ VK_NULL_HANDLE };
+        if (vkCreatePipelineLayout(device->getLogicalDevice(), &pipelineLayoutCreateInfo, nullptr, &pipelineLayout) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create pipeline layout");
+        }
+
+        return std::make_unique<VulkanPipelineLayout>(pipelineLayout, device);
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stdexcept>
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanPipelineLayoutBuilder.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/vulkanPipelineLayout.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan pipeline layout builder
+     */
+    class VulkanPipelineLayout::Builder : public IVulkanPipelineLayoutBuilder
+    {
+    public:
+        /**
+         * @brief Specify the device used to create the pipeline layout
+         * 
+         * @param device The device with which to create the pipeline layout
+         * @returns Reference to the builder
+         */
+        IVulkanPipelineLayoutBuilder& withDevice(IVulkanDevice const * device) noexcept override;
+
+        /**
+         * @brief Specify the descriptor set layouts to include in the pipeline layout
+         * 
+         * @param descriptorSetLayouts The descriptor set layouts to include in the pipeline layout
+         * @returns Reference to the builder
+         */
+        IVulkanPipelineLayoutBuilder& withDescriptorSetLayouts(std::vector<IVulkanDescriptorSetLayout const *> descriptorSetLayouts) noexcept override;
+
+        /**
+         * @brief Specify a push constant range
+         * 
+         * @param stageFlags The shader stages that will access the range of push constants
+         * @param offset The start offset of the range in bytes
+         * @param size The size of the range in bytes
+         * @returns Reference to the builder
+         */
+        IVulkanPipelineLayoutBuilder& withPushConstantRange(VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size) noexcept override;
+
+        /**
+         * @brief Get a key identifying the configured layout state. Set layouts are identified by their bindings rather than their handles. Builders with equal keys build compatible pipeline layouts
+         * 
+         * @returns The layout state key
+         */
+        std::string getStateKey() const override;
+
+        /**
+         * @brief Build the Vulkan pipeline layout
+         * 
+         * @returns The final Vulkan pipeline layout
+         */
+        std::unique_ptr<IVulkanPipelineLayout> build() const override;
+
+    private:
+        /**
+         * @brief The device with which to create the pipeline layout
+         */
+        IVulkanDevice const * device{ nullptr };
+
+        /**
+         * @brief The descriptor set layouts to include in the pipeline layout
+         */
+        std::vector<IVulkanDescriptorSetLayout const *> descriptorSetLayouts{ };
+
+        /**
+         * @brief The push constant ranges
+         */
+        std::vector<VkPushConstantRange> pushConstantRanges{ };
+    };
+}
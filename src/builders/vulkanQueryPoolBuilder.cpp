@@ -0,0 +1,43 @@
+#include "systems/renderer/vulkan/vulkanComponents/builders/vulkanQueryPoolBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    IVulkanQueryPoolBuilder& VulkanQueryPool::Builder::withDevice(IVulkanDevice const * device) noexcept
+    {
+        this->device = device;
+        return *this;
+    }
+
+    IVulkanQueryPoolBuilder& VulkanQueryPool::Builder::withQueryType(VkQueryType queryType) noexcept
+    {
+        this->queryType = queryType;
+        return *this;
+    }
+
+    IVulkanQueryPoolBuilder& VulkanQueryPool::Builder::withQueryCount(uint32_t queryCount) noexcept
+    {
+        this->queryCount = queryCount;
+        return *this;
+    }
+
+    std::unique_ptr<IVulkanQueryPool> VulkanQueryPool::Builder::build() const
+    {
+        if (queryCount == 0)
+        {
+            throw std::runtime_error("Failed to create query pool, query count must be non-zero");
+        }
+
+        VkQueryPoolCreateInfo queryPoolCreateInfo{ };
+        queryPoolCreateInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        queryPoolCreateInfo.queryType = queryType;
+        queryPoolCreateInfo.queryCount = queryCount;
+
+        VkQueryPool queryPool{ VK_NULL_HANDLE };
+        if (vkCreateQueryPool(device->getLogicalDevice(), &queryPoolCreateInfo, nullptr, &queryPool) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create query pool");
+        }
+
+        return std::make_unique<VulkanQueryPool>(queryPool, queryType, queryCount, device);
+    }
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stdexcept>
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanQueryPoolBuilder.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/vulkanQueryPool.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan query pool builder
+     */
+    class VulkanQueryPool::Builder : public IVulkanQueryPoolBuilder
+    {
+    public:
+        /**
+         * @brief Specify the device used to create the query pool
+         * 
+         * @param device The device with which to create the query pool
+         * @returns Reference to the builder
+         */
+        IVulkanQueryPoolBuilder& withDevice(IVulkanDevice const * device) noexcept override;
+
+        /**
+         * @brief Specify the type of the queries in the pool
+         * 
+         * @param queryType The query type
+         * @returns Reference to the builder
+         */
+        IVulkanQueryPoolBuilder& withQueryType(VkQueryType queryType) noexcept override;
+
+        /**
+         * @brief Specify the number of queries in the pool
+         * 
+         * @param queryCount The number of queries
+         * @returns Reference to the builder
+         */
+        IVulkanQueryPoolBuilder& withQueryCount(uint32_t queryCount) noexcept override;
+
+        /**
+         * @brief Build the Vulkan query pool
+         * 
+         * @returns The final Vulkan query pool
+         */
+        std::unique_ptr<IVulkanQueryPool> build() const override;
+
+    private:
+        /**
+         * @brief The device with which to create the query pool
+         */
+        IVulkanDevice const * device{ nullptr };
+
+        /**
+         * @brief The type of the queries in the pool
+         */
+        VkQueryType queryType{ VK_QUERY_TYPE_TIMESTAMP };
+
+        /**
+         * @brief The number of queries in the pool
+         */
+        uint32_t queryCount{ 0 };
+    };
+}
@@ -20,6 +20,12 @@ namespace siofraEngine::systems
         return *this;
     }
 
+    IVulkanQueueBuilder& VulkanQueue::Builder::withSynchronization2(bool synchronization2) noexcept
+    {
+        this->synchronization2 = synchronization2;
+        return *this;
+    }
+
     std::unique_ptr<IVulkanQueue> VulkanQueue::Builder::build() const
     {
         VkQueue queue = VK_NULL_HANDLE;
@@ -28,6 +34,6 @@ namespace siofraEngine::systems
             vkGetDeviceQueue(logicalDevice, queueFamilyIndex, queueIndex, &queue);
         }
         
-        return std::make_unique<VulkanQueue>(queue, queueFamilyIndex);
+        return std::make_unique<VulkanQueue>(queue, queueFamilyIndex, synchronization2);
     }
 }
@@ -40,6 +40,14 @@ namespace siofraEngine::systems
          */
 		IVulkanQueueBuilder& withQueueIndex(std::uint32_t queueIndex) noexcept override;
 
+        /**
+         * @brief Specify if submissions use vkQueueSubmit2. Requires the SYNCHRONIZATION_2 device feature
+         * 
+         * @param synchronization2 Indicates if synchronization2 is enabled
+         * @returns Reference to the Vulkan queue builder
+         */
+        IVulkanQueueBuilder& withSynchronization2(bool synchronization2) noexcept override;
+
         /**
          * @brief Build the Vulkan queue
          * 
@@ -62,5 +70,10 @@ namespace siofraEngine::systems
          * @brief The index within this queue family of the queue to retrieve
          */
         std::uint32_t queueIndex{ 0 };
+
+        /**
+         * @brief Indicates if submissions use vkQueueSubmit2
+         */
+        bool synchronization2{ false };
     };
 }
@@ -122,16 +122,20 @@ namespace siofraEngine::systems
         }
 
         std::vector<std::unique_ptr<IVulkanImage>> const & swapchainImages = swapchain->getSwapchainImages();
-        std::vector<std::unique_ptr<IVulkanFramebuffer>> framebuffers(swapchainImages.size());
-        for(size_t i = 0; i < framebuffers.size(); i++)
+        std::vector<std::unique_ptr<IVulkanImage>> const & depthAttachments = swapchain->getDepthAttachments();
+        std::vector<std::unique_ptr<IVulkanFramebuffer>> framebuffers(depthAttachments.size() * swapchainImages.size());
+        for(size_t frame = 0; frame < depthAttachments.size(); frame++)
         {
-            framebuffers[i] = vulkanFramebufferBuilder
-                .withAttachment(swapchainImages[i].get(), FrameBufferAttachmentTypes::COLOUR_ATTACHMENT)
-                .withAttachment(swapchain->getDepthAttachment().get(), FrameBufferAttachmentTypes::DEPTH_ATTACHMENT)
-                .withExtents(renderAreaExtents.width, renderAreaExtents.height)
-                .withDevice(device)
-                .withRenderPassHandle(renderPass)
-                .build();
+            for(size_t i = 0; i < swapchainImages.size(); i++)
+            {
+                framebuffers[frame * swapchainImages.size() + i] = vulkanFramebufferBuilder
+                    .withAttachment(swapchainImages[i].get(), FrameBufferAttachmentTypes::COLOUR_ATTACHMENT)
+                    .withAttachment(depthAttachments[frame].get(), FrameBufferAttachmentTypes::DEPTH_ATTACHMENT)
+                    .withExtents(renderAreaExtents.width, renderAreaExtents.height)
+                    .withDevice(device)
+                    .withRenderPassHandle(renderPass)
+                    .build();
+            }
         }
 
         std::vector<VkClearValue> clearValues = {
@@ -139,6 +143,20 @@ namespace siofraEngine::systems
             depthClearValue
         };
 
-        return std::make_unique<VulkanRenderPass>(renderPass, renderAreaOffset, renderAreaExtents, std::move(clearValues), std::move(framebuffers), device);
+        // Render pass compatibility depends on the attachment formats and sample counts and the subpass structure, which is fixed here
+        std::string stateKey{ };
+        auto append = [&stateKey](auto const & value) {
+            stateKey.append(reinterpret_cast<char const *>(&value), sizeof(value));
+        };
+
+        append(subpasses.size());
+        append(attachments.size());
+        for (auto const & attachment : attachments)
+        {
+            append(attachment.format);
+            append(attachment.samples);
+        }
+
+        return std::make_unique<VulkanRenderPass>(renderPass, renderAreaOffset, renderAreaExtents, std::move(clearValues), std::move(framebuffers), static_cast<uint32_t>(swapchainImages.size()), std::move(stateKey), device);
     }
 }
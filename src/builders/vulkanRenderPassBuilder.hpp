@@ -1,6 +1,7 @@
 #pragma once
 
 #include <stdexcept>
+#include <string>
 #include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanRenderPassBuilder.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanFramebufferBuilder.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/vulkanRenderPass.hpp"
@@ -8,10 +8,28 @@ namespace siofraEngine::systems
         return *this;
     }
 
+    IVulkanSemaphoreBuilder& VulkanSemaphore::Builder::withType(VkSemaphoreType type) noexcept
+    {
+        this->type = type;
+        return *this;
+    }
+
+    IVulkanSemaphoreBuilder& VulkanSemaphore::Builder::withInitialValue(uint64_t initialValue) noexcept
+    {
+        this->initialValue = initialValue;
+        return *this;
+    }
+
     std::unique_ptr<IVulkanSemaphore> VulkanSemaphore::Builder::build() const
     {
+        VkSemaphoreTypeCreateInfo semaphoreTypeCreateInfo{ };
+        semaphoreTypeCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+        semaphoreTypeCreateInfo.semaphoreType = type;
+        semaphoreTypeCreateInfo.initialValue = initialValue;
+
         VkSemaphoreCreateInfo semephoreCreateInfo{ };
         semephoreCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semephoreCreateInfo.pNext = type == VK_SEMAPHORE_TYPE_TIMELINE ? &semaphoreTypeCreateInfo : nullptr;
 
         VkSemaphore semaphore{ VK_NULL_HANDLE };
         if (vkCreateSemaphore(device->getLogicalDevice(), &semephoreCreateInfo, nullptr, &semaphore) != VK_SUCCESS)
@@ -19,6 +37,6 @@ namespace siofraEngine::systems
             throw std::runtime_error("Failed to create semephore");
         }
 
-        return std::make_unique<VulkanSemaphore>(semaphore, device);
+        return std::make_unique<VulkanSemaphore>(semaphore, type, device);
     }
 }
@@ -20,6 +20,22 @@ namespace siofraEngine::systems
          */
         IVulkanSemaphoreBuilder& withDevice(IVulkanDevice const * device) noexcept override;
 
+        /**
+         * @brief Specify the semaphore type. Timeline semaphores require the timeline semaphore device feature
+         * 
+         * @param type The semaphore type
+         * @returns Reference to the builder
+         */
+        IVulkanSemaphoreBuilder& withType(VkSemaphoreType type) noexcept override;
+
+        /**
+         * @brief Specify the initial counter value of a timeline semaphore
+         * 
+         * @param initialValue The initial counter value
+         * @returns Reference to the builder
+         */
+        IVulkanSemaphoreBuilder& withInitialValue(uint64_t initialValue) noexcept override;
+
         /**
          * @brief Build the Vulkan semaphore
          * 
@@ -32,5 +48,15 @@ namespace siofraEngine::systems
          * @brief The device with which to create the semaphore
          */
         IVulkanDevice const * device{ nullptr };
+
+        /**
+         * @brief The semaphore type
+         */
+        VkSemaphoreType type{ VK_SEMAPHORE_TYPE_BINARY };
+
+        /**
+         * @brief The initial counter value of a timeline semaphore
+         */
+        uint64_t initialValue{ 0 };
     };
 }
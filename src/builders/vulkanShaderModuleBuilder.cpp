@@ -27,6 +27,9 @@ namespace siofraEngine::systems
 			throw std::runtime_error("Failed to create a shader module");
 		}
 
-        return std::make_unique<VulkanShaderModule>(shaderModule, device);
+        // The full code is kept rather than a hash, so distinct shaders can never share a key
+        std::string stateKey(shaderCode.begin(), shaderCode.end());
+
+        return std::make_unique<VulkanShaderModule>(shaderModule, std::move(stateKey), device);
     }
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <stdexcept>
+#include <string>
 #include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanShaderModuleBuilder.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/vulkanShaderModule.hpp"
 
@@ -27,7 +27,29 @@ namespace siofraEngine::systems
         return *this;
     }
 
+    IVulkanSwapchainBuilder& VulkanSwapchain::Builder::withOldSwapchain(IVulkanSwapchain const * oldSwapchain) noexcept
+    {
+        this->oldSwapchain = oldSwapchain;
+        return *this;
+    }
+
     std::unique_ptr<IVulkanSwapchain> VulkanSwapchain::Builder::build() const
+    {
+        VkSwapchainKHR swapchain{ VK_NULL_HANDLE };
+        VkFormat imageFormat{ VK_FORMAT_UNDEFINED };
+        VkFormat depthFormat{ VK_FORMAT_UNDEFINED };
+        VkExtent2D selectedExtents{ };
+        std::vector<std::unique_ptr<IVulkanImage>> swapChainImages{ };
+        std::vector<std::unique_ptr<IVulkanImage>> depthAttachments{ };
+        if (!buildHandles(swapchain, imageFormat, depthFormat, selectedExtents, swapChainImages, depthAttachments))
+        {
+            throw std::runtime_error("Failed to create swapchain, the surface has a zero extent");
+        }
+
+        return std::make_unique<VulkanSwapchain>(swapchain, imageFormat, depthFormat, selectedExtents, std::move(swapChainImages), std::move(depthAttachments), surface, device);
+    }
+
+    bool VulkanSwapchain::Builder::buildHandles(VkSwapchainKHR & swapchain, VkFormat & imageFormat, VkFormat & depthAttachmentFormat, VkExtent2D & selectedExtents, std::vector<std::unique_ptr<IVulkanImage>> & swapChainImages, std::vector<std::unique_ptr<IVulkanImage>> & depthAttachments) const
     {
         VkSurfaceFormatKHR surfaceFormat{ };
         selectSurfaceFormat(device, surface, surfaceFormat);
@@ -35,11 +57,16 @@ namespace siofraEngine::systems
         VkPresentModeKHR presentMode{ };
 		selectPresentationMode(device, surface, presentMode);
 
-        VkExtent2D selectedExtents{ };
         uint32_t imageCount{ };
         VkSurfaceTransformFlagBitsKHR currentTransform{ };
 		selectCapabilities(device, surface, extents, selectedExtents, imageCount, currentTransform);
 
+        // A minimised window reports a zero extent, for which no swapchain can be created
+        if (selectedExtents.width == 0 || selectedExtents.height == 0)
+        {
+            return false;
+        }
+
         VkSwapchainCreateInfoKHR swapChainCreateInfo = {};
         swapChainCreateInfo.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
         swapChainCreateInfo.surface = surface->getSurface();
@@ -74,9 +101,8 @@ namespace siofraEngine::systems
             swapChainCreateInfo.pQueueFamilyIndices = nullptr;
         }
 
-        swapChainCreateInfo.oldSwapchain = VK_NULL_HANDLE;
+        swapChainCreateInfo.oldSwapchain = oldSwapchain ? oldSwapchain->getSwapchain() : VK_NULL_HANDLE;
 
-        VkSwapchainKHR swapchain{ VK_NULL_HANDLE };
         if (vkCreateSwapchainKHR(device->getLogicalDevice(), &swapChainCreateInfo, nullptr, &swapchain) != VK_SUCCESS)
         {
             throw std::runtime_error("Failed to create swapchain");
@@ -87,7 +113,7 @@ namespace siofraEngine::systems
         std::vector<VkImage> images(swapChainImageCount);
         vkGetSwapchainImagesKHR(device->getLogicalDevice(), swapchain, &swapChainImageCount, images.data());
 
-        std::vector<std::unique_ptr<IVulkanImage>> swapChainImages(images.size());
+        swapChainImages.resize(images.size());
         for (size_t i = 0; i < swapChainImages.size(); i++)
         {
             swapChainImages[i] = vulkanImageBuilder
@@ -98,27 +124,38 @@ namespace siofraEngine::systems
                 .build();
         }
 
-        VkFormat depthFormat{};
+        imageFormat = surfaceFormat.format;
         selectDepthFormat(
             device,
             { VK_FORMAT_D32_SFLOAT_S8_UINT, VK_FORMAT_D32_SFLOAT, VK_FORMAT_D24_UNORM_S8_UINT },
             VK_IMAGE_TILING_OPTIMAL,
             VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT,
-            depthFormat
+            depthAttachmentFormat
         );
 
-        std::unique_ptr<IVulkanImage> depthAttachment = vulkanImageBuilder
-            .withExistingImageHandle(VK_NULL_HANDLE)
-            .withDevice(device)
-            .withExtents(selectedExtents.width, selectedExtents.height)
-            .withFormat(depthFormat)
-            .withTiling(VK_IMAGE_TILING_OPTIMAL)
-            .withUsageFlags(VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT)
-            .withMemoryPropertyFlags(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
-            .withAspectFlags(VK_IMAGE_ASPECT_DEPTH_BIT)
-            .build();
-
-        return std::make_unique<VulkanSwapchain>(swapchain, surfaceFormat.format, depthFormat, selectedExtents, std::move(swapChainImages), std::move(depthAttachment), device);
+        // Depth contents are never stored, so the attachments can live in lazily allocated memory where the device provides it
+        VkMemoryPropertyFlags depthMemoryPropertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+        if (supportsLazilyAllocatedMemory(device))
+        {
+            depthMemoryPropertyFlags |= VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+        }
+
+        depthAttachments.resize(std::max<size_t>(swapChainImages.size() - 1, 1));
+        for (size_t i = 0; i < depthAttachments.size(); i++)
+        {
+            depthAttachments[i] = vulkanImageBuilder
+                .withExistingImageHandle(VK_NULL_HANDLE)
+                .withDevice(device)
+                .withExtents(selectedExtents.width, selectedExtents.height)
+                .withFormat(depthAttachmentFormat)
+                .withTiling(VK_IMAGE_TILING_OPTIMAL)
+                .withUsageFlags(VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT)
+                .withMemoryPropertyFlags(depthMemoryPropertyFlags)
+                .withAspectFlags(VK_IMAGE_ASPECT_DEPTH_BIT)
+                .build();
+        }
+
+        return true;
     }
 
     bool VulkanSwapchain::Builder::selectSurfaceFormat(IVulkanDevice const * device, IVulkanSurface const * surface, VkSurfaceFormatKHR& surfaceFormat) const
@@ -173,6 +210,7 @@ namespace siofraEngine::systems
         VkSurfaceCapabilitiesKHR surfaceCapabilities{ };
         vkGetPhysicalDeviceSurfaceCapabilitiesKHR(device->getPhysicalDevice(), surface->getSurface(), &surfaceCapabilities);
 
+        outExtents = extents;
         if (surfaceCapabilities.currentExtent.width != std::numeric_limits<uint32_t>::max())
         {
             outExtents = surfaceCapabilities.currentExtent;
@@ -213,4 +251,20 @@ namespace siofraEngine::systems
 
         return false;
     }
+
+    bool VulkanSwapchain::Builder::supportsLazilyAllocatedMemory(IVulkanDevice const * device) const
+    {
+        VkPhysicalDeviceMemoryProperties memoryProperties{ };
+        vkGetPhysicalDeviceMemoryProperties(device->getPhysicalDevice(), &memoryProperties);
+
+        for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++)
+        {
+            if ((memoryProperties.memoryTypes[i].propertyFlags & (VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT)) == (VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
 }
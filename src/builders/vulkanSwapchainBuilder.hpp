@@ -10,7 +10,7 @@ namespace siofraEngine::systems
     /**
      * @brief Vulkan swapchain builder
      */
-    class VulkanSwapchain::Builder : IVulkanSwapchainBuilder
+    class VulkanSwapchain::Builder : public IVulkanSwapchainBuilder
     {
     public:
         /**
@@ -45,6 +45,14 @@ namespace siofraEngine::systems
          */
         IVulkanSwapchainBuilder& withExtents(uint32_t width, uint32_t height) noexcept override;
 
+        /**
+         * @brief Specify the swapchain being replaced, allowing the driver to reuse its resources
+         * 
+         * @param oldSwapchain The swapchain being replaced
+         * @returns Reference to the builder
+         */
+        IVulkanSwapchainBuilder& withOldSwapchain(IVulkanSwapchain const * oldSwapchain) noexcept override;
+
         /**
          * @brief Build the Vulkan swapchain
          * 
@@ -52,6 +60,19 @@ namespace siofraEngine::systems
          */
         std::unique_ptr<IVulkanSwapchain> build() const override;
 
+        /**
+         * @brief Build the swapchain handle and attachments without wrapping them, allowing an existing swapchain to be recreated in place
+         * 
+         * @param swapchain The swapchain handle to populate
+         * @param imageFormat The swapchain image format to populate
+         * @param depthAttachmentFormat The depth attachment format to populate
+         * @param extents The swapchain extents to populate
+         * @param swapChainImages The swapchain images to populate
+         * @param depthAttachments The depth attachments to populate, one per frame in flight
+         * @returns True if the swapchain was built, false if the surface has a zero extent, such as when the window is minimised
+         */
+        bool buildHandles(VkSwapchainKHR & swapchain, VkFormat & imageFormat, VkFormat & depthAttachmentFormat, VkExtent2D & extents, std::vector<std::unique_ptr<IVulkanImage>> & swapChainImages, std::vector<std::unique_ptr<IVulkanImage>> & depthAttachments) const override;
+
     private:
         /**
          * @brief Vulkan image builder
@@ -73,6 +94,11 @@ namespace siofraEngine::systems
          */
         VkExtent2D extents{ 0, 0 };
 
+        /**
+         * @brief The swapchain being replaced
+         */
+        IVulkanSwapchain const * oldSwapchain{ nullptr };
+
         /**
          * @brief Select the surface format
          * 
@@ -116,5 +142,13 @@ namespace siofraEngine::systems
          * @returns True if format was selceted, otherwise false
          */
         bool selectDepthFormat(IVulkanDevice const * device, std::vector<VkFormat> const formats, VkImageTiling const tiling, VkFormatFeatureFlags const featureFlags, VkFormat& depthFormat) const;
+
+        /**
+         * @brief Check if the physical device provides lazily allocated memory for transient attachments
+         * 
+         * @param device The vulkan device to query
+         * @returns True if a lazily allocated memory type exists, otherwise false
+         */
+        bool supportsLazilyAllocatedMemory(IVulkanDevice const * device) const;
     };
 }
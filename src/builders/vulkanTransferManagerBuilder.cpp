@@ -0,0 +1,94 @@
+#include "systems/renderer/vulkan/vulkanComponents/builders/vulkanTransferManagerBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanTransferManager::Builder::Builder(IVulkanCommandPoolBuilder& vulkanCommandPoolBuilder, IVulkanCommandBufferBuilder& vulkanCommandBufferBuilder, IVulkanSemaphoreBuilder& vulkanSemaphoreBuilder, IVulkanFenceBuilder& vulkanFenceBuilder) :
+        vulkanCommandPoolBuilder{vulkanCommandPoolBuilder},
+        vulkanCommandBufferBuilder{vulkanCommandBufferBuilder},
+        vulkanSemaphoreBuilder{vulkanSemaphoreBuilder},
+        vulkanFenceBuilder{vulkanFenceBuilder}
+    {
+
+    }
+
+    IVulkanTransferManagerBuilder& VulkanTransferManager::Builder::withDevice(IVulkanDevice const * device) noexcept
+    {
+        this->device = device;
+        return *this;
+    }
+
+    IVulkanTransferManagerBuilder& VulkanTransferManager::Builder::withBatchCount(uint32_t batchCount) noexcept
+    {
+        this->batchCount = batchCount;
+        return *this;
+    }
+
+    IVulkanTransferManagerBuilder& VulkanTransferManager::Builder::withQueueMutex(std::mutex * queueMutex) noexcept
+    {
+        this->queueMutex = queueMutex;
+        return *this;
+    }
+
+    std::unique_ptr<IVulkanTransferManager> VulkanTransferManager::Builder::build() const
+    {
+        if (batchCount == 0)
+        {
+            throw std::runtime_error("Failed to create transfer manager, batch count must be non-zero");
+        }
+
+        if (queueMutex == nullptr)
+        {
+            throw std::runtime_error("Failed to create transfer manager, no queue mutex specified");
+        }
+
+        uint32_t transferFamilyIndex = device->getTransferQueue()->getFamilyIndex();
+        uint32_t graphicsFamilyIndex = device->getGraphicsQueue()->getFamilyIndex();
+        VkCommandPoolCreateFlags commandPoolFlags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+        auto transferCommandPool = vulkanCommandPoolBuilder
+            .withDevice(device)
+            .withFlags(commandPoolFlags)
+            .withQueueFamilyIndex(transferFamilyIndex)
+            .build();
+        auto transferCommandBuffers = vulkanCommandBufferBuilder
+            .withDevice(device)
+            .withCommandPool(transferCommandPool.get())
+            .withLevel(VK_COMMAND_BUFFER_LEVEL_PRIMARY)
+            .build(batchCount);
+
+        // Ownership acquire barriers must be recorded on the graphics queue family
+        std::unique_ptr<IVulkanCommandPool> acquireCommandPool{ nullptr };
+        std::vector<std::unique_ptr<IVulkanCommandBuffer>> acquireCommandBuffers{ };
+        if (transferFamilyIndex != graphicsFamilyIndex)
+        {
+            acquireCommandPool = vulkanCommandPoolBuilder
+                .withDevice(device)
+                .withFlags(commandPoolFlags)
+                .withQueueFamilyIndex(graphicsFamilyIndex)
+                .build();
+            acquireCommandBuffers = vulkanCommandBufferBuilder
+                .withDevice(device)
+                .withCommandPool(acquireCommandPool.get())
+                .withLevel(VK_COMMAND_BUFFER_LEVEL_PRIMARY)
+                .build(batchCount);
+        }
+
+        std::vector<std::unique_ptr<IVulkanSemaphore>> semaphores{ };
+        std::vector<std::unique_ptr<IVulkanFence>> fences{ };
+        for (uint32_t i = 0; i < batchCount; ++i)
+        {
+            semaphores.push_back(vulkanSemaphoreBuilder.withDevice(device).build());
+            fences.push_back(vulkanFenceBuilder.withDevice(device).build());
+        }
+
+        return std::make_unique<VulkanTransferManager>(
+            std::move(transferCommandPool),
+            std::move(transferCommandBuffers),
+            std::move(acquireCommandPool),
+            std::move(acquireCommandBuffers),
+            std::move(semaphores),
+            std::move(fences),
+            queueMutex,
+            device);
+    }
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <stdexcept>
+#include "systems/renderer/vulkan/vulkanComponents/vulkanTransferManager.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanTransferManagerBuilder.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanCommandPoolBuilder.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanCommandBufferBuilder.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanSemaphoreBuilder.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanFenceBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan transfer manager builder
+     */
+    class VulkanTransferManager::Builder : public IVulkanTransferManagerBuilder
+    {
+    public:
+        /**
+         * @brief Vulkan transfer manager builder constructor
+         * 
+         * @param vulkanCommandPoolBuilder Vulkan command pool builder
+         * @param vulkanCommandBufferBuilder Vulkan command buffer builder
+         * @param vulkanSemaphoreBuilder Vulkan semaphore builder
+         * @param vulkanFenceBuilder Vulkan fence builder
+         */
+        Builder(IVulkanCommandPoolBuilder& vulkanCommandPoolBuilder, IVulkanCommandBufferBuilder& vulkanCommandBufferBuilder, IVulkanSemaphoreBuilder& vulkanSemaphoreBuilder, IVulkanFenceBuilder& vulkanFenceBuilder);
+
+        /**
+         * @brief Specify the device the transfers are performed on
+         * 
+         * @param device The device the transfers are performed on
+         * @returns Reference to the builder
+         */
+        IVulkanTransferManagerBuilder& withDevice(IVulkanDevice const * device) noexcept override;
+
+        /**
+         * @brief Specify the number of batches which may be in flight at once
+         * 
+         * @param batchCount The number of batches
+         * @returns Reference to the builder
+         */
+        IVulkanTransferManagerBuilder& withBatchCount(uint32_t batchCount) noexcept override;
+
+        /**
+         * @brief Specify the mutex guarding submission to the device queues. The transfer manager holds it while submitting, and every other
+         * thread must hold it while submitting to or presenting on the graphics queue, or any queue sharing its handle
+         * 
+         * @param queueMutex The queue mutex
+         * @returns Reference to the builder
+         */
+        IVulkanTransferManagerBuilder& withQueueMutex(std::mutex * queueMutex) noexcept override;
+
+        /**
+         * @brief Build the Vulkan transfer manager
+         * 
+         * @returns The final Vulkan transfer manager
+         */
+        std::unique_ptr<IVulkanTransferManager> build() const override;
+
+    private:
+        /**
+         * @brief Vulkan command pool builder
+         */
+        IVulkanCommandPoolBuilder& vulkanCommandPoolBuilder;
+
+        /**
+         * @brief Vulkan command buffer builder
+         */
+        IVulkanCommandBufferBuilder& vulkanCommandBufferBuilder;
+
+        /**
+         * @brief Vulkan semaphore builder
+         */
+        IVulkanSemaphoreBuilder& vulkanSemaphoreBuilder;
+
+        /**
+         * @brief Vulkan fence builder
+         */
+        IVulkanFenceBuilder& vulkanFenceBuilder;
+
+        /**
+         * @brief The device the transfers are performed on
+         */
+        IVulkanDevice const * device{ nullptr };
+
+        /**
+         * @brief The number of batches which may be in flight at once
+         */
+        uint32_t batchCount{ 4 };
+
+        /**
+         * @brief The mutex guarding submission to the device queues
+         */
+        std::mutex * queueMutex{ nullptr };
+    };
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanComponent.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDescriptorSet.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDescriptorSetLayout.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanFence.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanImage.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanSampler.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanSemaphore.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan bindless texture table interface. Holds every texture in one descriptor array indexed from shaders
+     */
+    class IVulkanBindlessTextureTable : public IVulkanComponent
+    {
+    public:
+        /**
+         * @brief Add a texture to the table
+         * 
+         * @param image The texture image, in shader read only layout
+         * @param sampler The texture sampler
+         * @returns The stable index of the texture within the descriptor array
+         */
+        virtual uint32_t add(IVulkanImage const * image, IVulkanSampler const * sampler) = 0;
+
+        /**
+         * @brief Replace the texture at an index. The previous texture must no longer be accessed by any pending submission
+         * 
+         * @param index The texture index
+         * @param image The texture image, in shader read only layout
+         * @param sampler The texture sampler
+         */
+        virtual void update(uint32_t index, IVulkanImage const * image, IVulkanSampler const * sampler) = 0;
+
+        /**
+         * @brief Release an index. It is retired with the current frame and only reused once the frame is next begun, after the
+         * frame's submission has completed, so submissions still in flight may keep sampling the texture
+         * 
+         * @param index The texture index
+         */
+        virtual void remove(uint32_t index) = 0;
+
+        /**
+         * @brief Begin a frame. Waits for the fence signalled by the previous submission of the frame, then makes the indices removed
+         * during that submission's frame available for reuse
+         * 
+         * @param frameIndex Index of the frame in flight
+         * @param fence The fence signalled by the previous submission of the frame. The fence is not reset
+         */
+        virtual void beginFrame(uint32_t frameIndex, IVulkanFence const * fence) = 0;
+
+        /**
+         * @brief Begin a frame. Waits for a timeline semaphore to reach the value signalled by the previous submission of the frame,
+         * then makes the indices removed during that submission's frame available for reuse
+         * 
+         * @param frameIndex Index of the frame in flight
+         * @param timelineSemaphore The timeline semaphore signalled by the previous submission of the frame
+         * @param value The value signalled by the previous submission of the frame
+         */
+        virtual void beginFrame(uint32_t frameIndex, IVulkanSemaphore const * timelineSemaphore, uint64_t value) = 0;
+
+        /**
+         * @brief Get the maximum number of textures in the table
+         * 
+         * @returns The table capacity
+         */
+        virtual uint32_t getCapacity() const noexcept = 0;
+
+        /**
+         * @brief Get the layout of the table's descriptor set, for inclusion in pipeline layouts
+         * 
+         * @returns The descriptor set layout
+         */
+        virtual IVulkanDescriptorSetLayout const * getDescriptorSetLayout() const noexcept = 0;
+
+        /**
+         * @brief Get the table's descriptor set. It may stay bound while textures are added, updated and removed
+         * 
+         * @returns The descriptor set
+         */
+        virtual IVulkanDescriptorSet const * getDescriptorSet() const noexcept = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanBindlessTextureTable() = default;
+    };
+}
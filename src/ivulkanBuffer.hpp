@@ -28,6 +28,15 @@ namespace siofraEngine::systems
          */
         virtual void update(void const * data, size_t size) const = 0;
 
+        /**
+         * @brief Update a range of the buffer contents
+         * 
+         * @param data New data to copy to the buffer
+         * @param size Size of the data to copy in bytes
+         * @param offset Offset into the buffer at which to copy the data. Throws if the range exceeds the buffer memory
+         */
+        virtual void update(void const * data, size_t size, VkDeviceSize offset) const = 0;
+
         /**
          * @brief Copy the buffer to an image
          * 
@@ -1,9 +1,18 @@
 #pragma once
 
+#include <vector>
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanComponent.hpp"
 
 namespace siofraEngine::systems
 {
+    class IVulkanBuffer;
+    class IVulkanDevice;
+    class IVulkanPipeline;
+    class VulkanDescriptorWriteBatch;
+    class VulkanBarrierBatch;
+    class IVulkanRenderPass;
+    class IVulkanFramebuffer;
+
     /**
      * @brief Vulkan command buffer interface
      */
@@ -24,11 +33,130 @@ namespace siofraEngine::systems
          */
         virtual void begin(VkCommandBufferUsageFlags flags) const = 0;
 
+        /**
+         * @brief Start recording on a secondary command buffer which inherits render pass state
+         * 
+         * @param flags Usage behavior for the command buffer. Include VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT if the command buffer
+         * is executed entirely inside the render pass instance
+         * @param renderPass The render pass the command buffer is executed within
+         * @param framebuffer The framebuffer the command buffer renders to, or nullptr if it is not known
+         * @param subpass Index of the subpass the command buffer is executed within
+         */
+        virtual void begin(VkCommandBufferUsageFlags flags, IVulkanRenderPass const * renderPass, IVulkanFramebuffer const * framebuffer, uint32_t subpass) const = 0;
+
         /**
          * @brief Stop recording on the command buffer
          */
         virtual void end() const = 0;
 
+        /**
+         * @brief Get the barrier batch of the command buffer. Barriers added to it are recorded with a single pipeline barrier command
+         * at the next dispatch, render pass begin or end of recording. Commands recorded directly on the command buffer handle do not
+         * flush the batch, so flushBarriers must be called before them
+         * 
+         * @returns The barrier batch
+         */
+        virtual VulkanBarrierBatch & getBarrierBatch() const noexcept = 0;
+
+        /**
+         * @brief Record any pending barriers immediately
+         */
+        virtual void flushBarriers() const = 0;
+
+        /**
+         * @brief Record the execution of secondary command buffers. Inside a render pass the pass must have been begun with
+         * VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS. Pending barriers are not flushed, as they cannot be recorded inside a render pass,
+         * so outside a render pass flushBarriers must be called first
+         * 
+         * @param commandBuffers The secondary command buffers to execute, in order
+         */
+        virtual void executeCommands(std::vector<IVulkanCommandBuffer const *> const & commandBuffers) const = 0;
+
+        /**
+         * @brief Set the dynamic viewport
+         * 
+         * @param viewport The viewport
+         */
+        virtual void setViewport(VkViewport const & viewport) const = 0;
+
+        /**
+         * @brief Set the dynamic scissor rectangle
+         * 
+         * @param scissor The scissor rectangle
+         */
+        virtual void setScissor(VkRect2D const & scissor) const = 0;
+
+        /**
+         * @brief Set the dynamic cull mode. Requires the EXTENDED_DYNAMIC_STATE device feature
+         * 
+         * @param cullMode The cull mode
+         */
+        virtual void setCullMode(VkCullModeFlags cullMode) const = 0;
+
+        /**
+         * @brief Set the dynamic front face orientation. Requires the EXTENDED_DYNAMIC_STATE device feature
+         * 
+         * @param frontFace The front face orientation
+         */
+        virtual void setFrontFace(VkFrontFace frontFace) const = 0;
+
+        /**
+         * @brief Set the dynamic primitive topology. Requires the EXTENDED_DYNAMIC_STATE device feature
+         * 
+         * @param topology The primitive topology
+         */
+        virtual void setPrimitiveTopology(VkPrimitiveTopology topology) const = 0;
+
+        /**
+         * @brief Set if depth testing is dynamically enabled. Requires the EXTENDED_DYNAMIC_STATE device feature
+         * 
+         * @param depthTestEnable Indicates if depth testing is enabled
+         */
+        virtual void setDepthTestEnable(bool depthTestEnable) const = 0;
+
+        /**
+         * @brief Set if depth writes are dynamically enabled. Requires the EXTENDED_DYNAMIC_STATE device feature
+         * 
+         * @param depthWriteEnable Indicates if depth writes are enabled
+         */
+        virtual void setDepthWriteEnable(bool depthWriteEnable) const = 0;
+
+        /**
+         * @brief Set the dynamic depth comparison operator. Requires the EXTENDED_DYNAMIC_STATE device feature
+         * 
+         * @param depthCompareOp The depth comparison operator
+         */
+        virtual void setDepthCompareOp(VkCompareOp depthCompareOp) const = 0;
+
+        /**
+         * @brief Record a compute dispatch using the bound compute pipeline
+         * 
+         * @param groupCountX Number of local workgroups to dispatch in the X dimension
+         * @param groupCountY Number of local workgroups to dispatch in the Y dimension
+         * @param groupCountZ Number of local workgroups to dispatch in the Z dimension
+         */
+        virtual void dispatch(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) const = 0;
+
+        /**
+         * @brief Record a compute dispatch whose workgroup counts are read from a buffer
+         * 
+         * @param buffer Buffer containing a VkDispatchIndirectCommand
+         * @param offset Byte offset of the command within the buffer
+         */
+        virtual void dispatchIndirect(IVulkanBuffer const * buffer, VkDeviceSize offset) const = 0;
+
+        /**
+         * @brief Record descriptor writes directly into the command buffer, updating a push descriptor set of the pipeline's layout.
+         * The writes need no destination set, and nothing is allocated from a descriptor pool
+         * 
+         * @param pipeline The pipeline whose layout contains the push descriptor set layout
+         * @param pipelineBindPoint The pipeline bind point the descriptors are used at
+         * @param set The set number of the push descriptor set within the pipeline layout
+         * @param writeBatch The descriptor writes
+         * @param device The device with push descriptors enabled
+         */
+        virtual void pushDescriptorSet(IVulkanPipeline const * pipeline, VkPipelineBindPoint pipelineBindPoint, uint32_t set, VulkanDescriptorWriteBatch const & writeBatch, IVulkanDevice const * device) const = 0;
+
         /**
          * @brief Interface destructor
          */
@@ -17,6 +17,12 @@ namespace siofraEngine::systems
          */
         virtual VkCommandPool getCommandPool() const noexcept = 0;
 
+        /**
+         * @brief Reset the command pool, returning every command buffer allocated from it to the initial state.
+         * None of the command buffers may be pending execution
+         */
+        virtual void reset() const = 0;
+
         /**
          * @brief Interface destructor
          */
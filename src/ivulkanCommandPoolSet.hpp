@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanComponent.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanCommandPool.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan command pool set interface. Holds one command pool per recording thread for each frame in flight
+     */
+    class IVulkanCommandPoolSet : public IVulkanComponent
+    {
+    public:
+        /**
+         * @brief Get the command pool owned by a recording thread for a frame in flight. A command pool, and the command buffers
+         * allocated from it, must only be used by one thread at a time
+         * 
+         * @param frameIndex Index of the frame in flight
+         * @param threadIndex Index of the recording thread
+         * @returns The command pool
+         */
+        virtual IVulkanCommandPool const * getCommandPool(uint32_t frameIndex, uint32_t threadIndex) const = 0;
+
+        /**
+         * @brief Get the number of frames in flight
+         * 
+         * @returns The number of frames in flight
+         */
+        virtual uint32_t getFrameCount() const noexcept = 0;
+
+        /**
+         * @brief Get the number of recording threads
+         * 
+         * @returns The number of recording threads
+         */
+        virtual uint32_t getThreadCount() const noexcept = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanCommandPoolSet() = default;
+    };
+}
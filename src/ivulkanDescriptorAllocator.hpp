@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanComponent.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDescriptorSet.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDescriptorSetLayout.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan descriptor allocator interface. Allocates transient descriptor sets from growable per frame pools
+     */
+    class IVulkanDescriptorAllocator : public IVulkanComponent
+    {
+    public:
+        /**
+         * @brief Allocate a descriptor set from the current frame's pools. The set is valid until the frame is next begun
+         * 
+         * @param descriptorSetLayout The descriptor set layout
+         * @returns The descriptor set
+         */
+        virtual std::unique_ptr<IVulkanDescriptorSet> allocate(IVulkanDescriptorSetLayout const * descriptorSetLayout) = 0;
+
+        /**
+         * @brief Allocate descriptor sets from the current frame's pools with a single allocation. The sets are valid until the frame is next begun
+         * 
+         * @param descriptorSetLayout The descriptor set layout
+         * @param count Number of descriptor sets to allocate
+         * @returns The descriptor sets
+         */
+        virtual std::vector<std::unique_ptr<IVulkanDescriptorSet>> allocate(IVulkanDescriptorSetLayout const * descriptorSetLayout, uint32_t count) = 0;
+
+        /**
+         * @brief Begin allocating for a frame, resetting every pool the frame allocated from. The frame's previous submission must have completed
+         * 
+         * @param frameIndex Index of the frame in flight
+         */
+        virtual void beginFrame(uint32_t frameIndex) = 0;
+
+        /**
+         * @brief Get the number of descriptor pools created across all frames
+         * 
+         * @returns The number of descriptor pools
+         */
+        virtual size_t getPoolCount() const noexcept = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanDescriptorAllocator() = default;
+    };
+}
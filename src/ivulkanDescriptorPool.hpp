@@ -17,6 +17,11 @@ namespace siofraEngine::systems
          */
         virtual VkDescriptorPool getDescriptorPool() const noexcept = 0;
 
+        /**
+         * @brief Return every descriptor set allocated from the pool to the pool. The sets must no longer be in use by the device
+         */
+        virtual void reset() const = 0;
+
         /**
          * @brief Interface destructor
          */
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <string>
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanComponent.hpp"
 
 namespace siofraEngine::systems
@@ -17,6 +18,13 @@ namespace siofraEngine::systems
          */
         virtual VkDescriptorSetLayout getDescriptorSetLayout() const noexcept = 0;
 
+        /**
+         * @brief Get a key identifying the create flags and bindings of the layout. Equal keys identify compatible layouts, regardless of handle values
+         * 
+         * @returns The state key
+         */
+        virtual std::string const & getStateKey() const noexcept = 0;
+
         /**
          * @brief Interface destructor
          */
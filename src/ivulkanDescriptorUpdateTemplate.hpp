@@ -0,0 +1,34 @@
+#pragma once
+
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanComponent.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDescriptorSet.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan descriptor update template interface
+     */
+    class IVulkanDescriptorUpdateTemplate : public IVulkanComponent
+    {
+    public:
+        /**
+         * @brief Get the Vulkan descriptor update template handle
+         * 
+         * @returns The Vulkan descriptor update template handle
+         */
+        virtual VkDescriptorUpdateTemplate getDescriptorUpdateTemplate() const noexcept = 0;
+
+        /**
+         * @brief Update every descriptor covered by the template with a single call
+         * 
+         * @param descriptorSet The descriptor set to update, which must use the template's descriptor set layout
+         * @param data Packed descriptor infos laid out as described by the template entries
+         */
+        virtual void update(IVulkanDescriptorSet const * descriptorSet, void const * data) const = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanDescriptorUpdateTemplate() = default;
+    };
+}
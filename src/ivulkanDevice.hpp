@@ -3,9 +3,33 @@
 #include <memory>
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanComponent.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanQueue.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanMemoryAllocator.hpp"
 
 namespace siofraEngine::systems
 {
+    /**
+     * @brief Flags to specify optional Vulkan device features
+     */
+    enum class VulkanDeviceFeatures
+    {
+        NONE = 0,
+        TIMELINE_SEMAPHORE = 1 << 0,
+        EXTENDED_DYNAMIC_STATE = 1 << 1,
+        DESCRIPTOR_INDEXING = 1 << 2,
+        PUSH_DESCRIPTOR = 1 << 3,
+        SYNCHRONIZATION_2 = 1 << 4
+    };
+
+    inline VulkanDeviceFeatures operator|(VulkanDeviceFeatures a, VulkanDeviceFeatures b)
+    {
+        return static_cast<VulkanDeviceFeatures>(static_cast<int>(a) | static_cast<int>(b));
+    }
+
+    inline VulkanDeviceFeatures operator&(VulkanDeviceFeatures a, VulkanDeviceFeatures b)
+    {
+        return static_cast<VulkanDeviceFeatures>(static_cast<int>(a) & static_cast<int>(b));
+    }
+
     /**
      * @brief Vulkan device interface
      */
@@ -54,6 +78,28 @@ namespace siofraEngine::systems
          */
         virtual std::unique_ptr<IVulkanQueue> const & getComputeQueue() const noexcept = 0;
 
+        /**
+         * @brief Get the device memory allocator
+         * 
+         * @returns The device memory allocator
+         */
+        virtual std::unique_ptr<IVulkanMemoryAllocator> const & getMemoryAllocator() const noexcept = 0;
+
+        /**
+         * @brief Check if an optional device feature was enabled when the device was created
+         * 
+         * @param feature The feature to check
+         * @returns True if the feature is enabled, otherwise false
+         */
+        virtual bool isFeatureEnabled(VulkanDeviceFeatures feature) const noexcept = 0;
+
+        /**
+         * @brief Get the push descriptor command, loaded from the VK_KHR_push_descriptor extension
+         * 
+         * @returns The push descriptor command, or nullptr if push descriptors are not enabled
+         */
+        virtual PFN_vkCmdPushDescriptorSetKHR getCmdPushDescriptorSet() const noexcept = 0;
+
         /**
          * @brief Interface destructor
          */
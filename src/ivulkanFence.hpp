@@ -17,6 +17,23 @@ namespace siofraEngine::systems
          */
         virtual VkFence getFence() const noexcept = 0;
 
+        /**
+         * @brief Block until the fence is signaled
+         */
+        virtual void wait() const = 0;
+
+        /**
+         * @brief Reset the fence to the unsignaled state
+         */
+        virtual void reset() const = 0;
+
+        /**
+         * @brief Check if the fence is signaled without blocking
+         * 
+         * @returns True if the fence is signaled, otherwise false
+         */
+        virtual bool isSignaled() const = 0;
+
         /**
          * @brief Interface destructor
          */
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanComponent.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanCommandBuffer.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanFence.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanSemaphore.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan frame command allocator interface. Hands out command buffers from per frame command pools which are reset as a whole
+     * once the frame's GPU work has completed
+     */
+    class IVulkanFrameCommandAllocator : public IVulkanComponent
+    {
+    public:
+        /**
+         * @brief Begin recording a frame. Waits for the fence signalled by the previous submission of the frame, then resets the frame's
+         * command pools, recycling every command buffer allocated from them. No thread may be allocating while a frame begins
+         * 
+         * @param frameIndex Index of the frame in flight
+         * @param fence The fence signalled by the previous submission of the frame. Create it signalled so the first frame does not block. The fence is not reset
+         */
+        virtual void beginFrame(uint32_t frameIndex, IVulkanFence const * fence) = 0;
+
+        /**
+         * @brief Begin recording a frame. Waits for a timeline semaphore to reach the value signalled by the previous submission of the frame,
+         * then resets the frame's command pools, recycling every command buffer allocated from them. No thread may be allocating while a frame begins
+         * 
+         * @param frameIndex Index of the frame in flight
+         * @param timelineSemaphore The timeline semaphore signalled by the previous submission of the frame
+         * @param value The value signalled by the previous submission of the frame
+         */
+        virtual void beginFrame(uint32_t frameIndex, IVulkanSemaphore const * timelineSemaphore, uint64_t value) = 0;
+
+        /**
+         * @brief Get the next free command buffer of the current frame for a recording thread. Command buffers are handed out in order and
+         * remain valid until the frame is next begun. Each thread must only allocate with its own index
+         * 
+         * @param threadIndex Index of the recording thread
+         * @param level The command buffer level
+         * @returns The command buffer, in the initial state
+         */
+        virtual IVulkanCommandBuffer const * allocate(uint32_t threadIndex, VkCommandBufferLevel level) = 0;
+
+        /**
+         * @brief Get the index of the frame currently being recorded
+         * 
+         * @returns The index of the current frame in flight
+         */
+        virtual uint32_t getFrameIndex() const noexcept = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanFrameCommandAllocator() = default;
+    };
+}
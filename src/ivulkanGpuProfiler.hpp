@@ -0,0 +1,106 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanComponent.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanCommandBuffer.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanRenderPass.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Rolling GPU timing statistics of a profiler scope, in milliseconds
+     */
+    struct VulkanGpuScopeStatistics
+    {
+        /**
+         * @brief Shortest recorded duration
+         */
+        double minimum{ 0.0 };
+
+        /**
+         * @brief Mean recorded duration
+         */
+        double average{ 0.0 };
+
+        /**
+         * @brief Longest recorded duration
+         */
+        double maximum{ 0.0 };
+
+        /**
+         * @brief Number of durations the statistics are calculated from
+         */
+        uint32_t sampleCount{ 0 };
+    };
+
+    /**
+     * @brief Vulkan GPU profiler interface. Measures named scopes of command buffers with timestamp queries
+     */
+    class IVulkanGpuProfiler : public IVulkanComponent
+    {
+    public:
+        /**
+         * @brief Begin profiling a frame in flight. Collects the results last recorded for the frame, if available, then resets its queries.
+         * Must be recorded outside of a render pass, after the previous use of the frame has completed
+         * 
+         * @param commandBuffer The command buffer in which to record the command
+         * @param frameIndex Index of the frame in flight
+         */
+        virtual void beginFrame(IVulkanCommandBuffer const * commandBuffer, uint32_t frameIndex) = 0;
+
+        /**
+         * @brief Begin a named scope. Scopes may be nested
+         * 
+         * @param commandBuffer The command buffer in which to record the command
+         * @param name The scope name
+         */
+        virtual void beginScope(IVulkanCommandBuffer const * commandBuffer, std::string const & name) = 0;
+
+        /**
+         * @brief End the most recently begun scope
+         * 
+         * @param commandBuffer The command buffer in which to record the command
+         */
+        virtual void endScope(IVulkanCommandBuffer const * commandBuffer) = 0;
+
+        /**
+         * @brief Begin a render pass within a named scope
+         * 
+         * @param commandBuffer The command buffer in which to record the command
+         * @param renderPass The render pass to begin
+         * @param imageIndex Index of the acquired swapchain image
+         * @param frameIndex Index of the frame in flight being recorded
+         * @param name The scope name
+         */
+        virtual void beginRenderPass(IVulkanCommandBuffer const * commandBuffer, IVulkanRenderPass const * renderPass, uint32_t imageIndex, uint32_t frameIndex, std::string const & name) = 0;
+
+        /**
+         * @brief End a render pass and the scope begun with it
+         * 
+         * @param commandBuffer The command buffer in which to record the command
+         * @param renderPass The render pass to end
+         */
+        virtual void endRenderPass(IVulkanCommandBuffer const * commandBuffer, IVulkanRenderPass const * renderPass) = 0;
+
+        /**
+         * @brief Get the statistics of a scope
+         * 
+         * @param name The scope name
+         * @returns The scope statistics, with a sample count of zero if the scope has no results yet
+         */
+        virtual VulkanGpuScopeStatistics getStatistics(std::string const & name) const = 0;
+
+        /**
+         * @brief Get the statistics of every scope with results
+         * 
+         * @returns The scope statistics keyed by scope name
+         */
+        virtual std::unordered_map<std::string, VulkanGpuScopeStatistics> getStatistics() const = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanGpuProfiler() = default;
+    };
+}
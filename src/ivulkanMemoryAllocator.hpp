@@ -0,0 +1,90 @@
+#pragma once
+
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanComponent.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief A region of device memory sub-allocated from a larger memory block
+     */
+    struct VulkanMemoryAllocation
+    {
+        /**
+         * @brief The device memory block containing the allocation
+         */
+        VkDeviceMemory memory{ VK_NULL_HANDLE };
+
+        /**
+         * @brief Offset of the allocation within the device memory block
+         */
+        VkDeviceSize offset{ 0 };
+
+        /**
+         * @brief Size of the allocation in bytes
+         */
+        VkDeviceSize size{ 0 };
+
+        /**
+         * @brief Index of the memory type from which the allocation was made
+         */
+        uint32_t memoryTypeIndex{ 0 };
+
+        /**
+         * @brief Opaque handle to the allocator owned block from which the allocation was made
+         */
+        void * block{ nullptr };
+    };
+
+    /**
+     * @brief Vulkan device memory allocator interface
+     */
+    class IVulkanMemoryAllocator : public IVulkanComponent
+    {
+    public:
+        /**
+         * @brief Allocate device memory satisfying the given requirements
+         *
+         * @param memoryRequirements The memory requirements of the resource the allocation is for
+         * @param memoryPropertyFlags The desired memory property flags
+         * @param linear Indicates if the resource is a buffer or linearly tiled image
+         * @returns The memory allocation
+         */
+        virtual VulkanMemoryAllocation allocate(VkMemoryRequirements const & memoryRequirements, VkMemoryPropertyFlags memoryPropertyFlags, bool linear) = 0;
+
+        /**
+         * @brief Return an allocation to the allocator
+         *
+         * @param allocation The allocation to free
+         */
+        virtual void free(VulkanMemoryAllocation const & allocation) = 0;
+
+        /**
+         * @brief Map an allocation into host memory. The memory must be host visible
+         *
+         * @param allocation The allocation to map
+         * @returns Pointer to the start of the mapped allocation
+         */
+        virtual void * map(VulkanMemoryAllocation const & allocation) = 0;
+
+        /**
+         * @brief Unmap an allocation previously mapped with map
+         *
+         * @param allocation The allocation to unmap
+         */
+        virtual void unmap(VulkanMemoryAllocation const & allocation) = 0;
+
+        /**
+         * @brief Flush host writes to an allocation so they are visible to the device. Does nothing for host coherent memory
+         *
+         * @param allocation The mapped allocation
+         * @param offset Offset of the written range, relative to the start of the allocation
+         * @param size Size of the written range in bytes
+         */
+        virtual void flush(VulkanMemoryAllocation const & allocation, VkDeviceSize offset, VkDeviceSize size) const = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanMemoryAllocator() = default;
+    };
+}
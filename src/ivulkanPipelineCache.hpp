@@ -0,0 +1,32 @@
+#pragma once
+
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanComponent.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan pipeline cache interface
+     */
+    class IVulkanPipelineCache : public IVulkanComponent
+    {
+    public:
+        /**
+         * @brief Get the vulkan pipeline cache handle
+         * 
+         * @returns The vulkan pipeline cache handle
+         */
+        virtual VkPipelineCache getPipelineCache() const noexcept = 0;
+
+        /**
+         * @brief Write the pipeline cache contents to disk
+         * 
+         * @returns True if the pipeline cache was written, otherwise false
+         */
+        virtual bool save() const = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanPipelineCache() = default;
+    };
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <future>
+#include <memory>
+#include <vector>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanComponent.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanPipeline.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanPipelineBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan pipeline compiler interface. Builds pipelines asynchronously
+     */
+    class IVulkanPipelineCompiler : public IVulkanComponent
+    {
+    public:
+        /**
+         * @brief Queue a configured pipeline builder for compilation
+         * 
+         * @param pipelineBuilder The configured pipeline builder
+         * @returns Future which receives the compiled pipeline, or the exception thrown while building it
+         */
+        virtual std::future<std::unique_ptr<IVulkanPipeline>> compile(std::unique_ptr<IVulkanPipelineBuilder> pipelineBuilder) = 0;
+
+        /**
+         * @brief Queue several configured pipeline builders for compilation
+         * 
+         * @param pipelineBuilders The configured pipeline builders
+         * @returns Futures which receive the compiled pipelines, in the order of the builders
+         */
+        virtual std::vector<std::future<std::unique_ptr<IVulkanPipeline>>> compile(std::vector<std::unique_ptr<IVulkanPipelineBuilder>> pipelineBuilders) = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanPipelineCompiler() = default;
+    };
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanComponent.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan pipeline layout interface
+     */
+    class IVulkanPipelineLayout : public IVulkanComponent
+    {
+    public:
+        /**
+         * @brief Get the Vulkan pipeline layout handle
+         * 
+         * @returns The Vulkan pipeline layout handle
+         */
+        virtual VkPipelineLayout getPipelineLayout() const noexcept = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanPipelineLayout() = default;
+    };
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanComponent.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanPipelineLayout.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanPipelineLayoutBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan pipeline layout cache interface. Shares one pipeline layout between all requests for identical layout state
+     */
+    class IVulkanPipelineLayoutCache : public IVulkanComponent
+    {
+    public:
+        /**
+         * @brief Get the pipeline layout matching the state of a pipeline layout builder, building it on first request
+         * 
+         * @param pipelineLayoutBuilder The configured pipeline layout builder
+         * @returns The shared pipeline layout
+         */
+        virtual std::shared_ptr<IVulkanPipelineLayout> getOrCreate(IVulkanPipelineLayoutBuilder const & pipelineLayoutBuilder) = 0;
+
+        /**
+         * @brief Get the number of cached pipeline layouts
+         * 
+         * @returns The number of cached pipeline layouts
+         */
+        virtual size_t size() const noexcept = 0;
+
+        /**
+         * @brief Release the cache's references to its pipeline layouts. Layouts still used by pipelines are destroyed with their last pipeline
+         */
+        virtual void clear() = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanPipelineLayoutCache() = default;
+    };
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanComponent.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanPipeline.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanPipelineBuilder.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanComputePipelineBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan pipeline registry interface. Shares pipelines between requests for identical pipeline state
+     */
+    class IVulkanPipelineRegistry : public IVulkanComponent
+    {
+    public:
+        /**
+         * @brief Get the pipeline matching the state of a graphics pipeline builder, building it if no matching pipeline is alive
+         * 
+         * @param pipelineBuilder The configured pipeline builder
+         * @returns The shared pipeline
+         */
+        virtual std::shared_ptr<IVulkanPipeline> getOrCreate(IVulkanPipelineBuilder const & pipelineBuilder) = 0;
+
+        /**
+         * @brief Get the pipeline matching the state of a compute pipeline builder, building it if no matching pipeline is alive
+         * 
+         * @param pipelineBuilder The configured compute pipeline builder
+         * @returns The shared pipeline
+         */
+        virtual std::shared_ptr<IVulkanPipeline> getOrCreate(IVulkanComputePipelineBuilder const & pipelineBuilder) = 0;
+
+        /**
+         * @brief Get the number of requests served by an existing pipeline
+         * 
+         * @returns The number of hits
+         */
+        virtual uint64_t getHitCount() const noexcept = 0;
+
+        /**
+         * @brief Get the number of requests which built a new pipeline
+         * 
+         * @returns The number of misses
+         */
+        virtual uint64_t getMissCount() const noexcept = 0;
+
+        /**
+         * @brief Remove the entries of pipelines which are no longer referenced
+         */
+        virtual void purge() = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanPipelineRegistry() = default;
+    };
+}
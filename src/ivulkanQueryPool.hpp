@@ -0,0 +1,69 @@
+#pragma once
+
+#include <vector>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanComponent.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanCommandBuffer.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan query pool interface
+     */
+    class IVulkanQueryPool : public IVulkanComponent
+    {
+    public:
+        /**
+         * @brief Get the vulkan query pool handle
+         * 
+         * @returns The vulkan query pool handle
+         */
+        virtual VkQueryPool getQueryPool() const noexcept = 0;
+
+        /**
+         * @brief Get the type of the queries in the pool
+         * 
+         * @returns The query type
+         */
+        virtual VkQueryType getQueryType() const noexcept = 0;
+
+        /**
+         * @brief Get the number of queries in the pool
+         * 
+         * @returns The number of queries
+         */
+        virtual uint32_t getQueryCount() const noexcept = 0;
+
+        /**
+         * @brief Record a reset of a range of queries. Must be recorded outside of a render pass
+         * 
+         * @param commandBuffer The command buffer in which to record the command
+         * @param firstQuery Index of the first query to reset
+         * @param queryCount Number of queries to reset
+         */
+        virtual void reset(IVulkanCommandBuffer const * commandBuffer, uint32_t firstQuery, uint32_t queryCount) const = 0;
+
+        /**
+         * @brief Record a timestamp write once all previous commands have reached a pipeline stage
+         * 
+         * @param commandBuffer The command buffer in which to record the command
+         * @param pipelineStage The pipeline stage to wait for
+         * @param query Index of the query to write
+         */
+        virtual void writeTimestamp(IVulkanCommandBuffer const * commandBuffer, VkPipelineStageFlagBits pipelineStage, uint32_t query) const = 0;
+
+        /**
+         * @brief Read back the 64 bit results of a range of queries without waiting for them to become available
+         * 
+         * @param firstQuery Index of the first query to read
+         * @param queryCount Number of queries to read
+         * @param results The results to populate
+         * @returns True if every result was available, otherwise false
+         */
+        virtual bool getResults(uint32_t firstQuery, uint32_t queryCount, std::vector<uint64_t> & results) const = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanQueryPool() = default;
+    };
+}
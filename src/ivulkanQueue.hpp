@@ -8,6 +8,8 @@
 
 namespace siofraEngine::systems
 {
+    class VulkanSubmitBatch;
+
     /**
      * @brief Vulkan queue interface
      */
@@ -45,14 +47,47 @@ namespace siofraEngine::systems
          */
         virtual void submit(IVulkanCommandBuffer const * commandBuffer) const = 0;
 
+        /**
+         * @brief Submits a command buffer to the queue
+         * 
+         * @param waitSemaphore Optional semaphore upon which to wait before the command buffer will begin execution
+         * @param waitStage Pipeline stages at which the wait on the semaphore occurs. Stages without a legacy equivalent are widened when synchronization2 is not enabled
+         * @param signalSemaphore Optional semaphore which will be signaled when the command buffer has completed execution
+         * @param fence Optional fence to be signaled once the submitted command buffer has completed execution
+         * @param commandBuffer Command buffer to execute
+         */
+        virtual void submit(IVulkanSemaphore const * waitSemaphore, VkPipelineStageFlags2 waitStage, IVulkanSemaphore const * signalSemaphore, IVulkanFence const * fence, IVulkanCommandBuffer const * commandBuffer) const = 0;
+
+        /**
+         * @brief Submits a command buffer to the queue, waiting on and signaling timeline semaphore values
+         * 
+         * @param waitSemaphore Optional semaphore upon which to wait before the command buffer will begin execution
+         * @param waitValue Counter value to wait for if the wait semaphore is a timeline semaphore
+         * @param waitStage Pipeline stages at which the wait on the semaphore occurs. Stages without a legacy equivalent are widened when synchronization2 is not enabled
+         * @param signalSemaphore Optional semaphore which will be signaled when the command buffer has completed execution
+         * @param signalValue Counter value to signal if the signal semaphore is a timeline semaphore
+         * @param fence Optional fence to be signaled once the submitted command buffer has completed execution
+         * @param commandBuffer Command buffer to execute
+         */
+        virtual void submit(IVulkanSemaphore const * waitSemaphore, uint64_t waitValue, VkPipelineStageFlags2 waitStage, IVulkanSemaphore const * signalSemaphore, uint64_t signalValue, IVulkanFence const * fence, IVulkanCommandBuffer const * commandBuffer) const = 0;
+
+        /**
+         * @brief Submits every submission in a batch with a single queue submit call, using vkQueueSubmit2 when synchronization2 is enabled
+         * 
+         * @param submitBatch The submissions to execute, in order
+         * @param fence Optional fence to be signaled once all submissions have completed execution
+         */
+        virtual void submit(VulkanSubmitBatch const & submitBatch, IVulkanFence const * fence) const = 0;
+
         /**
          * @brief Queue an image for presentation
          * 
          * @param waitSemaphore Semaphore to wait for before issuing the present request
          * @param swapchain The swapchain
          * @param imageIndex Index of the swapchain image to present
+         * @returns VK_SUCCESS, VK_SUBOPTIMAL_KHR or VK_ERROR_OUT_OF_DATE_KHR. The swapchain should be recreated for the latter two
          */
-        virtual void present(IVulkanSemaphore const * waitSemaphore, IVulkanSwapchain const * swapchain, uint32_t imageIndex) const = 0;
+        virtual VkResult present(IVulkanSemaphore const * waitSemaphore, IVulkanSwapchain const * swapchain, uint32_t imageIndex) const = 0;
 
         /**
          * @brief Wait for the queue to become idle
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <vector>
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanComponent.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanFramebuffer.hpp"
@@ -8,6 +9,9 @@
 
 namespace siofraEngine::systems
 {
+    class IVulkanSwapchain;
+    class IVulkanFramebufferBuilder;
+
     /**
      * @brief Vulkan render pass interface
      */
@@ -22,19 +26,68 @@ namespace siofraEngine::systems
         virtual VkRenderPass getRenderPass() const noexcept = 0;
 
         /**
-         * @brief Get the vulkan render pass framebuffers
+         * @brief Get a key identifying the attachments and subpasses which determine render pass compatibility. Equal keys identify compatible render passes, regardless of handle values
+         * 
+         * @returns The state key
+         */
+        virtual std::string const & getStateKey() const noexcept = 0;
+
+        /**
+         * @brief Get the vulkan render pass framebuffers. Framebuffers are grouped by frame in flight, each group holding one framebuffer per swapchain image
          * 
          * @returns The vulkan render pass framebuffers
          */
         virtual std::vector<std::unique_ptr<IVulkanFramebuffer>> const & getFramebuffers() const noexcept = 0;
 
         /**
-         * @brief Begin the render pass
+         * @brief Begin the render pass using the framebuffer pairing a swapchain image with the depth attachment of frame in flight 0.
+         * Deprecated, as every frame in flight then shares one depth attachment. Use the overload taking a frame index instead
+         * 
+         * @param commandBuffer The command buffer in which to record the command
+         * @param imageIndex Index of the acquired swapchain image
+         */
+        [[deprecated("Use begin(commandBuffer, imageIndex, frameIndex)")]]
+        virtual void begin(IVulkanCommandBuffer const * commandBuffer, uint32_t imageIndex) const = 0;
+
+        /**
+         * @brief Begin the render pass using the framebuffer pairing a swapchain image with the depth attachment of frame in flight 0,
+         * specifying how the commands of the first subpass are provided. Deprecated, as every frame in flight then shares one depth attachment.
+         * Use the overload taking a frame index instead
+         * 
+         * @param commandBuffer The command buffer in which to record the command
+         * @param imageIndex Index of the acquired swapchain image
+         * @param contents VK_SUBPASS_CONTENTS_INLINE, or VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS if the subpass is recorded into secondary command buffers
+         */
+        [[deprecated("Use begin(commandBuffer, imageIndex, frameIndex, contents)")]]
+        virtual void begin(IVulkanCommandBuffer const * commandBuffer, uint32_t imageIndex, VkSubpassContents contents) const = 0;
+
+        /**
+         * @brief Recreate the framebuffers from the images of a recreated swapchain. The previous framebuffers are retired to the swapchain
+         * 
+         * @param swapchain The recreated swapchain
+         * @param vulkanFramebufferBuilder Builder used to create the framebuffers
+         */
+        virtual void recreateFramebuffers(IVulkanSwapchain const * swapchain, IVulkanFramebufferBuilder & vulkanFramebufferBuilder) = 0;
+
+        /**
+         * @brief Begin the render pass using the framebuffer pairing a swapchain image with the depth attachment of a frame in flight
+         * 
+         * @param commandBuffer The command buffer in which to record the command
+         * @param imageIndex Index of the acquired swapchain image
+         * @param frameIndex Index of the frame in flight being recorded
+         */
+        virtual void begin(IVulkanCommandBuffer const * commandBuffer, uint32_t imageIndex, uint32_t frameIndex) const = 0;
+
+        /**
+         * @brief Begin the render pass using the framebuffer pairing a swapchain image with the depth attachment of a frame in flight,
+         * specifying how the commands of the first subpass are provided
          * 
          * @param commandBuffer The command buffer in which to record the command
-         * @param framebufferIndex The framebuffer containing the attachments that are used with the render pass
+         * @param imageIndex Index of the acquired swapchain image
+         * @param frameIndex Index of the frame in flight being recorded
+         * @param contents VK_SUBPASS_CONTENTS_INLINE, or VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS if the subpass is recorded into secondary command buffers
          */
-        virtual void begin(IVulkanCommandBuffer const * commandBuffer, uint32_t framebufferIndex) const = 0;
+        virtual void begin(IVulkanCommandBuffer const * commandBuffer, uint32_t imageIndex, uint32_t frameIndex, VkSubpassContents contents) const = 0;
 
         /**
          * @brief End the render pass
@@ -17,6 +17,34 @@ namespace siofraEngine::systems
          */
         virtual VkSemaphore getSemaphore() const noexcept = 0;
 
+        /**
+         * @brief Get the semaphore type
+         * 
+         * @returns The semaphore type
+         */
+        virtual VkSemaphoreType getType() const noexcept = 0;
+
+        /**
+         * @brief Set the counter of a timeline semaphore from the host
+         * 
+         * @param value The new counter value, which must be greater than the current value
+         */
+        virtual void signal(uint64_t value) const = 0;
+
+        /**
+         * @brief Block until the counter of a timeline semaphore reaches a value
+         * 
+         * @param value The counter value to wait for
+         */
+        virtual void wait(uint64_t value) const = 0;
+
+        /**
+         * @brief Get the current counter value of a timeline semaphore
+         * 
+         * @returns The current counter value
+         */
+        virtual uint64_t getCounterValue() const = 0;
+
         /**
          * @brief Interface destructor
          */
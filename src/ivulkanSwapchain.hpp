@@ -4,14 +4,17 @@
 #include <memory>
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanComponent.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanImage.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanFence.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanSemaphore.hpp"
 
 namespace siofraEngine::systems
 {
+    class IVulkanSwapchainBuilder;
+
     /**
      * @brief Vulkan swapchain interface
      */
-    class IVulkanSwapchain : IVulkanComponent
+    class IVulkanSwapchain : public IVulkanComponent
     {
     public:
         /**
@@ -48,11 +51,11 @@ namespace siofraEngine::systems
         virtual std::vector<std::unique_ptr<IVulkanImage>> const & getSwapchainImages() const noexcept = 0;
 
         /**
-         * @brief Get swapchain depth attahcment
+         * @brief Get swapchain depth attachments, one per frame in flight
          * 
-         * @returns The swapchain depth attahcment
+         * @returns The swapchain depth attachments
          */
-        virtual std::unique_ptr<IVulkanImage> const & getDepthAttachment() const noexcept = 0;
+        virtual std::vector<std::unique_ptr<IVulkanImage>> const & getDepthAttachments() const noexcept = 0;
 
         /**
          * @brief Get maximum number of frames which can be rendered to
@@ -69,6 +72,48 @@ namespace siofraEngine::systems
          */
         virtual uint32_t acquireNextImage(IVulkanSemaphore const * semaphore) const = 0;
 
+        /**
+         * @brief Retrieve the index of the next available presentable image without throwing when the swapchain no longer matches the surface
+         * 
+         * @param semaphore A semaphore to signal
+         * @param imageIndex The index of the next available presentable image
+         * @returns VK_SUCCESS, VK_SUBOPTIMAL_KHR if the image can be used but the swapchain should be recreated, or VK_ERROR_OUT_OF_DATE_KHR if no image was acquired and the swapchain must be recreated
+         */
+        virtual VkResult acquireNextImage(IVulkanSemaphore const * semaphore, uint32_t & imageIndex) const = 0;
+
+        /**
+         * @brief Recreate the swapchain in place, handing the current swapchain to the driver as the old swapchain.
+         * The replaced swapchain, images and depth attachments are retired until a fence signals
+         * 
+         * @param width The requested swapchain width
+         * @param height The requested swapchain height
+         * @param vulkanSwapchainBuilder Builder used to create the replacement swapchain
+         * @param fence The fence signalled by the latest submission which may use the current swapchain
+         * @returns True if the swapchain was recreated, false if the surface has a zero extent, such as when the window is minimised
+         */
+        virtual bool recreate(uint32_t width, uint32_t height, IVulkanSwapchainBuilder & vulkanSwapchainBuilder, IVulkanFence const * fence) = 0;
+
+        /**
+         * @brief Recreate the swapchain in place, handing the current swapchain to the driver as the old swapchain.
+         * The replaced swapchain, images and depth attachments are retired until a timeline semaphore reaches a value
+         * 
+         * @param width The requested swapchain width
+         * @param height The requested swapchain height
+         * @param vulkanSwapchainBuilder Builder used to create the replacement swapchain
+         * @param timelineSemaphore The timeline semaphore signalled by the latest submission which may use the current swapchain
+         * @param value The value signalled by the latest submission which may use the current swapchain
+         * @returns True if the swapchain was recreated, false if the surface has a zero extent, such as when the window is minimised
+         */
+        virtual bool recreate(uint32_t width, uint32_t height, IVulkanSwapchainBuilder & vulkanSwapchainBuilder, IVulkanSemaphore const * timelineSemaphore, uint64_t value) = 0;
+
+        /**
+         * @brief Defer destruction of a resource replaced alongside the latest recreation of the swapchain, such as a framebuffer,
+         * until the submission that recreation waits on has completed
+         * 
+         * @param resource The resource to retire
+         */
+        virtual void retire(std::unique_ptr<IVulkanComponent> resource) const = 0;
+
         /**
          * @brief Interface destructor
          */
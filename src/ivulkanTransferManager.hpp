@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanComponent.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanBuffer.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanImage.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan transfer manager interface. Records uploads into batches submitted to the transfer queue
+     */
+    class IVulkanTransferManager : public IVulkanComponent
+    {
+    public:
+        /**
+         * @brief Record a copy between buffers into the current batch. The destination is made available to the graphics queue
+         *
+         * @param sourceBuffer The source buffer, which must remain alive until the returned ticket completes
+         * @param destinationBuffer The destination buffer
+         * @param bytes The number of bytes to copy
+         * @returns Ticket of the batch the copy was recorded into
+         */
+        virtual uint64_t copyBufferToBuffer(IVulkanBuffer const * sourceBuffer, IVulkanBuffer const * destinationBuffer, VkDeviceSize bytes) = 0;
+
+        /**
+         * @brief Record a copy from a buffer to an image into the current batch. The image is transitioned to shader read only layout on the graphics queue
+         *
+         * @param sourceBuffer The source buffer, which must remain alive until the returned ticket completes
+         * @param destinationImage The destination image, whose contents are discarded
+         * @param width The image width
+         * @param height The image height
+         * @returns Ticket of the batch the copy was recorded into
+         */
+        virtual uint64_t copyBufferToImage(IVulkanBuffer const * sourceBuffer, IVulkanImage const * destinationImage, uint32_t width, uint32_t height) = 0;
+
+        /**
+         * @brief Submit the current batch
+         *
+         * @returns Ticket of the submitted batch, or of the last submitted batch if nothing was recorded
+         */
+        virtual uint64_t submit() = 0;
+
+        /**
+         * @brief Check if a batch has completed without blocking
+         *
+         * @param ticket The batch ticket. Ticket 0 identifies no batch and is always complete
+         * @returns True if the batch has completed, otherwise false
+         */
+        virtual bool isComplete(uint64_t ticket) const = 0;
+
+        /**
+         * @brief Block until a batch has completed, submitting it first if required
+         *
+         * @param ticket The batch ticket. Ticket 0 identifies no batch and returns immediately
+         */
+        virtual void wait(uint64_t ticket) = 0;
+
+        /**
+         * @brief Interface destructor
+         */
+        virtual ~IVulkanTransferManager() = default;
+    };
+}
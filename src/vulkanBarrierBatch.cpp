@@ -0,0 +1,237 @@
+#include "systems/renderer/vulkan/vulkanComponents/vulkanBarrierBatch.hpp"
+
+namespace siofraEngine::systems
+{
+    VkPipelineStageFlags VulkanBarrierBatch::toLegacyStageMask(VkPipelineStageFlags2 stageMask) noexcept
+    {
+        // The low 32 bits of the synchronization2 stages match the legacy stages
+        constexpr VkPipelineStageFlags2 legacyStages{ 0xFFFFFFFFull };
+        VkPipelineStageFlags legacyStageMask = static_cast<VkPipelineStageFlags>(stageMask & legacyStages);
+        VkPipelineStageFlags2 extendedStages = stageMask & ~legacyStages;
+
+        if (extendedStages & (VK_PIPELINE_STAGE_2_COPY_BIT | VK_PIPELINE_STAGE_2_RESOLVE_BIT | VK_PIPELINE_STAGE_2_BLIT_BIT | VK_PIPELINE_STAGE_2_CLEAR_BIT))
+        {
+            legacyStageMask |= VK_PIPELINE_STAGE_TRANSFER_BIT;
+            extendedStages &= ~(VK_PIPELINE_STAGE_2_COPY_BIT | VK_PIPELINE_STAGE_2_RESOLVE_BIT | VK_PIPELINE_STAGE_2_BLIT_BIT | VK_PIPELINE_STAGE_2_CLEAR_BIT);
+        }
+        if (extendedStages & (VK_PIPELINE_STAGE_2_INDEX_INPUT_BIT | VK_PIPELINE_STAGE_2_VERTEX_ATTRIBUTE_INPUT_BIT))
+        {
+            legacyStageMask |= VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+            extendedStages &= ~(VK_PIPELINE_STAGE_2_INDEX_INPUT_BIT | VK_PIPELINE_STAGE_2_VERTEX_ATTRIBUTE_INPUT_BIT);
+        }
+        if (extendedStages & VK_PIPELINE_STAGE_2_PRE_RASTERIZATION_SHADERS_BIT)
+        {
+            legacyStageMask |= VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT;
+            extendedStages &= ~VK_PIPELINE_STAGE_2_PRE_RASTERIZATION_SHADERS_BIT;
+        }
+        if (extendedStages != 0)
+        {
+            legacyStageMask |= VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        }
+
+        return legacyStageMask;
+    }
+
+    VkAccessFlags VulkanBarrierBatch::toLegacyAccessMask(VkAccessFlags2 accessMask) noexcept
+    {
+        // The low 32 bits of the synchronization2 accesses match the legacy accesses
+        constexpr VkAccessFlags2 legacyAccesses{ 0xFFFFFFFFull };
+        VkAccessFlags legacyAccessMask = static_cast<VkAccessFlags>(accessMask & legacyAccesses);
+        VkAccessFlags2 extendedAccesses = accessMask & ~legacyAccesses;
+
+        if (extendedAccesses & (VK_ACCESS_2_SHADER_SAMPLED_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_READ_BIT))
+        {
+            legacyAccessMask |= VK_ACCESS_SHADER_READ_BIT;
+            extendedAccesses &= ~(VK_ACCESS_2_SHADER_SAMPLED_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_READ_BIT);
+        }
+        if (extendedAccesses & VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT)
+        {
+            legacyAccessMask |= VK_ACCESS_SHADER_WRITE_BIT;
+            extendedAccesses &= ~VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT;
+        }
+        if (extendedAccesses != 0)
+        {
+            legacyAccessMask |= VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+        }
+
+        return legacyAccessMask;
+    }
+
+    VulkanBarrierBatch& VulkanBarrierBatch::addExecutionDependency(VkPipelineStageFlags2 srcStageMask, VkPipelineStageFlags2 dstStageMask)
+    {
+        return addMemoryBarrier(srcStageMask, 0, dstStageMask, 0);
+    }
+
+    VulkanBarrierBatch& VulkanBarrierBatch::addMemoryBarrier(VkPipelineStageFlags2 srcStageMask, VkAccessFlags2 srcAccessMask, VkPipelineStageFlags2 dstStageMask, VkAccessFlags2 dstAccessMask)
+    {
+        VkMemoryBarrier2 memoryBarrier{ };
+        memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2;
+        memoryBarrier.srcStageMask = srcStageMask;
+        memoryBarrier.srcAccessMask = srcAccessMask;
+        memoryBarrier.dstStageMask = dstStageMask;
+        memoryBarrier.dstAccessMask = dstAccessMask;
+        memoryBarriers.push_back(memoryBarrier);
+        return *this;
+    }
+
+    VulkanBarrierBatch& VulkanBarrierBatch::addBufferBarrier(VkBufferMemoryBarrier const & bufferMemoryBarrier, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask)
+    {
+        VkBufferMemoryBarrier2 bufferMemoryBarrier2{ };
+        bufferMemoryBarrier2.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2;
+        bufferMemoryBarrier2.srcStageMask = srcStageMask;
+        bufferMemoryBarrier2.srcAccessMask = bufferMemoryBarrier.srcAccessMask;
+        bufferMemoryBarrier2.dstStageMask = dstStageMask;
+        bufferMemoryBarrier2.dstAccessMask = bufferMemoryBarrier.dstAccessMask;
+        bufferMemoryBarrier2.srcQueueFamilyIndex = bufferMemoryBarrier.srcQueueFamilyIndex;
+        bufferMemoryBarrier2.dstQueueFamilyIndex = bufferMemoryBarrier.dstQueueFamilyIndex;
+        bufferMemoryBarrier2.buffer = bufferMemoryBarrier.buffer;
+        bufferMemoryBarrier2.offset = bufferMemoryBarrier.offset;
+        bufferMemoryBarrier2.size = bufferMemoryBarrier.size;
+        return addBufferBarrier(bufferMemoryBarrier2);
+    }
+
+    VulkanBarrierBatch& VulkanBarrierBatch::addBufferBarrier(VkBufferMemoryBarrier2 const & bufferMemoryBarrier)
+    {
+        bufferMemoryBarriers.push_back(bufferMemoryBarrier);
+        return *this;
+    }
+
+    VulkanBarrierBatch& VulkanBarrierBatch::addImageBarrier(VkImageMemoryBarrier const & imageMemoryBarrier, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask)
+    {
+        VkImageMemoryBarrier2 imageMemoryBarrier2{ };
+        imageMemoryBarrier2.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+        imageMemoryBarrier2.srcStageMask = srcStageMask;
+        imageMemoryBarrier2.srcAccessMask = imageMemoryBarrier.srcAccessMask;
+        imageMemoryBarrier2.dstStageMask = dstStageMask;
+        imageMemoryBarrier2.dstAccessMask = imageMemoryBarrier.dstAccessMask;
+        imageMemoryBarrier2.oldLayout = imageMemoryBarrier.oldLayout;
+        imageMemoryBarrier2.newLayout = imageMemoryBarrier.newLayout;
+        imageMemoryBarrier2.srcQueueFamilyIndex = imageMemoryBarrier.srcQueueFamilyIndex;
+        imageMemoryBarrier2.dstQueueFamilyIndex = imageMemoryBarrier.dstQueueFamilyIndex;
+        imageMemoryBarrier2.image = imageMemoryBarrier.image;
+        imageMemoryBarrier2.subresourceRange = imageMemoryBarrier.subresourceRange;
+        return addImageBarrier(imageMemoryBarrier2);
+    }
+
+    VulkanBarrierBatch& VulkanBarrierBatch::addImageBarrier(VkImageMemoryBarrier2 const & imageMemoryBarrier)
+    {
+        imageMemoryBarriers.push_back(imageMemoryBarrier);
+        return *this;
+    }
+
+    void VulkanBarrierBatch::clear() noexcept
+    {
+        memoryBarriers.clear();
+        bufferMemoryBarriers.clear();
+        imageMemoryBarriers.clear();
+    }
+
+    bool VulkanBarrierBatch::empty() const noexcept
+    {
+        return memoryBarriers.empty() && bufferMemoryBarriers.empty() && imageMemoryBarriers.empty();
+    }
+
+    void VulkanBarrierBatch::record(VkCommandBuffer commandBuffer, bool synchronization2)
+    {
+        if (empty())
+        {
+            return;
+        }
+
+        if (synchronization2)
+        {
+            recordSynchronization2(commandBuffer);
+        }
+        else
+        {
+            recordLegacy(commandBuffer);
+        }
+
+        clear();
+    }
+
+    void VulkanBarrierBatch::recordSynchronization2(VkCommandBuffer commandBuffer) const
+    {
+        VkDependencyInfo dependencyInfo{ };
+        dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+        dependencyInfo.memoryBarrierCount = static_cast<uint32_t>(memoryBarriers.size());
+        dependencyInfo.pMemoryBarriers = memoryBarriers.data();
+        dependencyInfo.bufferMemoryBarrierCount = static_cast<uint32_t>(bufferMemoryBarriers.size());
+        dependencyInfo.pBufferMemoryBarriers = bufferMemoryBarriers.data();
+        dependencyInfo.imageMemoryBarrierCount = static_cast<uint32_t>(imageMemoryBarriers.size());
+        dependencyInfo.pImageMemoryBarriers = imageMemoryBarriers.data();
+
+        vkCmdPipelineBarrier2(commandBuffer, &dependencyInfo);
+    }
+
+    void VulkanBarrierBatch::recordLegacy(VkCommandBuffer commandBuffer)
+    {
+        VkPipelineStageFlags srcStageMask{ 0 };
+        VkPipelineStageFlags dstStageMask{ 0 };
+        legacyMemoryBarriers.clear();
+        legacyBufferMemoryBarriers.clear();
+        legacyImageMemoryBarriers.clear();
+
+        for (auto const & memoryBarrier : memoryBarriers)
+        {
+            srcStageMask |= toLegacyStageMask(memoryBarrier.srcStageMask);
+            dstStageMask |= toLegacyStageMask(memoryBarrier.dstStageMask);
+
+            // Execution dependencies only contribute their stages
+            if (memoryBarrier.srcAccessMask == 0 && memoryBarrier.dstAccessMask == 0)
+            {
+                continue;
+            }
+
+            VkMemoryBarrier legacyMemoryBarrier{ };
+            legacyMemoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            legacyMemoryBarrier.srcAccessMask = toLegacyAccessMask(memoryBarrier.srcAccessMask);
+            legacyMemoryBarrier.dstAccessMask = toLegacyAccessMask(memoryBarrier.dstAccessMask);
+            legacyMemoryBarriers.push_back(legacyMemoryBarrier);
+        }
+
+        for (auto const & bufferMemoryBarrier : bufferMemoryBarriers)
+        {
+            srcStageMask |= toLegacyStageMask(bufferMemoryBarrier.srcStageMask);
+            dstStageMask |= toLegacyStageMask(bufferMemoryBarrier.dstStageMask);
+
+            VkBufferMemoryBarrier legacyBufferMemoryBarrier{ };
+            legacyBufferMemoryBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+            legacyBufferMemoryBarrier.srcAccessMask = toLegacyAccessMask(bufferMemoryBarrier.srcAccessMask);
+            legacyBufferMemoryBarrier.dstAccessMask = toLegacyAccessMask(bufferMemoryBarrier.dstAccessMask);
+            legacyBufferMemoryBarrier.srcQueueFamilyIndex = bufferMemoryBarrier.srcQueueFamilyIndex;
+            legacyBufferMemoryBarrier.dstQueueFamilyIndex = bufferMemoryBarrier.dstQueueFamilyIndex;
+            legacyBufferMemoryBarrier.buffer = bufferMemoryBarrier.buffer;
+            legacyBufferMemoryBarrier.offset = bufferMemoryBarrier.offset;
+            legacyBufferMemoryBarrier.size = bufferMemoryBarrier.size;
+            legacyBufferMemoryBarriers.push_back(legacyBufferMemoryBarrier);
+        }
+
+        for (auto const & imageMemoryBarrier : imageMemoryBarriers)
+        {
+            srcStageMask |= toLegacyStageMask(imageMemoryBarrier.srcStageMask);
+            dstStageMask |= toLegacyStageMask(imageMemoryBarrier.dstStageMask);
+
+            VkImageMemoryBarrier legacyImageMemoryBarrier{ };
+            legacyImageMemoryBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            legacyImageMemoryBarrier.srcAccessMask = toLegacyAccessMask(imageMemoryBarrier.srcAccessMask);
+            legacyImageMemoryBarrier.dstAccessMask = toLegacyAccessMask(imageMemoryBarrier.dstAccessMask);
+            legacyImageMemoryBarrier.oldLayout = imageMemoryBarrier.oldLayout;
+            legacyImageMemoryBarrier.newLayout = imageMemoryBarrier.newLayout;
+            legacyImageMemoryBarrier.srcQueueFamilyIndex = imageMemoryBarrier.srcQueueFamilyIndex;
+            legacyImageMemoryBarrier.dstQueueFamilyIndex = imageMemoryBarrier.dstQueueFamilyIndex;
+            legacyImageMemoryBarrier.image = imageMemoryBarrier.image;
+            legacyImageMemoryBarrier.subresourceRange = imageMemoryBarrier.subresourceRange;
+            legacyImageMemoryBarriers.push_back(legacyImageMemoryBarrier);
+        }
+
+        vkCmdPipelineBarrier(
+            commandBuffer,
+            srcStageMask != 0 ? srcStageMask : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+            dstStageMask != 0 ? dstStageMask : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+            0,
+            static_cast<uint32_t>(legacyMemoryBarriers.size()), legacyMemoryBarriers.data(),
+            static_cast<uint32_t>(legacyBufferMemoryBarriers.size()), legacyBufferMemoryBarriers.data(),
+            static_cast<uint32_t>(legacyImageMemoryBarriers.size()), legacyImageMemoryBarriers.data());
+    }
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <vector>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanComponent.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Collects memory, buffer and image barriers and records them with a single pipeline barrier command.
+     * Barriers are stored with synchronization2 stage and access masks. They are recorded with vkCmdPipelineBarrier2 when
+     * synchronization2 is enabled, otherwise they are converted to legacy barriers whose stage masks are merged
+     */
+    class VulkanBarrierBatch
+    {
+    public:
+        /**
+         * @brief Convert a synchronization2 stage mask to the nearest legacy stage mask. Stages without a legacy equivalent become all commands
+         *
+         * @param stageMask The synchronization2 stage mask
+         * @returns The legacy stage mask
+         */
+        static VkPipelineStageFlags toLegacyStageMask(VkPipelineStageFlags2 stageMask) noexcept;
+
+        /**
+         * @brief Convert a synchronization2 access mask to the nearest legacy access mask. Accesses without a legacy equivalent become generic memory accesses
+         *
+         * @param accessMask The synchronization2 access mask
+         * @returns The legacy access mask
+         */
+        static VkAccessFlags toLegacyAccessMask(VkAccessFlags2 accessMask) noexcept;
+
+        /**
+         * @brief Add an execution dependency without any memory barrier
+         *
+         * @param srcStageMask The stages which must complete before the dependency
+         * @param dstStageMask The stages which wait on the dependency
+         * @returns Reference to the batch
+         */
+        VulkanBarrierBatch& addExecutionDependency(VkPipelineStageFlags2 srcStageMask, VkPipelineStageFlags2 dstStageMask);
+
+        /**
+         * @brief Add a global memory barrier
+         *
+         * @param srcStageMask The stages which must complete before the barrier
+         * @param srcAccessMask The accesses made available by the barrier
+         * @param dstStageMask The stages which wait on the barrier
+         * @param dstAccessMask The accesses made visible by the barrier
+         * @returns Reference to the batch
+         */
+        VulkanBarrierBatch& addMemoryBarrier(VkPipelineStageFlags2 srcStageMask, VkAccessFlags2 srcAccessMask, VkPipelineStageFlags2 dstStageMask, VkAccessFlags2 dstAccessMask);
+
+        /**
+         * @brief Add a buffer memory barrier
+         *
+         * @param bufferMemoryBarrier The buffer memory barrier
+         * @param srcStageMask The stages which must complete before the barrier
+         * @param dstStageMask The stages which wait on the barrier
+         * @returns Reference to the batch
+         */
+        VulkanBarrierBatch& addBufferBarrier(VkBufferMemoryBarrier const & bufferMemoryBarrier, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask);
+
+        /**
+         * @brief Add a buffer memory barrier with its own synchronization2 stage and access masks
+         *
+         * @param bufferMemoryBarrier The buffer memory barrier
+         * @returns Reference to the batch
+         */
+        VulkanBarrierBatch& addBufferBarrier(VkBufferMemoryBarrier2 const & bufferMemoryBarrier);
+
+        /**
+         * @brief Add an image memory barrier
+         *
+         * @param imageMemoryBarrier The image memory barrier
+         * @param srcStageMask The stages which must complete before the barrier
+         * @param dstStageMask The stages which wait on the barrier
+         * @returns Reference to the batch
+         */
+        VulkanBarrierBatch& addImageBarrier(VkImageMemoryBarrier const & imageMemoryBarrier, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask);
+
+        /**
+         * @brief Add an image memory barrier with its own synchronization2 stage and access masks
+         *
+         * @param imageMemoryBarrier The image memory barrier
+         * @returns Reference to the batch
+         */
+        VulkanBarrierBatch& addImageBarrier(VkImageMemoryBarrier2 const & imageMemoryBarrier);
+
+        /**
+         * @brief Remove all barriers. Allocated storage is kept for reuse
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Check if the batch contains any barriers or execution dependencies
+         *
+         * @returns True if the batch is empty, otherwise false
+         */
+        bool empty() const noexcept;
+
+        /**
+         * @brief Record the batch with a single pipeline barrier command and clear it. Does nothing if the batch is empty
+         *
+         * @param commandBuffer Vulkan command buffer handle
+         * @param synchronization2 Indicates if vkCmdPipelineBarrier2 is used. Requires the SYNCHRONIZATION_2 device feature
+         */
+        void record(VkCommandBuffer commandBuffer, bool synchronization2);
+
+    private:
+        /**
+         * @brief Global memory barriers, including execution dependencies
+         */
+        std::vector<VkMemoryBarrier2> memoryBarriers{ };
+
+        /**
+         * @brief Buffer memory barriers
+         */
+        std::vector<VkBufferMemoryBarrier2> bufferMemoryBarriers{ };
+
+        /**
+         * @brief Image memory barriers
+         */
+        std::vector<VkImageMemoryBarrier2> imageMemoryBarriers{ };
+
+        /**
+         * @brief Storage for memory barriers converted for the legacy path
+         */
+        std::vector<VkMemoryBarrier> legacyMemoryBarriers{ };
+
+        /**
+         * @brief Storage for buffer memory barriers converted for the legacy path
+         */
+        std::vector<VkBufferMemoryBarrier> legacyBufferMemoryBarriers{ };
+
+        /**
+         * @brief Storage for image memory barriers converted for the legacy path
+         */
+        std::vector<VkImageMemoryBarrier> legacyImageMemoryBarriers{ };
+
+        /**
+         * @brief Record the batch with vkCmdPipelineBarrier2
+         *
+         * @param commandBuffer Vulkan command buffer handle
+         */
+        void recordSynchronization2(VkCommandBuffer commandBuffer) const;
+
+        /**
+         * @brief Record the batch with a single legacy vkCmdPipelineBarrier
+         *
+         * @param commandBuffer Vulkan command buffer handle
+         */
+        void recordLegacy(VkCommandBuffer commandBuffer);
+    };
+}
@@ -0,0 +1,145 @@
+#include "systems/renderer/vulkan/vulkanComponents/vulkanBindlessTextureTable.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanBindlessTextureTable::VulkanBindlessTextureTable(
+        std::unique_ptr<IVulkanDescriptorSetLayout> descriptorSetLayout,
+        std::unique_ptr<IVulkanDescriptorPool> descriptorPool,
+        std::unique_ptr<IVulkanDescriptorSet> descriptorSet,
+        uint32_t capacity,
+        uint32_t frameCount,
+        IVulkanDevice const * device) :
+        descriptorSetLayout{std::move(descriptorSetLayout)},
+        descriptorPool{std::move(descriptorPool)},
+        descriptorSet{std::move(descriptorSet)},
+        capacity{capacity},
+        liveIndices(capacity, false),
+        retiredIndices(frameCount),
+        device{device}
+    {
+
+    }
+
+    VulkanBindlessTextureTable::operator bool() const noexcept
+    {
+        return descriptorSetLayout && *descriptorSetLayout &&
+            descriptorPool && *descriptorPool &&
+            descriptorSet && *descriptorSet;
+    }
+
+    uint32_t VulkanBindlessTextureTable::add(IVulkanImage const * image, IVulkanSampler const * sampler)
+    {
+        uint32_t index{ 0 };
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!freeIndices.empty())
+            {
+                index = freeIndices.back();
+                freeIndices.pop_back();
+            }
+            else if (nextIndex < capacity)
+            {
+                index = nextIndex++;
+            }
+            else
+            {
+                throw std::runtime_error("Failed to add texture, the bindless texture table is full");
+            }
+            liveIndices[index] = true;
+        }
+
+        write(index, image, sampler);
+        return index;
+    }
+
+    void VulkanBindlessTextureTable::update(uint32_t index, IVulkanImage const * image, IVulkanSampler const * sampler)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (index >= capacity)
+            {
+                throw std::runtime_error("Failed to update texture, index out of range");
+            }
+            if (!liveIndices[index])
+            {
+                throw std::runtime_error("Failed to update texture, index is not in use");
+            }
+        }
+        write(index, image, sampler);
+    }
+
+    void VulkanBindlessTextureTable::remove(uint32_t index)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (index >= capacity)
+        {
+            throw std::runtime_error("Failed to remove texture, index out of range");
+        }
+        if (!liveIndices[index])
+        {
+            throw std::runtime_error("Failed to remove texture, index is not in use");
+        }
+
+        // The stale descriptor is left in place. Partially bound arrays only require descriptors which are accessed to be valid
+        liveIndices[index] = false;
+        retiredIndices[frameIndex].push_back(index);
+    }
+
+    void VulkanBindlessTextureTable::beginFrame(uint32_t frameIndex, IVulkanFence const * fence)
+    {
+        if (fence == nullptr)
+        {
+            throw std::runtime_error("Failed to begin frame, no fence specified");
+        }
+
+        fence->wait();
+        recycle(frameIndex);
+    }
+
+    void VulkanBindlessTextureTable::beginFrame(uint32_t frameIndex, IVulkanSemaphore const * timelineSemaphore, uint64_t value)
+    {
+        if (timelineSemaphore == nullptr)
+        {
+            throw std::runtime_error("Failed to begin frame, no timeline semaphore specified");
+        }
+
+        timelineSemaphore->wait(value);
+        recycle(frameIndex);
+    }
+
+    uint32_t VulkanBindlessTextureTable::getCapacity() const noexcept
+    {
+        return capacity;
+    }
+
+    IVulkanDescriptorSetLayout const * VulkanBindlessTextureTable::getDescriptorSetLayout() const noexcept
+    {
+        return descriptorSetLayout.get();
+    }
+
+    IVulkanDescriptorSet const * VulkanBindlessTextureTable::getDescriptorSet() const noexcept
+    {
+        return descriptorSet.get();
+    }
+
+    void VulkanBindlessTextureTable::write(uint32_t index, IVulkanImage const * image, IVulkanSampler const * sampler) const
+    {
+        VulkanDescriptorWriteBatch writeBatch;
+        writeBatch
+            .writeImage(descriptorSet.get(), 0, index, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, image, sampler, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
+            .commit(device);
+    }
+
+    void VulkanBindlessTextureTable::recycle(uint32_t frameIndex)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (frameIndex >= retiredIndices.size())
+        {
+            throw std::runtime_error("Failed to begin frame, frame index is out of range");
+        }
+
+        freeIndices.insert(freeIndices.end(), retiredIndices[frameIndex].begin(), retiredIndices[frameIndex].end());
+        retiredIndices[frameIndex].clear();
+        this->frameIndex = frameIndex;
+    }
+}
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanBindlessTextureTable.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDescriptorPool.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/vulkanDescriptorWriteBatch.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Holds textures in a single update after bind, partially bound combined image sampler array. Textures are
+     * referenced from shaders by index, so one descriptor set bound per frame serves every draw
+     */
+    class VulkanBindlessTextureTable : public IVulkanBindlessTextureTable
+    {
+    public:
+        /**
+         * @brief VulkanBindlessTextureTable builder
+         */
+        class Builder;
+
+        /**
+         * @brief VulkanBindlessTextureTable constructor
+         * 
+         * @param descriptorSetLayout Layout with a single variable count combined image sampler array at binding 0
+         * @param descriptorPool Update after bind pool the descriptor set is allocated from
+         * @param descriptorSet The descriptor set holding the texture array
+         * @param capacity The number of descriptors in the texture array
+         * @param frameCount The number of frames in flight
+         * @param device The device the table is created on
+         */
+        VulkanBindlessTextureTable(
+            std::unique_ptr<IVulkanDescriptorSetLayout> descriptorSetLayout,
+            std::unique_ptr<IVulkanDescriptorPool> descriptorPool,
+            std::unique_ptr<IVulkanDescriptorSet> descriptorSet,
+            uint32_t capacity,
+            uint32_t frameCount,
+            IVulkanDevice const * device);
+
+        /**
+         * @brief VulkanBindlessTextureTable copy constructor
+         * 
+         * @param other VulkanBindlessTextureTable to copy
+         */
+        VulkanBindlessTextureTable(VulkanBindlessTextureTable const &other) = delete;
+
+        /**
+         * @brief VulkanBindlessTextureTable move constructor
+         * 
+         * @param other VulkanBindlessTextureTable to move
+         */
+        VulkanBindlessTextureTable(VulkanBindlessTextureTable &&other) = delete;
+
+        /**
+         * @brief VulkanBindlessTextureTable destructor
+         */
+        ~VulkanBindlessTextureTable() = default;
+
+        /**
+         * @brief VulkanBindlessTextureTable copy assignment
+         * 
+         * @param other VulkanBindlessTextureTable to copy
+         */
+        VulkanBindlessTextureTable& operator=(const VulkanBindlessTextureTable &other) = delete;
+
+        /**
+         * @brief VulkanBindlessTextureTable move assignment
+         * 
+         * @param other VulkanBindlessTextureTable to move
+         */
+        VulkanBindlessTextureTable& operator=(VulkanBindlessTextureTable &&other) = delete;
+
+        /**
+         * @brief Check if the wrapped components are initialized
+         * 
+         * @returns True if the wrapped components are intialized, otherwise false
+         */
+        operator bool() const noexcept override;
+
+        /**
+         * @brief Add a texture to the table
+         * 
+         * @param image The texture image, in shader read only layout
+         * @param sampler The texture sampler
+         * @returns The stable index of the texture within the descriptor array
+         */
+        uint32_t add(IVulkanImage const * image, IVulkanSampler const * sampler) override;
+
+        /**
+         * @brief Replace the texture at an index. The previous texture must no longer be accessed by any pending submission
+         * 
+         * @param index The texture index
+         * @param image The texture image, in shader read only layout
+         * @param sampler The texture sampler
+         */
+        void update(uint32_t index, IVulkanImage const * image, IVulkanSampler const * sampler) override;
+
+        /**
+         * @brief Release an index. It is retired with the current frame and only reused once the frame is next begun, after the
+         * frame's submission has completed, so submissions still in flight may keep sampling the texture
+         * 
+         * @param index The texture index
+         */
+        void remove(uint32_t index) override;
+
+        /**
+         * @brief Begin a frame. Waits for the fence signalled by the previous submission of the frame, then makes the indices removed
+         * during that submission's frame available for reuse
+         * 
+         * @param frameIndex Index of the frame in flight
+         * @param fence The fence signalled by the previous submission of the frame. The fence is not reset
+         */
+        void beginFrame(uint32_t frameIndex, IVulkanFence const * fence) override;
+
+        /**
+         * @brief Begin a frame. Waits for a timeline semaphore to reach the value signalled by the previous submission of the frame,
+         * then makes the indices removed during that submission's frame available for reuse
+         * 
+         * @param frameIndex Index of the frame in flight
+         * @param timelineSemaphore The timeline semaphore signalled by the previous submission of the frame
+         * @param value The value signalled by the previous submission of the frame
+         */
+        void beginFrame(uint32_t frameIndex, IVulkanSemaphore const * timelineSemaphore, uint64_t value) override;
+
+        /**
+         * @brief Get the maximum number of textures in the table
+         * 
+         * @returns The table capacity
+         */
+        uint32_t getCapacity() const noexcept override;
+
+        /**
+         * @brief Get the layout of the table's descriptor set, for inclusion in pipeline layouts
+         * 
+         * @returns The descriptor set layout
+         */
+        IVulkanDescriptorSetLayout const * getDescriptorSetLayout() const noexcept override;
+
+        /**
+         * @brief Get the table's descriptor set. It may stay bound while textures are added, updated and removed
+         * 
+         * @returns The descriptor set
+         */
+        IVulkanDescriptorSet const * getDescriptorSet() const noexcept override;
+
+    private:
+        /**
+         * @brief Layout with a single variable count combined image sampler array at binding 0
+         */
+        std::unique_ptr<IVulkanDescriptorSetLayout> descriptorSetLayout{ nullptr };
+
+        /**
+         * @brief Update after bind pool the descriptor set is allocated from
+         */
+        std::unique_ptr<IVulkanDescriptorPool> descriptorPool{ nullptr };
+
+        /**
+         * @brief The descriptor set holding the texture array
+         */
+        std::unique_ptr<IVulkanDescriptorSet> descriptorSet{ nullptr };
+
+        /**
+         * @brief The number of descriptors in the texture array
+         */
+        uint32_t capacity{ 0 };
+
+        /**
+         * @brief The lowest index never handed out
+         */
+        uint32_t nextIndex{ 0 };
+
+        /**
+         * @brief Released indices available for reuse
+         */
+        std::vector<uint32_t> freeIndices{ };
+
+        /**
+         * @brief Indicates which indices hold a texture
+         */
+        std::vector<bool> liveIndices{ };
+
+        /**
+         * @brief Indices removed during each frame in flight, waiting for the frame's submission to complete
+         */
+        std::vector<std::vector<uint32_t>> retiredIndices{ };
+
+        /**
+         * @brief Index of the current frame in flight
+         */
+        uint32_t frameIndex{ 0 };
+
+        /**
+         * @brief Guards the indices
+         */
+        std::mutex mutex{ };
+
+        /**
+         * @brief The device the table is created on
+         */
+        IVulkanDevice const * device{ nullptr };
+
+        /**
+         * @brief Write a texture descriptor into the array
+         * 
+         * @param index The texture index
+         * @param image The texture image
+         * @param sampler The texture sampler
+         */
+        void write(uint32_t index, IVulkanImage const * image, IVulkanSampler const * sampler) const;
+
+        /**
+         * @brief Make the indices retired by a frame available for reuse and make it the current frame
+         * 
+         * @param frameIndex Index of the frame in flight
+         */
+        void recycle(uint32_t frameIndex);
+    };
+}
@@ -2,9 +2,10 @@
 
 namespace siofraEngine::systems
 {
-    VulkanBuffer::VulkanBuffer(VkBuffer buffer, VkDeviceMemory bufferMemory, IVulkanDevice const * device) :
+    VulkanBuffer::VulkanBuffer(VkBuffer buffer, VulkanMemoryAllocation bufferMemory, void * mappedMemory, IVulkanDevice const * device) :
         buffer{buffer},
         bufferMemory{bufferMemory},
+        mappedMemory{mappedMemory},
         device{device}
     {
 
@@ -13,10 +14,12 @@ namespace siofraEngine::systems
     VulkanBuffer::VulkanBuffer(VulkanBuffer &&other) noexcept :
         buffer{other.buffer},
         bufferMemory{other.bufferMemory},
+        mappedMemory{other.mappedMemory},
         device{other.device}
     {
         other.buffer = VK_NULL_HANDLE;
-        other.bufferMemory = VK_NULL_HANDLE;
+        other.bufferMemory = { };
+        other.mappedMemory = nullptr;
         other.device = nullptr;
     }
 
@@ -24,16 +27,22 @@ namespace siofraEngine::systems
     {
         auto logicalDevice = device->getLogicalDevice();
         vkDestroyBuffer(logicalDevice, buffer, nullptr);
-        vkFreeMemory(logicalDevice, bufferMemory, nullptr);
+        if (mappedMemory != nullptr)
+        {
+            device->getMemoryAllocator()->unmap(bufferMemory);
+        }
+        device->getMemoryAllocator()->free(bufferMemory);
     }
 
     VulkanBuffer& VulkanBuffer::operator=(VulkanBuffer &&other) noexcept
     {
         buffer = other.buffer;
         bufferMemory = other.bufferMemory;
+        mappedMemory = other.mappedMemory;
         device = other.device;
         other.buffer = VK_NULL_HANDLE;
-        other.bufferMemory = VK_NULL_HANDLE;
+        other.bufferMemory = { };
+        other.mappedMemory = nullptr;
         other.device = nullptr;
         return *this;
     }
@@ -50,11 +59,28 @@ namespace siofraEngine::systems
 
     void VulkanBuffer::update(void const * data, size_t size) const
     {
-        void * destination;
-        auto logicalDevice = device->getLogicalDevice();
-        vkMapMemory(logicalDevice, bufferMemory, 0, size, 0, &destination);
-        memcpy(destination, data, size);
-        vkUnmapMemory(logicalDevice, bufferMemory);
+        update(data, size, 0);
+    }
+
+    void VulkanBuffer::update(void const * data, size_t size, VkDeviceSize offset) const
+    {
+        if (offset > bufferMemory.size || size > bufferMemory.size - offset)
+        {
+            throw std::runtime_error("Failed to update buffer, the range exceeds the buffer memory");
+        }
+
+        auto const & memoryAllocator = device->getMemoryAllocator();
+        if (mappedMemory != nullptr)
+        {
+            memcpy(static_cast<char *>(mappedMemory) + offset, data, size);
+            memoryAllocator->flush(bufferMemory, offset, size);
+            return;
+        }
+
+        void * destination = memoryAllocator->map(bufferMemory);
+        memcpy(static_cast<char *>(destination) + offset, data, size);
+        memoryAllocator->flush(bufferMemory, offset, size);
+        memoryAllocator->unmap(bufferMemory);
     }
 
     void VulkanBuffer::copyToImage(IVulkanCommandBuffer const * commandBuffer, IVulkanQueue const * queue, IVulkanImage const * image, uint32_t width, uint32_t height) const
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stdexcept>
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanBuffer.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
 
@@ -20,10 +21,11 @@ namespace siofraEngine::systems
          * @brief VulkanBuffer constructor
          * 
          * @param buffer Vulkan buffer handle
-         * @param bufferMemory Vulkan buffer memory handle
+         * @param bufferMemory Device memory allocation bound to the buffer
+         * @param mappedMemory Host address of the persistently mapped buffer memory, or nullptr if the buffer is mapped on update
          * @param device Vulkan device used to create the buffer
          */
-        VulkanBuffer(VkBuffer buffer, VkDeviceMemory bufferMemory, IVulkanDevice const * device);
+        VulkanBuffer(VkBuffer buffer, VulkanMemoryAllocation bufferMemory, void * mappedMemory, IVulkanDevice const * device);
 
         /**
          * @brief VulkanBuffer copy constructor
@@ -80,6 +82,15 @@ namespace siofraEngine::systems
          */
         void update(void const * data, size_t size) const override;
 
+        /**
+         * @brief Update a range of the buffer contents
+         * 
+         * @param data New data to copy to the buffer
+         * @param size Size of the data to copy in bytes
+         * @param offset Offset into the buffer at which to copy the data. Throws if the range exceeds the buffer memory
+         */
+        void update(void const * data, size_t size, VkDeviceSize offset) const override;
+
         /**
          * @brief Copy the buffer to an image
          * 
@@ -108,9 +119,14 @@ namespace siofraEngine::systems
         VkBuffer buffer{ VK_NULL_HANDLE };
 
         /**
-         * @brief Vulkan buffer memory handle
+         * @brief Device memory allocation bound to the buffer
+         */
+        VulkanMemoryAllocation bufferMemory{ };
+
+        /**
+         * @brief Host address of the persistently mapped buffer memory
          */
-        VkDeviceMemory bufferMemory{ VK_NULL_HANDLE };
+        void * mappedMemory{ nullptr };
 
         /**
          * @brief Vulkan device used to create the buffer
@@ -2,14 +2,17 @@
 
 namespace siofraEngine::systems
 {
-    VulkanCommandBuffer::VulkanCommandBuffer(VkCommandBuffer commandBuffer) :
-        commandBuffer{commandBuffer}
+    VulkanCommandBuffer::VulkanCommandBuffer(VkCommandBuffer commandBuffer, bool synchronization2) :
+        commandBuffer{commandBuffer},
+        synchronization2{synchronization2}
     {
         
     }
 
     VulkanCommandBuffer::VulkanCommandBuffer(VulkanCommandBuffer &&other) noexcept :
-        commandBuffer{other.commandBuffer}
+        commandBuffer{other.commandBuffer},
+        barrierBatch{std::move(other.barrierBatch)},
+        synchronization2{other.synchronization2}
     {
         other.commandBuffer = VK_NULL_HANDLE;
     }
@@ -17,6 +20,8 @@ namespace siofraEngine::systems
     VulkanCommandBuffer& VulkanCommandBuffer::operator=(VulkanCommandBuffer &&other) noexcept
     {
         commandBuffer = other.commandBuffer;
+        barrierBatch = std::move(other.barrierBatch);
+        synchronization2 = other.synchronization2;
         other.commandBuffer = VK_NULL_HANDLE;
         return *this;
     }
@@ -37,17 +42,133 @@ namespace siofraEngine::systems
         commandBufferBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
         commandBufferBeginInfo.flags = flags;
 
+        barrierBatch.clear();
+
         if (vkBeginCommandBuffer(commandBuffer, &commandBufferBeginInfo) != VK_SUCCESS)
         {
             throw std::runtime_error("Failed to start recording on the command buffer");
         }
     }
 
+    void VulkanCommandBuffer::begin(VkCommandBufferUsageFlags flags, IVulkanRenderPass const * renderPass, IVulkanFramebuffer const * framebuffer, uint32_t subpass) const
+    {
+        VkCommandBufferInheritanceInfo commandBufferInheritanceInfo{ };
+        commandBufferInheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        commandBufferInheritanceInfo.renderPass = renderPass->getRenderPass();
+        commandBufferInheritanceInfo.subpass = subpass;
+        commandBufferInheritanceInfo.framebuffer = framebuffer ? framebuffer->getFramebuffer() : VK_NULL_HANDLE;
+
+        VkCommandBufferBeginInfo commandBufferBeginInfo{ };
+        commandBufferBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        commandBufferBeginInfo.flags = flags;
+        commandBufferBeginInfo.pInheritanceInfo = &commandBufferInheritanceInfo;
+
+        barrierBatch.clear();
+
+        if (vkBeginCommandBuffer(commandBuffer, &commandBufferBeginInfo) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to start recording on the secondary command buffer");
+        }
+    }
+
     void VulkanCommandBuffer::end() const
     {
+        flushBarriers();
+
         if (vkEndCommandBuffer(commandBuffer) != VK_SUCCESS)
         {
             throw std::runtime_error("Failed to stop recording on the command buffer");
         }
     }
+
+    VulkanBarrierBatch & VulkanCommandBuffer::getBarrierBatch() const noexcept
+    {
+        return barrierBatch;
+    }
+
+    void VulkanCommandBuffer::flushBarriers() const
+    {
+        barrierBatch.record(commandBuffer, synchronization2);
+    }
+
+    void VulkanCommandBuffer::executeCommands(std::vector<IVulkanCommandBuffer const *> const & commandBuffers) const
+    {
+        if (commandBuffers.empty())
+        {
+            return;
+        }
+
+        std::vector<VkCommandBuffer> commandBufferHandles{ };
+        commandBufferHandles.reserve(commandBuffers.size());
+        for (auto const * secondaryCommandBuffer : commandBuffers)
+        {
+            commandBufferHandles.push_back(secondaryCommandBuffer->getCommandBuffer());
+        }
+
+        vkCmdExecuteCommands(commandBuffer, static_cast<uint32_t>(commandBufferHandles.size()), commandBufferHandles.data());
+    }
+
+    void VulkanCommandBuffer::setViewport(VkViewport const & viewport) const
+    {
+        vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+    }
+
+    void VulkanCommandBuffer::setScissor(VkRect2D const & scissor) const
+    {
+        vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+    }
+
+    void VulkanCommandBuffer::setCullMode(VkCullModeFlags cullMode) const
+    {
+        vkCmdSetCullMode(commandBuffer, cullMode);
+    }
+
+    void VulkanCommandBuffer::setFrontFace(VkFrontFace frontFace) const
+    {
+        vkCmdSetFrontFace(commandBuffer, frontFace);
+    }
+
+    void VulkanCommandBuffer::setPrimitiveTopology(VkPrimitiveTopology topology) const
+    {
+        vkCmdSetPrimitiveTopology(commandBuffer, topology);
+    }
+
+    void VulkanCommandBuffer::setDepthTestEnable(bool depthTestEnable) const
+    {
+        vkCmdSetDepthTestEnable(commandBuffer, depthTestEnable ? VK_TRUE : VK_FALSE);
+    }
+
+    void VulkanCommandBuffer::setDepthWriteEnable(bool depthWriteEnable) const
+    {
+        vkCmdSetDepthWriteEnable(commandBuffer, depthWriteEnable ? VK_TRUE : VK_FALSE);
+    }
+
+    void VulkanCommandBuffer::setDepthCompareOp(VkCompareOp depthCompareOp) const
+    {
+        vkCmdSetDepthCompareOp(commandBuffer, depthCompareOp);
+    }
+
+    void VulkanCommandBuffer::dispatch(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) const
+    {
+        flushBarriers();
+        vkCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
+    }
+
+    void VulkanCommandBuffer::dispatchIndirect(IVulkanBuffer const * buffer, VkDeviceSize offset) const
+    {
+        flushBarriers();
+        vkCmdDispatchIndirect(commandBuffer, buffer->getBuffer(), offset);
+    }
+
+    void VulkanCommandBuffer::pushDescriptorSet(IVulkanPipeline const * pipeline, VkPipelineBindPoint pipelineBindPoint, uint32_t set, VulkanDescriptorWriteBatch const & writeBatch, IVulkanDevice const * device) const
+    {
+        PFN_vkCmdPushDescriptorSetKHR cmdPushDescriptorSet = device->getCmdPushDescriptorSet();
+        if (!cmdPushDescriptorSet)
+        {
+            throw std::runtime_error("Failed to push descriptor set, push descriptors are not enabled on the device");
+        }
+
+        std::vector<VkWriteDescriptorSet> const & descriptorWrites = writeBatch.getWrites();
+        cmdPushDescriptorSet(commandBuffer, pipelineBindPoint, pipeline->getPipelineLayout(), set, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data());
+    }
 }
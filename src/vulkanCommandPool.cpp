@@ -40,4 +40,12 @@ namespace siofraEngine::systems
     {
         return commandPool;
     }
+
+    void VulkanCommandPool::reset() const
+    {
+        if (vkResetCommandPool(device->getLogicalDevice(), commandPool, 0) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to reset command pool");
+        }
+    }
 }
@@ -71,6 +71,12 @@ namespace siofraEngine::systems
          */
         VkCommandPool getCommandPool() const noexcept override;
 
+        /**
+         * @brief Reset the command pool, returning every command buffer allocated from it to the initial state.
+         * None of the command buffers may be pending execution
+         */
+        void reset() const override;
+
     private:
         /**
          * @brief Vulkan command pool handle
@@ -0,0 +1,56 @@
+#include "systems/renderer/vulkan/vulkanComponents/vulkanCommandPoolSet.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanCommandPoolSet::VulkanCommandPoolSet(std::vector<std::unique_ptr<IVulkanCommandPool>> commandPools, uint32_t frameCount, uint32_t threadCount) :
+        commandPools{std::move(commandPools)},
+        frameCount{frameCount},
+        threadCount{threadCount}
+    {
+
+    }
+
+    VulkanCommandPoolSet::VulkanCommandPoolSet(VulkanCommandPoolSet &&other) noexcept :
+        commandPools{std::move(other.commandPools)},
+        frameCount{other.frameCount},
+        threadCount{other.threadCount}
+    {
+        other.frameCount = 0;
+        other.threadCount = 0;
+    }
+
+    VulkanCommandPoolSet& VulkanCommandPoolSet::operator=(VulkanCommandPoolSet &&other) noexcept
+    {
+        commandPools = std::move(other.commandPools);
+        frameCount = other.frameCount;
+        threadCount = other.threadCount;
+        other.frameCount = 0;
+        other.threadCount = 0;
+        return *this;
+    }
+
+    VulkanCommandPoolSet::operator bool() const noexcept
+    {
+        return !commandPools.empty();
+    }
+
+    IVulkanCommandPool const * VulkanCommandPoolSet::getCommandPool(uint32_t frameIndex, uint32_t threadIndex) const
+    {
+        if (frameIndex >= frameCount || threadIndex >= threadCount)
+        {
+            throw std::runtime_error("Failed to get command pool, frame or thread index is out of range");
+        }
+
+        return commandPools[static_cast<size_t>(frameIndex) * threadCount + threadIndex].get();
+    }
+
+    uint32_t VulkanCommandPoolSet::getFrameCount() const noexcept
+    {
+        return frameCount;
+    }
+
+    uint32_t VulkanCommandPoolSet::getThreadCount() const noexcept
+    {
+        return threadCount;
+    }
+}
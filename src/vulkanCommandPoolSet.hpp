@@ -0,0 +1,106 @@
+#pragma once
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanCommandPoolSet.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Holds one command pool per recording thread for each frame in flight, so command buffers can be recorded in parallel
+     * without synchronizing access to a shared pool
+     */
+    class VulkanCommandPoolSet : public IVulkanCommandPoolSet
+    {
+    public:
+        /**
+         * @brief VulkanCommandPoolSet builder
+         */
+        class Builder;
+
+        /**
+         * @brief VulkanCommandPoolSet constructor
+         * 
+         * @param commandPools The command pools, grouped by frame in flight with one command pool per recording thread in each group
+         * @param frameCount The number of frames in flight
+         * @param threadCount The number of recording threads
+         */
+        VulkanCommandPoolSet(std::vector<std::unique_ptr<IVulkanCommandPool>> commandPools, uint32_t frameCount, uint32_t threadCount);
+
+        /**
+         * @brief VulkanCommandPoolSet copy constructor
+         * 
+         * @param other VulkanCommandPoolSet to copy
+         */
+        VulkanCommandPoolSet(VulkanCommandPoolSet const &other) = delete;
+
+        /**
+         * @brief VulkanCommandPoolSet move constructor
+         * 
+         * @param other VulkanCommandPoolSet to move
+         */
+        VulkanCommandPoolSet(VulkanCommandPoolSet &&other) noexcept;
+
+        /**
+         * @brief VulkanCommandPoolSet copy assignment
+         * 
+         * @param other VulkanCommandPoolSet to copy
+         */
+        VulkanCommandPoolSet& operator=(const VulkanCommandPoolSet &other) = delete;
+
+        /**
+         * @brief VulkanCommandPoolSet move assignment
+         * 
+         * @param other VulkanCommandPoolSet to move
+         */
+        VulkanCommandPoolSet& operator=(VulkanCommandPoolSet &&other) noexcept;
+
+        /**
+         * @brief Check if the wrapped command pools are initialized
+         * 
+         * @returns True if the wrapped command pools are intialized, otherwise false
+         */
+        operator bool() const noexcept override;
+
+        /**
+         * @brief Get the command pool owned by a recording thread for a frame in flight. A command pool, and the command buffers
+         * allocated from it, must only be used by one thread at a time
+         * 
+         * @param frameIndex Index of the frame in flight
+         * @param threadIndex Index of the recording thread
+         * @returns The command pool
+         */
+        IVulkanCommandPool const * getCommandPool(uint32_t frameIndex, uint32_t threadIndex) const override;
+
+        /**
+         * @brief Get the number of frames in flight
+         * 
+         * @returns The number of frames in flight
+         */
+        uint32_t getFrameCount() const noexcept override;
+
+        /**
+         * @brief Get the number of recording threads
+         * 
+         * @returns The number of recording threads
+         */
+        uint32_t getThreadCount() const noexcept override;
+
+    private:
+        /**
+         * @brief The command pools, grouped by frame in flight
+         */
+        std::vector<std::unique_ptr<IVulkanCommandPool>> commandPools{ };
+
+        /**
+         * @brief The number of frames in flight
+         */
+        uint32_t frameCount{ 0 };
+
+        /**
+         * @brief The number of recording threads
+         */
+        uint32_t threadCount{ 0 };
+    };
+}
@@ -0,0 +1,59 @@
+#include "systems/renderer/vulkan/vulkanComponents/vulkanComputePipeline.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanComputePipeline::VulkanComputePipeline(VkPipeline pipeline, std::shared_ptr<IVulkanPipelineLayout> pipelineLayout, IVulkanDevice const * device) :
+        pipeline{pipeline},
+        pipelineLayout{std::move(pipelineLayout)},
+        device{device}
+    {
+
+    }
+
+    VulkanComputePipeline::VulkanComputePipeline(VulkanComputePipeline &&other) noexcept :
+        pipeline{other.pipeline},
+        pipelineLayout{std::move(other.pipelineLayout)},
+        device{other.device}
+    {
+        other.pipeline = VK_NULL_HANDLE;
+        other.device = nullptr;
+    }
+
+    VulkanComputePipeline::~VulkanComputePipeline()
+    {
+        // The pipeline layout is released with the last pipeline referencing it
+        vkDestroyPipeline(device->getLogicalDevice(), pipeline, nullptr);
+    }
+
+    VulkanComputePipeline& VulkanComputePipeline::operator=(VulkanComputePipeline &&other) noexcept
+    {
+        pipeline = other.pipeline;
+        pipelineLayout = std::move(other.pipelineLayout);
+        device = other.device;
+        other.pipeline = VK_NULL_HANDLE;
+        other.device = nullptr;
+        return *this;
+    }
+
+    VulkanComputePipeline::operator bool() const noexcept
+    {
+        return pipeline != VK_NULL_HANDLE &&
+            pipelineLayout &&
+            *pipelineLayout;
+    }
+
+    VkPipeline VulkanComputePipeline::getPipeline() const noexcept
+    {
+        return pipeline;
+    }
+
+    VkPipelineLayout VulkanComputePipeline::getPipelineLayout() const noexcept
+    {
+        return pipelineLayout ? pipelineLayout->getPipelineLayout() : VK_NULL_HANDLE;
+    }
+
+    void VulkanComputePipeline::bind(IVulkanCommandBuffer const * commandBuffer, VkPipelineBindPoint pipelineBindPoint) const
+    {
+        vkCmdBindPipeline(commandBuffer->getCommandBuffer(), pipelineBindPoint, pipeline);
+    }
+}
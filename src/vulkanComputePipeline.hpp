@@ -0,0 +1,108 @@
+#pragma once
+
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanPipeline.hpp"
+#include <memory>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanPipelineLayout.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan compute pipeline
+     */
+    class VulkanComputePipeline : public IVulkanPipeline
+    {
+    public:
+        /**
+         * @brief VulkanComputePipeline builder
+         */
+        class Builder;
+
+        /**
+         * @brief VulkanComputePipeline constructor
+         * 
+         * @param pipeline Vulkan pipeline handle
+         * @param pipelineLayout The pipeline layout, which may be shared with other pipelines
+         * @param device The Vulkan device used to create the pipeline
+         */
+        VulkanComputePipeline(VkPipeline pipeline, std::shared_ptr<IVulkanPipelineLayout> pipelineLayout, IVulkanDevice const * device);
+
+        /**
+         * @brief VulkanComputePipeline copy constructor
+         * 
+         * @param other VulkanComputePipeline to copy
+         */
+        VulkanComputePipeline(VulkanComputePipeline const &other) = delete;
+
+        /**
+         * @brief VulkanComputePipeline move constructor
+         * 
+         * @param other VulkanComputePipeline to move
+         */
+        VulkanComputePipeline(VulkanComputePipeline &&other) noexcept;
+
+        /**
+         * @brief VulkanComputePipeline destructor
+         */
+        ~VulkanComputePipeline();
+
+        /**
+         * @brief VulkanComputePipeline copy assignment
+         * 
+         * @param other VulkanComputePipeline to copy
+         */
+        VulkanComputePipeline& operator=(const VulkanComputePipeline &other) = delete;
+
+        /**
+         * @brief VulkanComputePipeline move assignment
+         * 
+         * @param other VulkanComputePipeline to move
+         */
+        VulkanComputePipeline& operator=(VulkanComputePipeline &&other) noexcept;
+
+        /**
+         * @brief Check if the wrapped handle is initialized
+         * 
+         * @returns True if the wrapped handle is intialized, otherwise false
+         */
+        operator bool() const noexcept override;
+        
+        /**
+         * @brief Get the Vulkan pipeline handle
+         * 
+         * @returns The Vulkan pipeline handle
+         */
+        VkPipeline getPipeline() const noexcept override;
+
+        /**
+         * @brief Get the vulkan pipeline layout handle
+         * 
+         * @returns The vulkan pipeline layout handle
+         */
+        VkPipelineLayout getPipelineLayout() const noexcept override;
+
+        /**
+         * @brief Bind the pipeline to a command buffer
+         * 
+         * @param commandBuffer The command buffer to bind to
+         * @param pipelineBindPoint Specifies to which bind point the pipeline is bound
+         */
+        void bind(IVulkanCommandBuffer const * commandBuffer, VkPipelineBindPoint pipelineBindPoint) const override;
+
+    private:
+        /**
+         * @brief Vulkan pipeline handle
+         */
+        VkPipeline pipeline{ VK_NULL_HANDLE };
+
+        /**
+         * @brief The pipeline layout, which may be shared with other pipelines
+         */
+        std::shared_ptr<IVulkanPipelineLayout> pipelineLayout{ nullptr };
+
+        /**
+         * @brief The Vulkan device used to create the pipeline
+         */
+        IVulkanDevice const * device{ nullptr };
+    };
+}
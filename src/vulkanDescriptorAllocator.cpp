@@ -0,0 +1,143 @@
+#include "systems/renderer/vulkan/vulkanComponents/vulkanDescriptorAllocator.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanDescriptorAllocator::VulkanDescriptorAllocator(uint32_t frameCount, std::vector<VkDescriptorPoolSize> descriptorsPerSet, uint32_t setsPerPool, VkDescriptorPoolCreateFlags flags, IVulkanDevice const * device) :
+        frames(frameCount),
+        descriptorsPerSet{descriptorsPerSet},
+        setsPerPool{setsPerPool},
+        flags{flags},
+        device{device}
+    {
+        for (auto & frame : frames)
+        {
+            frame.nextPoolSets = setsPerPool;
+        }
+    }
+
+    VulkanDescriptorAllocator::~VulkanDescriptorAllocator()
+    {
+        for (auto & frame : frames)
+        {
+            for (auto & pool : frame.pools)
+            {
+                vkDestroyDescriptorPool(device->getLogicalDevice(), pool, nullptr);
+            }
+        }
+    }
+
+    VulkanDescriptorAllocator::operator bool() const noexcept
+    {
+        return !frames.empty() && device != nullptr;
+    }
+
+    std::unique_ptr<IVulkanDescriptorSet> VulkanDescriptorAllocator::allocate(IVulkanDescriptorSetLayout const * descriptorSetLayout)
+    {
+        std::vector<VkDescriptorSet> descriptorSetHandles(1, VK_NULL_HANDLE);
+        allocateHandles(descriptorSetLayout, descriptorSetHandles);
+        return std::make_unique<VulkanDescriptorSet>(descriptorSetHandles[0]);
+    }
+
+    std::vector<std::unique_ptr<IVulkanDescriptorSet>> VulkanDescriptorAllocator::allocate(IVulkanDescriptorSetLayout const * descriptorSetLayout, uint32_t count)
+    {
+        std::vector<VkDescriptorSet> descriptorSetHandles(count, VK_NULL_HANDLE);
+        allocateHandles(descriptorSetLayout, descriptorSetHandles);
+
+        std::vector<std::unique_ptr<IVulkanDescriptorSet>> descriptorSets(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            descriptorSets[i] = std::make_unique<VulkanDescriptorSet>(descriptorSetHandles[i]);
+        }
+        return descriptorSets;
+    }
+
+    void VulkanDescriptorAllocator::beginFrame(uint32_t frameIndex)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        currentFrame = frameIndex % static_cast<uint32_t>(frames.size());
+
+        Frame & frame = frames[currentFrame];
+        for (auto & pool : frame.pools)
+        {
+            if (vkResetDescriptorPool(device->getLogicalDevice(), pool, 0) != VK_SUCCESS)
+            {
+                throw std::runtime_error("Failed to reset descriptor pool");
+            }
+        }
+        frame.currentPool = 0;
+    }
+
+    size_t VulkanDescriptorAllocator::getPoolCount() const noexcept
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t poolCount{ 0 };
+        for (auto const & frame : frames)
+        {
+            poolCount += frame.pools.size();
+        }
+        return poolCount;
+    }
+
+    void VulkanDescriptorAllocator::allocateHandles(IVulkanDescriptorSetLayout const * descriptorSetLayout, std::vector<VkDescriptorSet> & descriptorSets)
+    {
+        uint32_t count = static_cast<uint32_t>(descriptorSets.size());
+        std::vector<VkDescriptorSetLayout> descriptorSetLayoutHandles(count, descriptorSetLayout->getDescriptorSetLayout());
+
+        VkDescriptorSetAllocateInfo setAllocInfo{ };
+        setAllocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        setAllocInfo.descriptorSetCount = count;
+        setAllocInfo.pSetLayouts = descriptorSetLayoutHandles.data();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        Frame & frame = frames[currentFrame];
+        while (true)
+        {
+            bool createdPool{ false };
+            if (frame.currentPool == frame.pools.size())
+            {
+                uint32_t maxSets = std::max(frame.nextPoolSets, count);
+                frame.pools.push_back(createPool(maxSets));
+                frame.nextPoolSets = std::min(frame.nextPoolSets * 2, maxSetsPerPool);
+                createdPool = true;
+            }
+
+            setAllocInfo.descriptorPool = frame.pools[frame.currentPool];
+            VkResult result = vkAllocateDescriptorSets(device->getLogicalDevice(), &setAllocInfo, descriptorSets.data());
+            if (result == VK_SUCCESS)
+            {
+                return;
+            }
+
+            // An exhausted or fragmented pool stays full until the frame is reset, so later allocations skip it
+            bool poolExhausted = result == VK_ERROR_OUT_OF_POOL_MEMORY || result == VK_ERROR_FRAGMENTED_POOL;
+            if (!poolExhausted || createdPool)
+            {
+                throw std::runtime_error("Failed to allocate descriptor set(s)");
+            }
+            ++frame.currentPool;
+        }
+    }
+
+    VkDescriptorPool VulkanDescriptorAllocator::createPool(uint32_t maxSets) const
+    {
+        std::vector<VkDescriptorPoolSize> poolSizes{ descriptorsPerSet };
+        for (auto & poolSize : poolSizes)
+        {
+            poolSize.descriptorCount *= maxSets;
+        }
+
+        VkDescriptorPoolCreateInfo poolCreateInfo{ };
+        poolCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolCreateInfo.flags = flags;
+        poolCreateInfo.maxSets = maxSets;
+        poolCreateInfo.pPoolSizes = poolSizes.data();
+        poolCreateInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+
+        VkDescriptorPool descriptorPool{ VK_NULL_HANDLE };
+        if (vkCreateDescriptorPool(device->getLogicalDevice(), &poolCreateInfo, nullptr, &descriptorPool) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create descriptor pool");
+        }
+        return descriptorPool;
+    }
+}
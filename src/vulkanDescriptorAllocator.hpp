@@ -0,0 +1,184 @@
+#pragma once
+
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDescriptorAllocator.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/vulkanDescriptorSet.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Allocates descriptor sets of one layout class from per frame lists of descriptor pools. A pool which runs out
+     * of space is followed by a new, larger pool, and a frame's pools are reset together, so sets are never freed individually
+     */
+    class VulkanDescriptorAllocator : public IVulkanDescriptorAllocator
+    {
+    public:
+        /**
+         * @brief VulkanDescriptorAllocator builder
+         */
+        class Builder;
+
+        /**
+         * @brief VulkanDescriptorAllocator constructor
+         * 
+         * @param frameCount The number of frames in flight
+         * @param descriptorsPerSet Descriptor counts per descriptor type required by a typical set of the layout class
+         * @param setsPerPool The number of sets in the first pool of each frame
+         * @param flags The descriptor pool creation flags
+         * @param device The device the descriptor sets are allocated on
+         */
+        VulkanDescriptorAllocator(uint32_t frameCount, std::vector<VkDescriptorPoolSize> descriptorsPerSet, uint32_t setsPerPool, VkDescriptorPoolCreateFlags flags, IVulkanDevice const * device);
+
+        /**
+         * @brief VulkanDescriptorAllocator copy constructor
+         * 
+         * @param other VulkanDescriptorAllocator to copy
+         */
+        VulkanDescriptorAllocator(VulkanDescriptorAllocator const &other) = delete;
+
+        /**
+         * @brief VulkanDescriptorAllocator move constructor
+         * 
+         * @param other VulkanDescriptorAllocator to move
+         */
+        VulkanDescriptorAllocator(VulkanDescriptorAllocator &&other) = delete;
+
+        /**
+         * @brief VulkanDescriptorAllocator destructor
+         */
+        ~VulkanDescriptorAllocator();
+
+        /**
+         * @brief VulkanDescriptorAllocator copy assignment
+         * 
+         * @param other VulkanDescriptorAllocator to copy
+         */
+        VulkanDescriptorAllocator& operator=(const VulkanDescriptorAllocator &other) = delete;
+
+        /**
+         * @brief VulkanDescriptorAllocator move assignment
+         * 
+         * @param other VulkanDescriptorAllocator to move
+         */
+        VulkanDescriptorAllocator& operator=(VulkanDescriptorAllocator &&other) = delete;
+
+        /**
+         * @brief Check if the allocator is initialized
+         * 
+         * @returns True if the allocator is intialized, otherwise false
+         */
+        operator bool() const noexcept override;
+
+        /**
+         * @brief Allocate a descriptor set from the current frame's pools. The set is valid until the frame is next begun
+         * 
+         * @param descriptorSetLayout The descriptor set layout
+         * @returns The descriptor set
+         */
+        std::unique_ptr<IVulkanDescriptorSet> allocate(IVulkanDescriptorSetLayout const * descriptorSetLayout) override;
+
+        /**
+         * @brief Allocate descriptor sets from the current frame's pools with a single allocation. The sets are valid until the frame is next begun
+         * 
+         * @param descriptorSetLayout The descriptor set layout
+         * @param count Number of descriptor sets to allocate
+         * @returns The descriptor sets
+         */
+        std::vector<std::unique_ptr<IVulkanDescriptorSet>> allocate(IVulkanDescriptorSetLayout const * descriptorSetLayout, uint32_t count) override;
+
+        /**
+         * @brief Begin allocating for a frame, resetting every pool the frame allocated from. The frame's previous submission must have completed
+         * 
+         * @param frameIndex Index of the frame in flight
+         */
+        void beginFrame(uint32_t frameIndex) override;
+
+        /**
+         * @brief Get the number of descriptor pools created across all frames
+         * 
+         * @returns The number of descriptor pools
+         */
+        size_t getPoolCount() const noexcept override;
+
+    private:
+        /**
+         * @brief Upper limit on the number of sets in a single pool as pools grow
+         */
+        static constexpr uint32_t maxSetsPerPool{ 4096 };
+
+        /**
+         * @brief The pools used by a single frame in flight
+         */
+        struct Frame
+        {
+            /**
+             * @brief Vulkan descriptor pool handles, in allocation order
+             */
+            std::vector<VkDescriptorPool> pools{ };
+
+            /**
+             * @brief Index of the pool currently allocated from
+             */
+            size_t currentPool{ 0 };
+
+            /**
+             * @brief The number of sets in the next pool created for the frame
+             */
+            uint32_t nextPoolSets{ 0 };
+        };
+
+        /**
+         * @brief The frames in flight
+         */
+        std::vector<Frame> frames{ };
+
+        /**
+         * @brief Index of the frame currently allocating
+         */
+        uint32_t currentFrame{ 0 };
+
+        /**
+         * @brief Descriptor counts per descriptor type required by a typical set of the layout class
+         */
+        std::vector<VkDescriptorPoolSize> descriptorsPerSet{ };
+
+        /**
+         * @brief The number of sets in the first pool of each frame
+         */
+        uint32_t setsPerPool{ 0 };
+
+        /**
+         * @brief The descriptor pool creation flags
+         */
+        VkDescriptorPoolCreateFlags flags{ 0 };
+
+        /**
+         * @brief Guards the frames
+         */
+        mutable std::mutex mutex{ };
+
+        /**
+         * @brief The device the descriptor sets are allocated on
+         */
+        IVulkanDevice const * device{ nullptr };
+
+        /**
+         * @brief Allocate descriptor sets from the current frame, moving to the frame's next pool, or creating one, when a pool is exhausted
+         * 
+         * @param descriptorSetLayout The descriptor set layout
+         * @param descriptorSets The allocated descriptor set handles to be populated. Its size is the number of sets to allocate
+         */
+        void allocateHandles(IVulkanDescriptorSetLayout const * descriptorSetLayout, std::vector<VkDescriptorSet> & descriptorSets);
+
+        /**
+         * @brief Create a descriptor pool
+         * 
+         * @param maxSets The maximum number of sets that can be allocated from the pool
+         * @returns Vulkan descriptor pool handle
+         */
+        VkDescriptorPool createPool(uint32_t maxSets) const;
+    };
+}
@@ -40,4 +40,12 @@ namespace siofraEngine::systems
     {
         return descriptorPool;
     }
+
+    void VulkanDescriptorPool::reset() const
+    {
+        if (vkResetDescriptorPool(device->getLogicalDevice(), descriptorPool, 0) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to reset descriptor pool");
+        }
+    }
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stdexcept>
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanDescriptorPool.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
 
@@ -70,6 +71,11 @@ namespace siofraEngine::systems
          * @returns The Vulkan descriptor pool handle
          */
         VkDescriptorPool getDescriptorPool() const noexcept override;
+
+        /**
+         * @brief Return every descriptor set allocated from the pool to the pool. The sets must no longer be in use by the device
+         */
+        void reset() const override;
     
     private:
         /**
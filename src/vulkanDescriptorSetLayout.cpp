@@ -2,8 +2,9 @@
 
 namespace siofraEngine::systems
 {
-    VulkanDescriptorSetLayout::VulkanDescriptorSetLayout(VkDescriptorSetLayout descriptorSetLayout, IVulkanDevice const * device) :
+    VulkanDescriptorSetLayout::VulkanDescriptorSetLayout(VkDescriptorSetLayout descriptorSetLayout, std::string stateKey, IVulkanDevice const * device) :
         descriptorSetLayout{descriptorSetLayout},
+        stateKey{std::move(stateKey)},
         device{device}
     {
 
@@ -11,6 +12,7 @@ namespace siofraEngine::systems
 
     VulkanDescriptorSetLayout::VulkanDescriptorSetLayout(VulkanDescriptorSetLayout &&other) noexcept :
         descriptorSetLayout{other.descriptorSetLayout},
+        stateKey{std::move(other.stateKey)},
         device{other.device}
     {
         other.descriptorSetLayout = VK_NULL_HANDLE;
@@ -25,6 +27,7 @@ namespace siofraEngine::systems
     VulkanDescriptorSetLayout& VulkanDescriptorSetLayout::operator=(VulkanDescriptorSetLayout &&other) noexcept
     {
         descriptorSetLayout = other.descriptorSetLayout;
+        stateKey = std::move(other.stateKey);
         device = other.device;
         other.descriptorSetLayout = VK_NULL_HANDLE;
         other.device = nullptr;
@@ -40,4 +43,9 @@ namespace siofraEngine::systems
     {
         return descriptorSetLayout;
     }
+
+    std::string const & VulkanDescriptorSetLayout::getStateKey() const noexcept
+    {
+        return stateKey;
+    }
 }
@@ -20,9 +20,10 @@ namespace siofraEngine::systems
          * @brief VulkanDescriptorSetLayout constructor
          * 
          * @param descriptorSetLayout Vulkan descriptor set layout handle
+         * @param stateKey Key identifying the create flags and bindings of the layout
          * @param device Vulkan device used to create the descriptor set layout
          */
-        VulkanDescriptorSetLayout(VkDescriptorSetLayout descriptorSetLayout, IVulkanDevice const * device);
+        VulkanDescriptorSetLayout(VkDescriptorSetLayout descriptorSetLayout, std::string stateKey, IVulkanDevice const * device);
 
         /**
          * @brief VulkanDescriptorSetLayout copy constructor
@@ -71,12 +72,24 @@ namespace siofraEngine::systems
          */
         VkDescriptorSetLayout getDescriptorSetLayout() const noexcept override;
 
+        /**
+         * @brief Get a key identifying the create flags and bindings of the layout. Equal keys identify compatible layouts, regardless of handle values
+         * 
+         * @returns The state key
+         */
+        std::string const & getStateKey() const noexcept override;
+
     private:
         /**
          * @brief Vulkan descriptor set layout handle
          */
         VkDescriptorSetLayout descriptorSetLayout{ VK_NULL_HANDLE };
 
+        /**
+         * @brief Key identifying the create flags and bindings of the layout
+         */
+        std::string stateKey{ };
+
         /**
          * @brief Vulkan device used to create the descriptor set layout
          */
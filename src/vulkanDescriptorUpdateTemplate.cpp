@@ -0,0 +1,48 @@
+#include "systems/renderer/vulkan/vulkanComponents/vulkanDescriptorUpdateTemplate.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanDescriptorUpdateTemplate::VulkanDescriptorUpdateTemplate(VkDescriptorUpdateTemplate descriptorUpdateTemplate, IVulkanDevice const * device) :
+        descriptorUpdateTemplate{descriptorUpdateTemplate},
+        device{device}
+    {
+
+    }
+
+    VulkanDescriptorUpdateTemplate::VulkanDescriptorUpdateTemplate(VulkanDescriptorUpdateTemplate &&other) noexcept :
+        descriptorUpdateTemplate{other.descriptorUpdateTemplate},
+        device{other.device}
+    {
+        other.descriptorUpdateTemplate = VK_NULL_HANDLE;
+        other.device = nullptr;
+    }
+
+    VulkanDescriptorUpdateTemplate::~VulkanDescriptorUpdateTemplate()
+    {
+        vkDestroyDescriptorUpdateTemplate(device->getLogicalDevice(), descriptorUpdateTemplate, nullptr);
+    }
+
+    VulkanDescriptorUpdateTemplate& VulkanDescriptorUpdateTemplate::operator=(VulkanDescriptorUpdateTemplate &&other) noexcept
+    {
+        descriptorUpdateTemplate = other.descriptorUpdateTemplate;
+        device = other.device;
+        other.descriptorUpdateTemplate = VK_NULL_HANDLE;
+        other.device = nullptr;
+        return *this;
+    }
+
+    VulkanDescriptorUpdateTemplate::operator bool() const noexcept
+    {
+        return descriptorUpdateTemplate != VK_NULL_HANDLE;
+    }
+
+    VkDescriptorUpdateTemplate VulkanDescriptorUpdateTemplate::getDescriptorUpdateTemplate() const noexcept
+    {
+        return descriptorUpdateTemplate;
+    }
+
+    void VulkanDescriptorUpdateTemplate::update(IVulkanDescriptorSet const * descriptorSet, void const * data) const
+    {
+        vkUpdateDescriptorSetWithTemplate(device->getLogicalDevice(), descriptorSet->getDescriptorSet(), descriptorUpdateTemplate, data);
+    }
+}
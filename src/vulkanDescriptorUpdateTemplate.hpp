@@ -0,0 +1,93 @@
+#pragma once
+
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDescriptorUpdateTemplate.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan descriptor update template
+     */
+    class VulkanDescriptorUpdateTemplate : public IVulkanDescriptorUpdateTemplate
+    {
+    public:
+        /**
+         * @brief VulkanDescriptorUpdateTemplate builder
+         */
+        class Builder;
+
+        /**
+         * @brief VulkanDescriptorUpdateTemplate constructor
+         * 
+         * @param descriptorUpdateTemplate Vulkan descriptor update template handle
+         * @param device Vulkan device used to create the descriptor update template
+         */
+        VulkanDescriptorUpdateTemplate(VkDescriptorUpdateTemplate descriptorUpdateTemplate, IVulkanDevice const * device);
+
+        /**
+         * @brief VulkanDescriptorUpdateTemplate copy constructor
+         * 
+         * @param other VulkanDescriptorUpdateTemplate to copy
+         */
+        VulkanDescriptorUpdateTemplate(VulkanDescriptorUpdateTemplate const &other) = delete;
+
+        /**
+         * @brief VulkanDescriptorUpdateTemplate move constructor
+         * 
+         * @param other VulkanDescriptorUpdateTemplate to move
+         */
+        VulkanDescriptorUpdateTemplate(VulkanDescriptorUpdateTemplate &&other) noexcept;
+
+        /**
+         * @brief VulkanDescriptorUpdateTemplate destructor
+         */
+        ~VulkanDescriptorUpdateTemplate();
+
+        /**
+         * @brief VulkanDescriptorUpdateTemplate copy assignment
+         * 
+         * @param other VulkanDescriptorUpdateTemplate to copy
+         */
+        VulkanDescriptorUpdateTemplate& operator=(const VulkanDescriptorUpdateTemplate &other) = delete;
+
+        /**
+         * @brief VulkanDescriptorUpdateTemplate move assignment
+         * 
+         * @param other VulkanDescriptorUpdateTemplate to move
+         */
+        VulkanDescriptorUpdateTemplate& operator=(VulkanDescriptorUpdateTemplate &&other) noexcept;
+
+        /**
+         * @brief Check if the wrapped handle is initialized
+         * 
+         * @returns True if the wrapped handle is intialized, otherwise false
+         */
+        operator bool() const noexcept override;
+
+        /**
+         * @brief Get the Vulkan descriptor update template handle
+         * 
+         * @returns The Vulkan descriptor update template handle
+         */
+        VkDescriptorUpdateTemplate getDescriptorUpdateTemplate() const noexcept override;
+
+        /**
+         * @brief Update every descriptor covered by the template with a single call
+         * 
+         * @param descriptorSet The descriptor set to update, which must use the template's descriptor set layout
+         * @param data Packed descriptor infos laid out as described by the template entries
+         */
+        void update(IVulkanDescriptorSet const * descriptorSet, void const * data) const override;
+
+    private:
+        /**
+         * @brief Vulkan descriptor update template handle
+         */
+        VkDescriptorUpdateTemplate descriptorUpdateTemplate{ VK_NULL_HANDLE };
+
+        /**
+         * @brief Vulkan device used to create the descriptor update template
+         */
+        IVulkanDevice const * device{ nullptr };
+    };
+}
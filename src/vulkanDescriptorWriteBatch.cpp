@@ -0,0 +1,104 @@
+#include "systems/renderer/vulkan/vulkanComponents/vulkanDescriptorWriteBatch.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanDescriptorWriteBatch& VulkanDescriptorWriteBatch::writeBuffer(IVulkanDescriptorSet const * descriptorSet, uint32_t destinationBinding, uint32_t arrayElement, VkDescriptorType descriptorType, IVulkanBuffer const * buffer, VkDeviceSize offset, VkDeviceSize range)
+    {
+        VkDescriptorBufferInfo bufferInfo{ };
+        bufferInfo.buffer = buffer->getBuffer();
+        bufferInfo.offset = offset;
+        bufferInfo.range = range;
+        bufferInfos.push_back(bufferInfo);
+
+        addWrite(descriptorSet, destinationBinding, arrayElement, descriptorType, DescriptorInfoType::BUFFER, bufferInfos.size() - 1);
+        return *this;
+    }
+
+    VulkanDescriptorWriteBatch& VulkanDescriptorWriteBatch::writeImage(IVulkanDescriptorSet const * descriptorSet, uint32_t destinationBinding, uint32_t arrayElement, VkDescriptorType descriptorType, IVulkanImage const * image, IVulkanSampler const * sampler, VkImageLayout imageLayout)
+    {
+        VkDescriptorImageInfo imageInfo{ };
+        imageInfo.imageLayout = imageLayout;
+        imageInfo.imageView = image ? image->getImageView() : VK_NULL_HANDLE;
+        imageInfo.sampler = sampler ? sampler->getSampler() : VK_NULL_HANDLE;
+        imageInfos.push_back(imageInfo);
+
+        addWrite(descriptorSet, destinationBinding, arrayElement, descriptorType, DescriptorInfoType::IMAGE, imageInfos.size() - 1);
+        return *this;
+    }
+
+    VulkanDescriptorWriteBatch& VulkanDescriptorWriteBatch::writeTexelBuffer(IVulkanDescriptorSet const * descriptorSet, uint32_t destinationBinding, uint32_t arrayElement, VkDescriptorType descriptorType, VkBufferView bufferView)
+    {
+        texelBufferViews.push_back(bufferView);
+
+        addWrite(descriptorSet, destinationBinding, arrayElement, descriptorType, DescriptorInfoType::TEXEL_BUFFER, texelBufferViews.size() - 1);
+        return *this;
+    }
+
+    size_t VulkanDescriptorWriteBatch::size() const noexcept
+    {
+        return pendingWrites.size();
+    }
+
+    bool VulkanDescriptorWriteBatch::empty() const noexcept
+    {
+        return pendingWrites.empty();
+    }
+
+    void VulkanDescriptorWriteBatch::clear() noexcept
+    {
+        pendingWrites.clear();
+        bufferInfos.clear();
+        imageInfos.clear();
+        texelBufferViews.clear();
+        resolvedWrites.clear();
+    }
+
+    std::vector<VkWriteDescriptorSet> const & VulkanDescriptorWriteBatch::getWrites() const
+    {
+        resolvedWrites.clear();
+        for (auto const & pendingWrite : pendingWrites)
+        {
+            VkWriteDescriptorSet descriptorWrite = pendingWrite.write;
+            switch (pendingWrite.infoType)
+            {
+            case DescriptorInfoType::BUFFER:
+                descriptorWrite.pBufferInfo = &bufferInfos[pendingWrite.infoIndex];
+                break;
+            case DescriptorInfoType::IMAGE:
+                descriptorWrite.pImageInfo = &imageInfos[pendingWrite.infoIndex];
+                break;
+            case DescriptorInfoType::TEXEL_BUFFER:
+                descriptorWrite.pTexelBufferView = &texelBufferViews[pendingWrite.infoIndex];
+                break;
+            }
+            resolvedWrites.push_back(descriptorWrite);
+        }
+        return resolvedWrites;
+    }
+
+    void VulkanDescriptorWriteBatch::commit(IVulkanDevice const * device)
+    {
+        if (pendingWrites.empty())
+        {
+            return;
+        }
+
+        std::vector<VkWriteDescriptorSet> const & descriptorWrites = getWrites();
+        vkUpdateDescriptorSets(device->getLogicalDevice(), static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
+        clear();
+    }
+
+    void VulkanDescriptorWriteBatch::addWrite(IVulkanDescriptorSet const * descriptorSet, uint32_t destinationBinding, uint32_t arrayElement, VkDescriptorType descriptorType, DescriptorInfoType infoType, size_t infoIndex)
+    {
+        PendingWrite pendingWrite{ };
+        pendingWrite.write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        pendingWrite.write.dstSet = descriptorSet ? descriptorSet->getDescriptorSet() : VK_NULL_HANDLE;
+        pendingWrite.write.dstBinding = destinationBinding;
+        pendingWrite.write.dstArrayElement = arrayElement;
+        pendingWrite.write.descriptorType = descriptorType;
+        pendingWrite.write.descriptorCount = 1;
+        pendingWrite.infoType = infoType;
+        pendingWrite.infoIndex = infoIndex;
+        pendingWrites.push_back(pendingWrite);
+    }
+}
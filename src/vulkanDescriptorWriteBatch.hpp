@@ -0,0 +1,161 @@
+#pragma once
+
+#include <vector>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDescriptorSet.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanBuffer.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanImage.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanSampler.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Collects descriptor writes across any number of descriptor sets and applies them with a single descriptor set update
+     */
+    class VulkanDescriptorWriteBatch
+    {
+    public:
+        /**
+         * @brief Add a buffer descriptor write
+         * 
+         * @param descriptorSet The descriptor set to write, or nullptr for writes pushed with a command buffer
+         * @param destinationBinding The descriptor binding within the set
+         * @param arrayElement The array element within the binding
+         * @param descriptorType The buffer descriptor type
+         * @param buffer The buffer containing the data
+         * @param offset The offset in bytes from the start of buffer
+         * @param range The size in bytes that is used for this descriptor update
+         * @returns Reference to the write batch
+         */
+        VulkanDescriptorWriteBatch& writeBuffer(IVulkanDescriptorSet const * descriptorSet, uint32_t destinationBinding, uint32_t arrayElement, VkDescriptorType descriptorType, IVulkanBuffer const * buffer, VkDeviceSize offset, VkDeviceSize range);
+
+        /**
+         * @brief Add an image descriptor write
+         * 
+         * @param descriptorSet The descriptor set to write, or nullptr for writes pushed with a command buffer
+         * @param destinationBinding The descriptor binding within the set
+         * @param arrayElement The array element within the binding
+         * @param descriptorType The image descriptor type
+         * @param image The image containing the data, or nullptr for sampler descriptors
+         * @param sampler The image sampler, or nullptr for descriptor types without a sampler
+         * @param imageLayout The layout the image will be in when accessed
+         * @returns Reference to the write batch
+         */
+        VulkanDescriptorWriteBatch& writeImage(IVulkanDescriptorSet const * descriptorSet, uint32_t destinationBinding, uint32_t arrayElement, VkDescriptorType descriptorType, IVulkanImage const * image, IVulkanSampler const * sampler, VkImageLayout imageLayout);
+
+        /**
+         * @brief Add a texel buffer descriptor write
+         * 
+         * @param descriptorSet The descriptor set to write, or nullptr for writes pushed with a command buffer
+         * @param destinationBinding The descriptor binding within the set
+         * @param arrayElement The array element within the binding
+         * @param descriptorType The texel buffer descriptor type
+         * @param bufferView Vulkan buffer view handle
+         * @returns Reference to the write batch
+         */
+        VulkanDescriptorWriteBatch& writeTexelBuffer(IVulkanDescriptorSet const * descriptorSet, uint32_t destinationBinding, uint32_t arrayElement, VkDescriptorType descriptorType, VkBufferView bufferView);
+
+        /**
+         * @brief Get the number of pending writes
+         * 
+         * @returns The number of pending writes
+         */
+        size_t size() const noexcept;
+
+        /**
+         * @brief Check if there are pending writes
+         * 
+         * @returns True if there are no pending writes, otherwise false
+         */
+        bool empty() const noexcept;
+
+        /**
+         * @brief Discard the pending writes
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Get the pending writes. They reference descriptor infos owned by the batch and are invalidated when the batch is modified.
+         * The writes are resolved into storage owned by the batch, which is reused so repeated calls do not allocate
+         * 
+         * @returns The pending writes
+         */
+        std::vector<VkWriteDescriptorSet> const & getWrites() const;
+
+        /**
+         * @brief Apply the pending writes with a single descriptor set update and clear the batch
+         * 
+         * @param device The device with which to update the descriptor sets
+         */
+        void commit(IVulkanDevice const * device);
+
+    private:
+        /**
+         * @brief The descriptor info array referenced by a pending write
+         */
+        enum class DescriptorInfoType
+        {
+            BUFFER,
+            IMAGE,
+            TEXEL_BUFFER
+        };
+
+        /**
+         * @brief A descriptor write whose info pointer is resolved on commit, as the info arrays may reallocate while writes are added
+         */
+        struct PendingWrite
+        {
+            /**
+             * @brief The descriptor write
+             */
+            VkWriteDescriptorSet write{ };
+
+            /**
+             * @brief The info array holding the written descriptor
+             */
+            DescriptorInfoType infoType{ DescriptorInfoType::BUFFER };
+
+            /**
+             * @brief Index of the written descriptor within its info array
+             */
+            size_t infoIndex{ 0 };
+        };
+
+        /**
+         * @brief The pending writes
+         */
+        std::vector<PendingWrite> pendingWrites{ };
+
+        /**
+         * @brief The written buffer descriptors
+         */
+        std::vector<VkDescriptorBufferInfo> bufferInfos{ };
+
+        /**
+         * @brief The written image descriptors
+         */
+        std::vector<VkDescriptorImageInfo> imageInfos{ };
+
+        /**
+         * @brief The written texel buffer views
+         */
+        std::vector<VkBufferView> texelBufferViews{ };
+
+        /**
+         * @brief The pending writes with their info pointers resolved. Storage is kept across clears for reuse
+         */
+        mutable std::vector<VkWriteDescriptorSet> resolvedWrites{ };
+
+        /**
+         * @brief Add a pending write of a single descriptor
+         * 
+         * @param descriptorSet The descriptor set to write, or nullptr for writes pushed with a command buffer
+         * @param destinationBinding The descriptor binding within the set
+         * @param arrayElement The array element within the binding
+         * @param descriptorType The descriptor type
+         * @param infoType The info array holding the written descriptor
+         * @param infoIndex Index of the written descriptor within its info array
+         */
+        void addWrite(IVulkanDescriptorSet const * descriptorSet, uint32_t destinationBinding, uint32_t arrayElement, VkDescriptorType descriptorType, DescriptorInfoType infoType, size_t infoIndex);
+    };
+}
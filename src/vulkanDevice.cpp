@@ -8,16 +8,23 @@ namespace siofraEngine::systems
         std::unique_ptr<IVulkanQueue> graphicsQueue,
         std::unique_ptr<IVulkanQueue> presentationQueue,
         std::unique_ptr<IVulkanQueue> transferQueue,
-        std::unique_ptr<IVulkanQueue> computeQueue) :
+        std::unique_ptr<IVulkanQueue> computeQueue,
+        std::unique_ptr<IVulkanMemoryAllocator> memoryAllocator,
+        VulkanDeviceFeatures enabledFeatures) :
 
         physicalDevice{physicalDevice},
         logicalDevice{logicalDevice},
         graphicsQueue{std::move(graphicsQueue)},
         presentationQueue{std::move(presentationQueue)},
         transferQueue{std::move(transferQueue)},
-        computeQueue{std::move(computeQueue)}
+        computeQueue{std::move(computeQueue)},
+        memoryAllocator{std::move(memoryAllocator)},
+        enabledFeatures{enabledFeatures}
     {
-
+        if (isFeatureEnabled(VulkanDeviceFeatures::PUSH_DESCRIPTOR))
+        {
+            cmdPushDescriptorSet = (PFN_vkCmdPushDescriptorSetKHR)vkGetDeviceProcAddr(logicalDevice, "vkCmdPushDescriptorSetKHR");
+        }
     }
 
     VulkanDevice::VulkanDevice(VulkanDevice &&other) noexcept :
@@ -26,7 +33,10 @@ namespace siofraEngine::systems
         graphicsQueue{std::move(other.graphicsQueue)},
         presentationQueue{std::move(other.presentationQueue)},
         transferQueue{std::move(other.transferQueue)},
-        computeQueue{std::move(other.computeQueue)}
+        computeQueue{std::move(other.computeQueue)},
+        memoryAllocator{std::move(other.memoryAllocator)},
+        enabledFeatures{other.enabledFeatures},
+        cmdPushDescriptorSet{other.cmdPushDescriptorSet}
     {
         other.physicalDevice = VK_NULL_HANDLE;
         other.logicalDevice = VK_NULL_HANDLE;
@@ -34,6 +44,7 @@ namespace siofraEngine::systems
 
     VulkanDevice::~VulkanDevice()
     {
+        memoryAllocator.reset();
         vkDestroyDevice(logicalDevice, nullptr);
     }
 
@@ -45,6 +56,9 @@ namespace siofraEngine::systems
         presentationQueue = std::move(presentationQueue);
         transferQueue = std::move(transferQueue);
         computeQueue = std::move(computeQueue);
+        memoryAllocator = std::move(other.memoryAllocator);
+        enabledFeatures = other.enabledFeatures;
+        cmdPushDescriptorSet = other.cmdPushDescriptorSet;
         other.physicalDevice = VK_NULL_HANDLE;
         other.logicalDevice = VK_NULL_HANDLE;
         return *this;
@@ -84,4 +98,19 @@ namespace siofraEngine::systems
     {
         return computeQueue;
     }
+
+    std::unique_ptr<IVulkanMemoryAllocator> const & VulkanDevice::getMemoryAllocator() const noexcept
+    {
+        return memoryAllocator;
+    }
+
+    bool VulkanDevice::isFeatureEnabled(VulkanDeviceFeatures feature) const noexcept
+    {
+        return (enabledFeatures & feature) == feature;
+    }
+
+    PFN_vkCmdPushDescriptorSetKHR VulkanDevice::getCmdPushDescriptorSet() const noexcept
+    {
+        return cmdPushDescriptorSet;
+    }
 }
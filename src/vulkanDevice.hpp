@@ -25,6 +25,8 @@ namespace siofraEngine::systems
          * @param presentationQueue presentation queue handle
          * @param transferQueue Transfer queue handle
          * @param computeQueue Compute queue handle
+         * @param memoryAllocator Device memory allocator
+         * @param enabledFeatures Optional device features enabled on the logical device
          */
         VulkanDevice(
             VkPhysicalDevice physicalDevice,
@@ -32,7 +34,9 @@ namespace siofraEngine::systems
             std::unique_ptr<IVulkanQueue> graphicsQueue,
             std::unique_ptr<IVulkanQueue> presentationQueue,
             std::unique_ptr<IVulkanQueue> transferQueue,
-            std::unique_ptr<IVulkanQueue> computeQueue);
+            std::unique_ptr<IVulkanQueue> computeQueue,
+            std::unique_ptr<IVulkanMemoryAllocator> memoryAllocator,
+            VulkanDeviceFeatures enabledFeatures);
 
         /**
          * @brief VulkanDevice copy constructor
@@ -116,6 +120,28 @@ namespace siofraEngine::systems
          */
         std::unique_ptr<IVulkanQueue> const & getComputeQueue() const noexcept override;
 
+        /**
+         * @brief Get the device memory allocator
+         * 
+         * @returns The device memory allocator
+         */
+        std::unique_ptr<IVulkanMemoryAllocator> const & getMemoryAllocator() const noexcept override;
+
+        /**
+         * @brief Check if an optional device feature was enabled when the device was created
+         * 
+         * @param feature The feature to check
+         * @returns True if the feature is enabled, otherwise false
+         */
+        bool isFeatureEnabled(VulkanDeviceFeatures feature) const noexcept override;
+
+        /**
+         * @brief Get the push descriptor command, loaded from the VK_KHR_push_descriptor extension
+         * 
+         * @returns The push descriptor command, or nullptr if push descriptors are not enabled
+         */
+        PFN_vkCmdPushDescriptorSetKHR getCmdPushDescriptorSet() const noexcept override;
+
     private:
         /**
          * @brief Vulkan physical device handle
@@ -146,5 +172,20 @@ namespace siofraEngine::systems
          * @brief Compute queue handle
          */
         std::unique_ptr<IVulkanQueue> computeQueue{ nullptr };
+
+        /**
+         * @brief Device memory allocator
+         */
+        std::unique_ptr<IVulkanMemoryAllocator> memoryAllocator{ nullptr };
+
+        /**
+         * @brief Optional device features enabled on the logical device
+         */
+        VulkanDeviceFeatures enabledFeatures{ VulkanDeviceFeatures::NONE };
+
+        /**
+         * @brief The push descriptor command, or nullptr if push descriptors are not enabled
+         */
+        PFN_vkCmdPushDescriptorSetKHR cmdPushDescriptorSet{ nullptr };
     };
 }
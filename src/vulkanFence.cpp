@@ -40,4 +40,25 @@ namespace siofraEngine::systems
     {
         return fence;
     }
+
+    void VulkanFence::wait() const
+    {
+        if (vkWaitForFences(device->getLogicalDevice(), 1, &fence, VK_TRUE, std::numeric_limits<uint64_t>::max()) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to wait for fence");
+        }
+    }
+
+    void VulkanFence::reset() const
+    {
+        if (vkResetFences(device->getLogicalDevice(), 1, &fence) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to reset fence");
+        }
+    }
+
+    bool VulkanFence::isSignaled() const
+    {
+        return vkGetFenceStatus(device->getLogicalDevice(), fence) == VK_SUCCESS;
+    }
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <limits>
+#include <stdexcept>
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanFence.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
 
@@ -71,6 +73,23 @@ namespace siofraEngine::systems
          */
         VkFence getFence() const noexcept override;
 
+        /**
+         * @brief Block until the fence is signaled
+         */
+        void wait() const override;
+
+        /**
+         * @brief Reset the fence to the unsignaled state
+         */
+        void reset() const override;
+
+        /**
+         * @brief Check if the fence is signaled without blocking
+         * 
+         * @returns True if the fence is signaled, otherwise false
+         */
+        bool isSignaled() const override;
+
     private:
         /**
          * @brief Vulkan fence handle
@@ -0,0 +1,130 @@
+#include "systems/renderer/vulkan/vulkanComponents/vulkanFrameCommandAllocator.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanFrameCommandAllocator::VulkanFrameCommandAllocator(std::unique_ptr<IVulkanCommandPoolSet> commandPoolSet, IVulkanDevice const * device) :
+        commandPoolSet{std::move(commandPoolSet)},
+        device{device}
+    {
+        size_t commandPoolCount = static_cast<size_t>(this->commandPoolSet->getFrameCount()) * this->commandPoolSet->getThreadCount();
+        primaryCommandBuffers.resize(commandPoolCount);
+        secondaryCommandBuffers.resize(commandPoolCount);
+    }
+
+    VulkanFrameCommandAllocator::VulkanFrameCommandAllocator(VulkanFrameCommandAllocator &&other) noexcept :
+        commandPoolSet{std::move(other.commandPoolSet)},
+        device{other.device},
+        primaryCommandBuffers{std::move(other.primaryCommandBuffers)},
+        secondaryCommandBuffers{std::move(other.secondaryCommandBuffers)},
+        frameIndex{other.frameIndex}
+    {
+        other.device = nullptr;
+        other.frameIndex = 0;
+    }
+
+    VulkanFrameCommandAllocator& VulkanFrameCommandAllocator::operator=(VulkanFrameCommandAllocator &&other) noexcept
+    {
+        commandPoolSet = std::move(other.commandPoolSet);
+        device = other.device;
+        primaryCommandBuffers = std::move(other.primaryCommandBuffers);
+        secondaryCommandBuffers = std::move(other.secondaryCommandBuffers);
+        frameIndex = other.frameIndex;
+        other.device = nullptr;
+        other.frameIndex = 0;
+        return *this;
+    }
+
+    VulkanFrameCommandAllocator::operator bool() const noexcept
+    {
+        return commandPoolSet != nullptr && *commandPoolSet;
+    }
+
+    void VulkanFrameCommandAllocator::beginFrame(uint32_t frameIndex, IVulkanFence const * fence)
+    {
+        if (fence == nullptr)
+        {
+            throw std::runtime_error("Failed to begin frame, no fence specified");
+        }
+
+        fence->wait();
+        resetFrame(frameIndex);
+    }
+
+    void VulkanFrameCommandAllocator::beginFrame(uint32_t frameIndex, IVulkanSemaphore const * timelineSemaphore, uint64_t value)
+    {
+        if (timelineSemaphore == nullptr)
+        {
+            throw std::runtime_error("Failed to begin frame, no timeline semaphore specified");
+        }
+
+        timelineSemaphore->wait(value);
+        resetFrame(frameIndex);
+    }
+
+    IVulkanCommandBuffer const * VulkanFrameCommandAllocator::allocate(uint32_t threadIndex, VkCommandBufferLevel level)
+    {
+        IVulkanCommandPool const * commandPool = commandPoolSet->getCommandPool(frameIndex, threadIndex);
+        size_t listIndex = static_cast<size_t>(frameIndex) * commandPoolSet->getThreadCount() + threadIndex;
+        CommandBufferList & commandBufferList = level == VK_COMMAND_BUFFER_LEVEL_PRIMARY ? primaryCommandBuffers[listIndex] : secondaryCommandBuffers[listIndex];
+
+        if (commandBufferList.next == commandBufferList.commandBuffers.size())
+        {
+            grow(commandBufferList, commandPool, level);
+        }
+
+        return commandBufferList.commandBuffers[commandBufferList.next++].get();
+    }
+
+    uint32_t VulkanFrameCommandAllocator::getFrameIndex() const noexcept
+    {
+        return frameIndex;
+    }
+
+    void VulkanFrameCommandAllocator::resetFrame(uint32_t frameIndex)
+    {
+        if (frameIndex >= commandPoolSet->getFrameCount())
+        {
+            throw std::runtime_error("Failed to begin frame, frame index is out of range");
+        }
+
+        uint32_t threadCount = commandPoolSet->getThreadCount();
+        for (uint32_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            size_t listIndex = static_cast<size_t>(frameIndex) * threadCount + threadIndex;
+            if (primaryCommandBuffers[listIndex].next == 0 && secondaryCommandBuffers[listIndex].next == 0)
+            {
+                continue;
+            }
+
+            commandPoolSet->getCommandPool(frameIndex, threadIndex)->reset();
+            primaryCommandBuffers[listIndex].next = 0;
+            secondaryCommandBuffers[listIndex].next = 0;
+        }
+
+        this->frameIndex = frameIndex;
+    }
+
+    void VulkanFrameCommandAllocator::grow(CommandBufferList & commandBufferList, IVulkanCommandPool const * commandPool, VkCommandBufferLevel level) const
+    {
+        uint32_t count = std::max(minimumGrowth, static_cast<uint32_t>(commandBufferList.commandBuffers.size()));
+
+        VkCommandBufferAllocateInfo commandBufferAllocInfo{ };
+        commandBufferAllocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        commandBufferAllocInfo.commandPool = commandPool->getCommandPool();
+        commandBufferAllocInfo.level = level;
+        commandBufferAllocInfo.commandBufferCount = count;
+
+        std::vector<VkCommandBuffer> commandBufferHandles(count, VK_NULL_HANDLE);
+        if (vkAllocateCommandBuffers(device->getLogicalDevice(), &commandBufferAllocInfo, commandBufferHandles.data()) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to allocate command buffer(s)");
+        }
+
+        bool synchronization2 = device->isFeatureEnabled(VulkanDeviceFeatures::SYNCHRONIZATION_2);
+        commandBufferList.commandBuffers.reserve(commandBufferList.commandBuffers.size() + count);
+        for (auto commandBufferHandle : commandBufferHandles)
+        {
+            commandBufferList.commandBuffers.push_back(std::make_unique<VulkanCommandBuffer>(commandBufferHandle, synchronization2));
+        }
+    }
+}
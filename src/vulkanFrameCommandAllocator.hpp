@@ -0,0 +1,169 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanFrameCommandAllocator.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanCommandPoolSet.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/vulkanCommandBuffer.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Hands out command buffers linearly from per frame, per thread command pools. Command buffers are never freed or reset
+     * individually. When a frame begins again its pools are reset with a single call and the command buffers are reused from the start
+     */
+    class VulkanFrameCommandAllocator : public IVulkanFrameCommandAllocator
+    {
+    public:
+        /**
+         * @brief VulkanFrameCommandAllocator builder
+         */
+        class Builder;
+
+        /**
+         * @brief VulkanFrameCommandAllocator constructor
+         * 
+         * @param commandPoolSet The per frame, per thread command pools
+         * @param device The device used to allocate command buffers
+         */
+        VulkanFrameCommandAllocator(std::unique_ptr<IVulkanCommandPoolSet> commandPoolSet, IVulkanDevice const * device);
+
+        /**
+         * @brief VulkanFrameCommandAllocator copy constructor
+         * 
+         * @param other VulkanFrameCommandAllocator to copy
+         */
+        VulkanFrameCommandAllocator(VulkanFrameCommandAllocator const &other) = delete;
+
+        /**
+         * @brief VulkanFrameCommandAllocator move constructor
+         * 
+         * @param other VulkanFrameCommandAllocator to move
+         */
+        VulkanFrameCommandAllocator(VulkanFrameCommandAllocator &&other) noexcept;
+
+        /**
+         * @brief VulkanFrameCommandAllocator copy assignment
+         * 
+         * @param other VulkanFrameCommandAllocator to copy
+         */
+        VulkanFrameCommandAllocator& operator=(const VulkanFrameCommandAllocator &other) = delete;
+
+        /**
+         * @brief VulkanFrameCommandAllocator move assignment
+         * 
+         * @param other VulkanFrameCommandAllocator to move
+         */
+        VulkanFrameCommandAllocator& operator=(VulkanFrameCommandAllocator &&other) noexcept;
+
+        /**
+         * @brief Check if the wrapped command pools are initialized
+         * 
+         * @returns True if the wrapped command pools are intialized, otherwise false
+         */
+        operator bool() const noexcept override;
+
+        /**
+         * @brief Begin recording a frame. Waits for the fence signalled by the previous submission of the frame, then resets the frame's
+         * command pools, recycling every command buffer allocated from them. No thread may be allocating while a frame begins
+         * 
+         * @param frameIndex Index of the frame in flight
+         * @param fence The fence signalled by the previous submission of the frame. Create it signalled so the first frame does not block. The fence is not reset
+         */
+        void beginFrame(uint32_t frameIndex, IVulkanFence const * fence) override;
+
+        /**
+         * @brief Begin recording a frame. Waits for a timeline semaphore to reach the value signalled by the previous submission of the frame,
+         * then resets the frame's command pools, recycling every command buffer allocated from them. No thread may be allocating while a frame begins
+         * 
+         * @param frameIndex Index of the frame in flight
+         * @param timelineSemaphore The timeline semaphore signalled by the previous submission of the frame
+         * @param value The value signalled by the previous submission of the frame
+         */
+        void beginFrame(uint32_t frameIndex, IVulkanSemaphore const * timelineSemaphore, uint64_t value) override;
+
+        /**
+         * @brief Get the next free command buffer of the current frame for a recording thread. Command buffers are handed out in order and
+         * remain valid until the frame is next begun. Each thread must only allocate with its own index
+         * 
+         * @param threadIndex Index of the recording thread
+         * @param level The command buffer level
+         * @returns The command buffer, in the initial state
+         */
+        IVulkanCommandBuffer const * allocate(uint32_t threadIndex, VkCommandBufferLevel level) override;
+
+        /**
+         * @brief Get the index of the frame currently being recorded
+         * 
+         * @returns The index of the current frame in flight
+         */
+        uint32_t getFrameIndex() const noexcept override;
+
+    private:
+        /**
+         * @brief The minimum number of command buffers allocated when a list grows
+         */
+        static constexpr uint32_t minimumGrowth{ 4 };
+
+        /**
+         * @brief Command buffers of one level allocated from one command pool
+         */
+        struct CommandBufferList
+        {
+            /**
+             * @brief The allocated command buffers
+             */
+            std::vector<std::unique_ptr<IVulkanCommandBuffer>> commandBuffers{ };
+
+            /**
+             * @brief Index of the next command buffer to hand out
+             */
+            size_t next{ 0 };
+        };
+
+        /**
+         * @brief The per frame, per thread command pools
+         */
+        std::unique_ptr<IVulkanCommandPoolSet> commandPoolSet{ nullptr };
+
+        /**
+         * @brief The device used to allocate command buffers
+         */
+        IVulkanDevice const * device{ nullptr };
+
+        /**
+         * @brief Primary command buffers, indexed in the same order as the command pools
+         */
+        std::vector<CommandBufferList> primaryCommandBuffers{ };
+
+        /**
+         * @brief Secondary command buffers, indexed in the same order as the command pools
+         */
+        std::vector<CommandBufferList> secondaryCommandBuffers{ };
+
+        /**
+         * @brief Index of the frame currently being recorded
+         */
+        uint32_t frameIndex{ 0 };
+
+        /**
+         * @brief Reset the command pools of a frame and rewind its command buffer lists
+         * 
+         * @param frameIndex Index of the frame in flight
+         */
+        void resetFrame(uint32_t frameIndex);
+
+        /**
+         * @brief Allocate more command buffers for a list. The list at least doubles in size so allocation calls stop once the frame's
+         * usage has been reached
+         * 
+         * @param commandBufferList The list to grow
+         * @param commandPool The command pool the list allocates from
+         * @param level The command buffer level
+         */
+        void grow(CommandBufferList & commandBufferList, IVulkanCommandPool const * commandPool, VkCommandBufferLevel level) const;
+    };
+}
@@ -0,0 +1,147 @@
+#include "systems/renderer/vulkan/vulkanComponents/vulkanGpuProfiler.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanGpuProfiler::VulkanGpuProfiler(std::vector<std::unique_ptr<IVulkanQueryPool>> queryPools, uint32_t sampleCount, double timestampPeriod, uint64_t timestampMask) :
+        sampleCount{sampleCount},
+        timestampPeriod{timestampPeriod},
+        timestampMask{timestampMask}
+    {
+        frames.resize(queryPools.size());
+        for (size_t i = 0; i < frames.size(); i++)
+        {
+            frames[i].queryPool = std::move(queryPools[i]);
+        }
+    }
+
+    VulkanGpuProfiler::operator bool() const noexcept
+    {
+        return frames.size() > 0 &&
+            std::all_of(frames.begin(), frames.end(), [](Frame const & frame) { return frame.queryPool && *frame.queryPool; });
+    }
+
+    void VulkanGpuProfiler::beginFrame(IVulkanCommandBuffer const * commandBuffer, uint32_t frameIndex)
+    {
+        if (!openScopes.empty())
+        {
+            throw std::runtime_error("Failed to begin profiler frame, the previous frame has open scopes");
+        }
+
+        Frame & frame = frames[frameIndex];
+        collect(frame);
+
+        frame.scopeNames.clear();
+        frame.queryPool->reset(commandBuffer, 0, frame.queryPool->getQueryCount());
+        currentFrame = frameIndex;
+    }
+
+    void VulkanGpuProfiler::beginScope(IVulkanCommandBuffer const * commandBuffer, std::string const & name)
+    {
+        Frame & frame = frames[currentFrame];
+        uint32_t scope = static_cast<uint32_t>(frame.scopeNames.size());
+        if ((scope + 1) * 2 > frame.queryPool->getQueryCount())
+        {
+            throw std::runtime_error("Failed to begin profiler scope, the frame scope limit has been reached");
+        }
+
+        frame.queryPool->writeTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, scope * 2);
+        frame.scopeNames.push_back(name);
+        frame.pending = true;
+        openScopes.push_back(scope);
+    }
+
+    void VulkanGpuProfiler::endScope(IVulkanCommandBuffer const * commandBuffer)
+    {
+        if (openScopes.empty())
+        {
+            throw std::runtime_error("Failed to end profiler scope, no scope is open");
+        }
+
+        uint32_t scope = openScopes.back();
+        openScopes.pop_back();
+        frames[currentFrame].queryPool->writeTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, scope * 2 + 1);
+    }
+
+    void VulkanGpuProfiler::beginRenderPass(IVulkanCommandBuffer const * commandBuffer, IVulkanRenderPass const * renderPass, uint32_t imageIndex, uint32_t frameIndex, std::string const & name)
+    {
+        beginScope(commandBuffer, name);
+        renderPass->begin(commandBuffer, imageIndex, frameIndex);
+    }
+
+    void VulkanGpuProfiler::endRenderPass(IVulkanCommandBuffer const * commandBuffer, IVulkanRenderPass const * renderPass)
+    {
+        renderPass->end(commandBuffer);
+        endScope(commandBuffer);
+    }
+
+    VulkanGpuScopeStatistics VulkanGpuProfiler::getStatistics(std::string const & name) const
+    {
+        auto scopeSamples = samples.find(name);
+        if (scopeSamples == samples.end())
+        {
+            return VulkanGpuScopeStatistics{ };
+        }
+        return calculateStatistics(scopeSamples->second);
+    }
+
+    std::unordered_map<std::string, VulkanGpuScopeStatistics> VulkanGpuProfiler::getStatistics() const
+    {
+        std::unordered_map<std::string, VulkanGpuScopeStatistics> statistics{ };
+        for (auto const & [name, durations] : samples)
+        {
+            statistics[name] = calculateStatistics(durations);
+        }
+        return statistics;
+    }
+
+    void VulkanGpuProfiler::collect(Frame & frame)
+    {
+        if (!frame.pending)
+        {
+            return;
+        }
+        frame.pending = false;
+
+        // Results which are not yet available are dropped rather than waited for
+        uint32_t queryCount = static_cast<uint32_t>(frame.scopeNames.size()) * 2;
+        if (!frame.queryPool->getResults(0, queryCount, results))
+        {
+            return;
+        }
+
+        for (size_t i = 0; i < frame.scopeNames.size(); i++)
+        {
+            uint64_t ticks = (results[i * 2 + 1] - results[i * 2]) & timestampMask;
+            double milliseconds = static_cast<double>(ticks) * timestampPeriod / 1000000.0;
+
+            std::deque<double> & durations = samples[frame.scopeNames[i]];
+            durations.push_back(milliseconds);
+            while (durations.size() > sampleCount)
+            {
+                durations.pop_front();
+            }
+        }
+    }
+
+    VulkanGpuScopeStatistics VulkanGpuProfiler::calculateStatistics(std::deque<double> const & durations) noexcept
+    {
+        VulkanGpuScopeStatistics statistics{ };
+        if (durations.empty())
+        {
+            return statistics;
+        }
+
+        statistics.minimum = durations.front();
+        statistics.maximum = durations.front();
+        double total{ 0.0 };
+        for (double duration : durations)
+        {
+            statistics.minimum = std::min(statistics.minimum, duration);
+            statistics.maximum = std::max(statistics.maximum, duration);
+            total += duration;
+        }
+        statistics.average = total / static_cast<double>(durations.size());
+        statistics.sampleCount = static_cast<uint32_t>(durations.size());
+        return statistics;
+    }
+}
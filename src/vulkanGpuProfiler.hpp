@@ -0,0 +1,209 @@
+#pragma once
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanGpuProfiler.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanQueryPool.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Measures named scopes with a timestamp query pool per frame in flight. Results are read back when a frame is reused, so profiling never stalls the CPU
+     */
+    class VulkanGpuProfiler : public IVulkanGpuProfiler
+    {
+    public:
+        /**
+         * @brief VulkanGpuProfiler builder
+         */
+        class Builder;
+
+        /**
+         * @brief VulkanGpuProfiler constructor
+         * 
+         * @param queryPools One timestamp query pool per frame in flight, each holding two queries per scope
+         * @param sampleCount Number of recent durations each scope's statistics are calculated from
+         * @param timestampPeriod Nanoseconds per timestamp tick
+         * @param timestampMask Mask of the valid timestamp bits
+         */
+        VulkanGpuProfiler(std::vector<std::unique_ptr<IVulkanQueryPool>> queryPools, uint32_t sampleCount, double timestampPeriod, uint64_t timestampMask);
+
+        /**
+         * @brief VulkanGpuProfiler copy constructor
+         * 
+         * @param other VulkanGpuProfiler to copy
+         */
+        VulkanGpuProfiler(VulkanGpuProfiler const &other) = delete;
+
+        /**
+         * @brief VulkanGpuProfiler move constructor
+         * 
+         * @param other VulkanGpuProfiler to move
+         */
+        VulkanGpuProfiler(VulkanGpuProfiler &&other) = delete;
+
+        /**
+         * @brief VulkanGpuProfiler destructor
+         */
+        ~VulkanGpuProfiler() = default;
+
+        /**
+         * @brief VulkanGpuProfiler copy assignment
+         * 
+         * @param other VulkanGpuProfiler to copy
+         */
+        VulkanGpuProfiler& operator=(const VulkanGpuProfiler &other) = delete;
+
+        /**
+         * @brief VulkanGpuProfiler move assignment
+         * 
+         * @param other VulkanGpuProfiler to move
+         */
+        VulkanGpuProfiler& operator=(VulkanGpuProfiler &&other) = delete;
+
+        /**
+         * @brief Check if the wrapped handles are initialized
+         * 
+         * @returns True if the wrapped handles are intialized, otherwise false
+         */
+        operator bool() const noexcept override;
+
+        /**
+         * @brief Begin profiling a frame in flight. Collects the results last recorded for the frame, if available, then resets its queries.
+         * Must be recorded outside of a render pass, after the previous use of the frame has completed
+         * 
+         * @param commandBuffer The command buffer in which to record the command
+         * @param frameIndex Index of the frame in flight
+         */
+        void beginFrame(IVulkanCommandBuffer const * commandBuffer, uint32_t frameIndex) override;
+
+        /**
+         * @brief Begin a named scope. Scopes may be nested
+         * 
+         * @param commandBuffer The command buffer in which to record the command
+         * @param name The scope name
+         */
+        void beginScope(IVulkanCommandBuffer const * commandBuffer, std::string const & name) override;
+
+        /**
+         * @brief End the most recently begun scope
+         * 
+         * @param commandBuffer The command buffer in which to record the command
+         */
+        void endScope(IVulkanCommandBuffer const * commandBuffer) override;
+
+        /**
+         * @brief Begin a render pass within a named scope
+         * 
+         * @param commandBuffer The command buffer in which to record the command
+         * @param renderPass The render pass to begin
+         * @param imageIndex Index of the acquired swapchain image
+         * @param frameIndex Index of the frame in flight being recorded
+         * @param name The scope name
+         */
+        void beginRenderPass(IVulkanCommandBuffer const * commandBuffer, IVulkanRenderPass const * renderPass, uint32_t imageIndex, uint32_t frameIndex, std::string const & name) override;
+
+        /**
+         * @brief End a render pass and the scope begun with it
+         * 
+         * @param commandBuffer The command buffer in which to record the command
+         * @param renderPass The render pass to end
+         */
+        void endRenderPass(IVulkanCommandBuffer const * commandBuffer, IVulkanRenderPass const * renderPass) override;
+
+        /**
+         * @brief Get the statistics of a scope
+         * 
+         * @param name The scope name
+         * @returns The scope statistics, with a sample count of zero if the scope has no results yet
+         */
+        VulkanGpuScopeStatistics getStatistics(std::string const & name) const override;
+
+        /**
+         * @brief Get the statistics of every scope with results
+         * 
+         * @returns The scope statistics keyed by scope name
+         */
+        std::unordered_map<std::string, VulkanGpuScopeStatistics> getStatistics() const override;
+
+    private:
+        /**
+         * @brief The queries of a single frame in flight
+         */
+        struct Frame
+        {
+            /**
+             * @brief Timestamp query pool. Scope n writes queries 2n and 2n + 1
+             */
+            std::unique_ptr<IVulkanQueryPool> queryPool{ nullptr };
+
+            /**
+             * @brief Names of the scopes recorded in the frame, in query order
+             */
+            std::vector<std::string> scopeNames{ };
+
+            /**
+             * @brief Indicates if the frame has recorded scopes whose results have not been collected
+             */
+            bool pending{ false };
+        };
+
+        /**
+         * @brief Frames in flight
+         */
+        std::vector<Frame> frames{ };
+
+        /**
+         * @brief Index of the frame currently recording
+         */
+        uint32_t currentFrame{ 0 };
+
+        /**
+         * @brief Scopes of the current frame which have begun but not ended
+         */
+        std::vector<uint32_t> openScopes{ };
+
+        /**
+         * @brief Number of recent durations each scope's statistics are calculated from
+         */
+        uint32_t sampleCount{ 0 };
+
+        /**
+         * @brief Nanoseconds per timestamp tick
+         */
+        double timestampPeriod{ 1.0 };
+
+        /**
+         * @brief Mask of the valid timestamp bits
+         */
+        uint64_t timestampMask{ 0 };
+
+        /**
+         * @brief Recent durations of each scope in milliseconds, oldest first
+         */
+        std::unordered_map<std::string, std::deque<double>> samples{ };
+
+        /**
+         * @brief Storage for query results
+         */
+        std::vector<uint64_t> results{ };
+
+        /**
+         * @brief Record the durations of a frame's scopes if their results are available
+         * 
+         * @param frame The frame to collect
+         */
+        void collect(Frame & frame);
+
+        /**
+         * @brief Calculate statistics from a set of durations
+         * 
+         * @param durations The durations in milliseconds
+         * @returns The statistics
+         */
+        static VulkanGpuScopeStatistics calculateStatistics(std::deque<double> const & durations) noexcept;
+    };
+}
@@ -2,7 +2,7 @@
 
 namespace siofraEngine::systems
 {
-    VulkanImage::VulkanImage(VkImage image, VkImageView imageView, VkDeviceMemory imageMemory, bool managedImage, IVulkanDevice const * device) :
+    VulkanImage::VulkanImage(VkImage image, VkImageView imageView, VulkanMemoryAllocation imageMemory, bool managedImage, IVulkanDevice const * device) :
         image{image},
         imageView{imageView},
         imageMemory{imageMemory},
@@ -21,7 +21,7 @@ namespace siofraEngine::systems
     {
         other.image = VK_NULL_HANDLE;
         other.imageView = VK_NULL_HANDLE;
-        other.imageMemory = VK_NULL_HANDLE;
+        other.imageMemory = { };
         other.managedImage = false;
         other.device = nullptr;
     }
@@ -33,7 +33,7 @@ namespace siofraEngine::systems
         if(!managedImage)
         {
             vkDestroyImage(logicalDevice, image, nullptr);
-            vkFreeMemory(logicalDevice, imageMemory, nullptr);
+            device->getMemoryAllocator()->free(imageMemory);
         }
     }
 
@@ -46,7 +46,7 @@ namespace siofraEngine::systems
         device = other.device;
         other.image = VK_NULL_HANDLE;
         other.imageView = VK_NULL_HANDLE;
-        other.imageMemory = VK_NULL_HANDLE;
+        other.imageMemory = { };
         other.managedImage = false;
         other.device = nullptr;
         return *this;
@@ -56,7 +56,7 @@ namespace siofraEngine::systems
     {
         return image != VK_NULL_HANDLE &&
             imageView != VK_NULL_HANDLE &&
-            imageMemory != VK_NULL_HANDLE;
+            imageMemory.memory != VK_NULL_HANDLE;
     }
 
     VkImageView VulkanImage::getImageView() const noexcept
@@ -86,32 +86,16 @@ namespace siofraEngine::systems
         imageMemoryBarrier.subresourceRange.layerCount = 1;
         imageMemoryBarrier.subresourceRange.levelCount = 1;
 
-        VkPipelineStageFlags srcStage;
-        VkPipelineStageFlags dstStage;
+        VulkanResourceState srcState = VulkanResourceStateTracker::getImageLayoutState(oldLayout);
+        VulkanResourceState dstState = VulkanResourceStateTracker::getImageLayoutState(newLayout);
 
-        if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED && newLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL)
-        {
-            imageMemoryBarrier.srcAccessMask = 0;
-            imageMemoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-
-            srcStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-            dstStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-        }
-        else if (oldLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
-        {
-            imageMemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-            imageMemoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-
-            srcStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-            dstStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
-        }
+        imageMemoryBarrier.srcAccessMask = srcState.accessMask;
+        imageMemoryBarrier.dstAccessMask = dstState.accessMask;
 
-        std::vector<VkImageMemoryBarrier> imageMemoryBarriers{
-            imageMemoryBarrier
-        };
+        VkPipelineStageFlags srcStage = srcState.stageMask;
+        VkPipelineStageFlags dstStage = dstState.stageMask;
 
-        VkCommandBuffer commandBufferHandle = commandBuffer->getCommandBuffer();
-        vkCmdPipelineBarrier(commandBufferHandle, srcStage, dstStage, 0, 0, nullptr, 0, nullptr, static_cast<uint32_t>(imageMemoryBarriers.size()), imageMemoryBarriers.data());
+        commandBuffer->getBarrierBatch().addImageBarrier(imageMemoryBarrier, srcStage, dstStage);
 
         commandBuffer->end();
 
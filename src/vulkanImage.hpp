@@ -2,6 +2,7 @@
 
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanImage.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/vulkanResourceStateTracker.hpp"
 
 namespace siofraEngine::systems
 {
@@ -21,11 +22,11 @@ namespace siofraEngine::systems
          * 
          * @param image Vulkan image handle
          * @param imageView Vulkan image view handle
-         * @param imageMemory Vulkan image memory handle
+         * @param imageMemory Device memory allocation bound to the image
          * @param managedImage Indicate if the image and image memory handles are managed elsewhere
          * @param device The device used to create the image
          */
-        VulkanImage(VkImage image, VkImageView imageView, VkDeviceMemory imageMemory, bool managedImage, IVulkanDevice const * device);
+        VulkanImage(VkImage image, VkImageView imageView, VulkanMemoryAllocation imageMemory, bool managedImage, IVulkanDevice const * device);
 
         /**
          * @brief VulkanImage copy constructor
@@ -103,9 +104,9 @@ namespace siofraEngine::systems
         VkImageView imageView{ VK_NULL_HANDLE };
 
         /**
-         * @brief Vulkan image memory handle
+         * @brief Device memory allocation bound to the image
          */
-        VkDeviceMemory imageMemory{ VK_NULL_HANDLE };
+        VulkanMemoryAllocation imageMemory{ };
 
         /**
          * @brief Indicates if the image and image memory handles are managed elsewhere
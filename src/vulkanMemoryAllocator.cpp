@@ -0,0 +1,296 @@
+#include "systems/renderer/vulkan/vulkanComponents/vulkanMemoryAllocator.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanMemoryAllocator::VulkanMemoryAllocator(VkPhysicalDevice physicalDevice, VkDevice logicalDevice, VkDeviceSize blockSize) :
+        physicalDevice{physicalDevice},
+        logicalDevice{logicalDevice}
+    {
+        vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memoryProperties);
+
+        VkPhysicalDeviceProperties properties{ };
+        vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+        nonCoherentAtomSize = std::max<VkDeviceSize>(properties.limits.nonCoherentAtomSize, 1);
+
+        preferredBlockSize = minimumNodeSize;
+        while (preferredBlockSize * 2 <= blockSize)
+        {
+            preferredBlockSize *= 2;
+        }
+
+        pools.resize(memoryProperties.memoryTypeCount * 2);
+        for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++)
+        {
+            // Keep blocks on small heaps to an eighth of the heap so a single block cannot exhaust it
+            VkDeviceSize heapSize = memoryProperties.memoryHeaps[memoryProperties.memoryTypes[i].heapIndex].size;
+            VkDeviceSize poolBlockSize = preferredBlockSize;
+            while (poolBlockSize > minimumNodeSize && poolBlockSize > heapSize / 8)
+            {
+                poolBlockSize /= 2;
+            }
+
+            pools[i * 2].memoryTypeIndex = i;
+            pools[i * 2].blockSize = poolBlockSize;
+            pools[i * 2 + 1].memoryTypeIndex = i;
+            pools[i * 2 + 1].blockSize = poolBlockSize;
+        }
+    }
+
+    VulkanMemoryAllocator::~VulkanMemoryAllocator()
+    {
+        for (auto & pool : pools)
+        {
+            for (auto & block : pool.blocks)
+            {
+                releaseBlock(*block);
+            }
+        }
+
+        for (auto & block : dedicatedBlocks)
+        {
+            releaseBlock(*block);
+        }
+    }
+
+    VulkanMemoryAllocator::operator bool() const noexcept
+    {
+        return logicalDevice != VK_NULL_HANDLE;
+    }
+
+    VulkanMemoryAllocation VulkanMemoryAllocator::allocate(VkMemoryRequirements const & memoryRequirements, VkMemoryPropertyFlags memoryPropertyFlags, bool linear)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        uint32_t memoryTypeIndex = findMemoryTypeIndex(memoryRequirements.memoryTypeBits, memoryPropertyFlags);
+        int32_t poolIndex = static_cast<int32_t>(memoryTypeIndex * 2 + (linear ? 1 : 0));
+        Pool & pool = pools[poolIndex];
+
+        // Nodes are aligned to their own size, so rounding up to a power of two also satisfies the alignment
+        VkDeviceSize nodeSize = minimumNodeSize;
+        uint32_t order = 0;
+        while (nodeSize < memoryRequirements.size || nodeSize < memoryRequirements.alignment)
+        {
+            nodeSize *= 2;
+            ++order;
+        }
+
+        if (nodeSize > pool.blockSize / 2)
+        {
+            std::unique_ptr<Block> block = allocateBlock(memoryTypeIndex, memoryRequirements.size, -1);
+            if (!block)
+            {
+                throw std::runtime_error("Failed to allocate device memory");
+            }
+
+            VulkanMemoryAllocation allocation{ block->memory, 0, memoryRequirements.size, memoryTypeIndex, block.get() };
+            dedicatedBlocks.push_back(std::move(block));
+            return allocation;
+        }
+
+        VkDeviceSize offset{ 0 };
+        for (auto & block : pool.blocks)
+        {
+            if (allocateNode(*block, order, offset))
+            {
+                return VulkanMemoryAllocation{ block->memory, offset, memoryRequirements.size, memoryTypeIndex, block.get() };
+            }
+        }
+
+        std::unique_ptr<Block> block = allocateBlock(memoryTypeIndex, pool.blockSize, poolIndex);
+        if (!block || !allocateNode(*block, order, offset))
+        {
+            throw std::runtime_error("Failed to allocate device memory");
+        }
+
+        VulkanMemoryAllocation allocation{ block->memory, offset, memoryRequirements.size, memoryTypeIndex, block.get() };
+        pool.blocks.push_back(std::move(block));
+        return allocation;
+    }
+
+    void VulkanMemoryAllocator::free(VulkanMemoryAllocation const & allocation)
+    {
+        if (allocation.block == nullptr)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        Block * block = static_cast<Block *>(allocation.block);
+        auto & blocks = block->poolIndex < 0 ? dedicatedBlocks : pools[block->poolIndex].blocks;
+
+        if (block->poolIndex >= 0)
+        {
+            freeNode(*block, allocation.offset);
+
+            // Keep the last block of a pool alive so alternating allocate/free does not thrash vkAllocateMemory
+            if (!block->allocatedNodes.empty() || blocks.size() == 1)
+            {
+                return;
+            }
+        }
+
+        releaseBlock(*block);
+        blocks.erase(std::find_if(blocks.begin(), blocks.end(), [block](auto const & candidate) { return candidate.get() == block; }));
+    }
+
+    void * VulkanMemoryAllocator::map(VulkanMemoryAllocation const & allocation)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        Block * block = static_cast<Block *>(allocation.block);
+        if (block->mapCount == 0 && vkMapMemory(logicalDevice, block->memory, 0, VK_WHOLE_SIZE, 0, &block->mapped) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to map device memory");
+        }
+
+        ++block->mapCount;
+        return static_cast<char *>(block->mapped) + allocation.offset;
+    }
+
+    void VulkanMemoryAllocator::unmap(VulkanMemoryAllocation const & allocation)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        Block * block = static_cast<Block *>(allocation.block);
+        if (block->mapCount > 0 && --block->mapCount == 0)
+        {
+            vkUnmapMemory(logicalDevice, block->memory);
+            block->mapped = nullptr;
+        }
+    }
+
+    void VulkanMemoryAllocator::flush(VulkanMemoryAllocation const & allocation, VkDeviceSize offset, VkDeviceSize size) const
+    {
+        if (memoryProperties.memoryTypes[allocation.memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+        {
+            return;
+        }
+
+        // Flushed ranges must be multiples of nonCoherentAtomSize, or reach the end of the memory object
+        Block const * block = static_cast<Block const *>(allocation.block);
+        VkDeviceSize start = (allocation.offset + offset) / nonCoherentAtomSize * nonCoherentAtomSize;
+        VkDeviceSize end = (allocation.offset + offset + size + nonCoherentAtomSize - 1) / nonCoherentAtomSize * nonCoherentAtomSize;
+
+        VkMappedMemoryRange mappedMemoryRange{ };
+        mappedMemoryRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        mappedMemoryRange.memory = allocation.memory;
+        mappedMemoryRange.offset = start;
+        mappedMemoryRange.size = end >= block->size ? VK_WHOLE_SIZE : end - start;
+
+        if (vkFlushMappedMemoryRanges(logicalDevice, 1, &mappedMemoryRange) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to flush mapped memory");
+        }
+    }
+
+    uint32_t VulkanMemoryAllocator::findMemoryTypeIndex(uint32_t allowedTypes, VkMemoryPropertyFlags properties) const
+    {
+        for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++)
+        {
+            if ((allowedTypes & (1 << i)) && (memoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
+            {
+                return i;
+            }
+        }
+
+        throw std::runtime_error("Failed to find memory type index");
+    }
+
+    std::unique_ptr<VulkanMemoryAllocator::Block> VulkanMemoryAllocator::allocateBlock(uint32_t memoryTypeIndex, VkDeviceSize size, int32_t poolIndex) const
+    {
+        VkMemoryAllocateInfo memoryAllocInfo{ };
+        memoryAllocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        memoryAllocInfo.allocationSize = size;
+        memoryAllocInfo.memoryTypeIndex = memoryTypeIndex;
+
+        auto block = std::make_unique<Block>();
+        if (vkAllocateMemory(logicalDevice, &memoryAllocInfo, nullptr, &block->memory) != VK_SUCCESS)
+        {
+            return nullptr;
+        }
+
+        block->size = size;
+        block->poolIndex = poolIndex;
+
+        if (poolIndex >= 0)
+        {
+            uint32_t maxOrder = 0;
+            while ((minimumNodeSize << maxOrder) < size)
+            {
+                ++maxOrder;
+            }
+
+            block->freeNodes.resize(maxOrder + 1);
+            block->freeNodes[maxOrder].insert(0);
+        }
+
+        return block;
+    }
+
+    bool VulkanMemoryAllocator::allocateNode(Block & block, uint32_t order, VkDeviceSize & offset) const
+    {
+        uint32_t freeOrder = order;
+        while (freeOrder < block.freeNodes.size() && block.freeNodes[freeOrder].empty())
+        {
+            ++freeOrder;
+        }
+
+        if (freeOrder >= block.freeNodes.size())
+        {
+            return false;
+        }
+
+        offset = *block.freeNodes[freeOrder].begin();
+        block.freeNodes[freeOrder].erase(block.freeNodes[freeOrder].begin());
+
+        // Split the node, returning the upper halves to the free lists
+        while (freeOrder > order)
+        {
+            --freeOrder;
+            block.freeNodes[freeOrder].insert(offset + (minimumNodeSize << freeOrder));
+        }
+
+        block.allocatedNodes[offset] = order;
+        return true;
+    }
+
+    void VulkanMemoryAllocator::freeNode(Block & block, VkDeviceSize offset) const
+    {
+        auto allocatedNode = block.allocatedNodes.find(offset);
+        if (allocatedNode == block.allocatedNodes.end())
+        {
+            return;
+        }
+
+        uint32_t order = allocatedNode->second;
+        block.allocatedNodes.erase(allocatedNode);
+
+        // Merge with the buddy node for as long as it is also free
+        while (order + 1 < block.freeNodes.size())
+        {
+            VkDeviceSize buddy = offset ^ (minimumNodeSize << order);
+            if (block.freeNodes[order].erase(buddy) == 0)
+            {
+                break;
+            }
+
+            offset = std::min(offset, buddy);
+            ++order;
+        }
+
+        block.freeNodes[order].insert(offset);
+    }
+
+    void VulkanMemoryAllocator::releaseBlock(Block & block) const
+    {
+        if (block.mapped != nullptr)
+        {
+            vkUnmapMemory(logicalDevice, block.memory);
+            block.mapped = nullptr;
+        }
+
+        vkFreeMemory(logicalDevice, block.memory, nullptr);
+        block.memory = VK_NULL_HANDLE;
+    }
+}
@@ -0,0 +1,267 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanMemoryAllocator.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Sub-allocates device memory from large per memory type blocks using a buddy scheme
+     */
+    class VulkanMemoryAllocator : public IVulkanMemoryAllocator
+    {
+    public:
+        /**
+         * @brief VulkanMemoryAllocator builder
+         */
+        class Builder;
+
+        /**
+         * @brief VulkanMemoryAllocator constructor
+         *
+         * @param physicalDevice Vulkan physical device handle
+         * @param logicalDevice Vulkan logical device handle
+         * @param blockSize Preferred size of the device memory blocks. Rounded down to a power of two
+         */
+        VulkanMemoryAllocator(VkPhysicalDevice physicalDevice, VkDevice logicalDevice, VkDeviceSize blockSize);
+
+        /**
+         * @brief VulkanMemoryAllocator copy constructor
+         *
+         * @param other VulkanMemoryAllocator to copy
+         */
+        VulkanMemoryAllocator(VulkanMemoryAllocator const &other) = delete;
+
+        /**
+         * @brief VulkanMemoryAllocator move constructor
+         *
+         * @param other VulkanMemoryAllocator to move
+         */
+        VulkanMemoryAllocator(VulkanMemoryAllocator &&other) = delete;
+
+        /**
+         * @brief VulkanMemoryAllocator destructor
+         */
+        ~VulkanMemoryAllocator();
+
+        /**
+         * @brief VulkanMemoryAllocator copy assignment
+         *
+         * @param other VulkanMemoryAllocator to copy
+         */
+        VulkanMemoryAllocator& operator=(const VulkanMemoryAllocator &other) = delete;
+
+        /**
+         * @brief VulkanMemoryAllocator move assignment
+         *
+         * @param other VulkanMemoryAllocator to move
+         */
+        VulkanMemoryAllocator& operator=(VulkanMemoryAllocator &&other) = delete;
+
+        /**
+         * @brief Check if the wrapped handle is initialized
+         *
+         * @returns True if the wrapped handle is intialized, otherwise false
+         */
+        operator bool() const noexcept override;
+
+        /**
+         * @brief Allocate device memory satisfying the given requirements
+         *
+         * @param memoryRequirements The memory requirements of the resource the allocation is for
+         * @param memoryPropertyFlags The desired memory property flags
+         * @param linear Indicates if the resource is a buffer or linearly tiled image
+         * @returns The memory allocation
+         */
+        VulkanMemoryAllocation allocate(VkMemoryRequirements const & memoryRequirements, VkMemoryPropertyFlags memoryPropertyFlags, bool linear) override;
+
+        /**
+         * @brief Return an allocation to the allocator
+         *
+         * @param allocation The allocation to free
+         */
+        void free(VulkanMemoryAllocation const & allocation) override;
+
+        /**
+         * @brief Map an allocation into host memory. The memory must be host visible
+         *
+         * @param allocation The allocation to map
+         * @returns Pointer to the start of the mapped allocation
+         */
+        void * map(VulkanMemoryAllocation const & allocation) override;
+
+        /**
+         * @brief Unmap an allocation previously mapped with map
+         *
+         * @param allocation The allocation to unmap
+         */
+        void unmap(VulkanMemoryAllocation const & allocation) override;
+
+        /**
+         * @brief Flush host writes to an allocation so they are visible to the device. Does nothing for host coherent memory
+         *
+         * @param allocation The mapped allocation
+         * @param offset Offset of the written range, relative to the start of the allocation
+         * @param size Size of the written range in bytes
+         */
+        void flush(VulkanMemoryAllocation const & allocation, VkDeviceSize offset, VkDeviceSize size) const override;
+
+    private:
+        /**
+         * @brief Smallest buddy allocator node size in bytes
+         */
+        static constexpr VkDeviceSize minimumNodeSize{ 256 };
+
+        /**
+         * @brief A single device memory allocation which is divided between resources
+         */
+        struct Block
+        {
+            /**
+             * @brief Device memory handle
+             */
+            VkDeviceMemory memory{ VK_NULL_HANDLE };
+
+            /**
+             * @brief Size of the block in bytes
+             */
+            VkDeviceSize size{ 0 };
+
+            /**
+             * @brief Index of the pool the block belongs to, or -1 for dedicated allocations
+             */
+            int32_t poolIndex{ -1 };
+
+            /**
+             * @brief Free node offsets, indexed by node order. A node of order n is minimumNodeSize << n bytes
+             */
+            std::vector<std::set<VkDeviceSize>> freeNodes{ };
+
+            /**
+             * @brief Order of each allocated node, keyed by offset
+             */
+            std::unordered_map<VkDeviceSize, uint32_t> allocatedNodes{ };
+
+            /**
+             * @brief Host address of the mapped block
+             */
+            void * mapped{ nullptr };
+
+            /**
+             * @brief Number of outstanding map requests
+             */
+            uint32_t mapCount{ 0 };
+        };
+
+        /**
+         * @brief The blocks allocated for a single memory type and resource kind
+         */
+        struct Pool
+        {
+            /**
+             * @brief Memory type index of the blocks
+             */
+            uint32_t memoryTypeIndex{ 0 };
+
+            /**
+             * @brief Size of the blocks in bytes
+             */
+            VkDeviceSize blockSize{ 0 };
+
+            /**
+             * @brief The allocated blocks
+             */
+            std::vector<std::unique_ptr<Block>> blocks{ };
+        };
+
+        /**
+         * @brief Vulkan physical device handle
+         */
+        VkPhysicalDevice physicalDevice{ VK_NULL_HANDLE };
+
+        /**
+         * @brief Vulkan logical device handle
+         */
+        VkDevice logicalDevice{ VK_NULL_HANDLE };
+
+        /**
+         * @brief Physical device memory properties
+         */
+        VkPhysicalDeviceMemoryProperties memoryProperties{ };
+
+        /**
+         * @brief Alignment required of flushed ranges of non-coherent memory
+         */
+        VkDeviceSize nonCoherentAtomSize{ 1 };
+
+        /**
+         * @brief Preferred size of the device memory blocks
+         */
+        VkDeviceSize preferredBlockSize{ 0 };
+
+        /**
+         * @brief Pools indexed by memory type index * 2 + (linear ? 1 : 0). Linear and optimal resources never share a block so buffer image granularity never needs to be considered
+         */
+        std::vector<Pool> pools{ };
+
+        /**
+         * @brief Allocations too large to share a block
+         */
+        std::vector<std::unique_ptr<Block>> dedicatedBlocks{ };
+
+        /**
+         * @brief Guards the pools and dedicated blocks
+         */
+        std::mutex mutex{ };
+
+        /**
+         * @brief Find the index of a memory type which satisfies the allowed memory types and the desired memory properties
+         *
+         * @param allowedTypes The allowed memory types
+         * @param properties The desired memory properties
+         * @returns The memory type index
+         */
+        uint32_t findMemoryTypeIndex(uint32_t allowedTypes, VkMemoryPropertyFlags properties) const;
+
+        /**
+         * @brief Allocate a new device memory block
+         *
+         * @param memoryTypeIndex The memory type index
+         * @param size The block size in bytes
+         * @param poolIndex Index of the owning pool, or -1 for dedicated allocations
+         * @returns The new block, or nullptr if the device memory could not be allocated
+         */
+        std::unique_ptr<Block> allocateBlock(uint32_t memoryTypeIndex, VkDeviceSize size, int32_t poolIndex) const;
+
+        /**
+         * @brief Allocate a node of the given order from a block
+         *
+         * @param block The block to allocate from
+         * @param order The node order
+         * @param offset The allocated node offset to be populated
+         * @returns True if a node was allocated, otherwise false
+         */
+        bool allocateNode(Block & block, uint32_t order, VkDeviceSize & offset) const;
+
+        /**
+         * @brief Return a node to a block, merging it with its free buddies
+         *
+         * @param block The block the node was allocated from
+         * @param offset The node offset
+         */
+        void freeNode(Block & block, VkDeviceSize offset) const;
+
+        /**
+         * @brief Release a block's device memory
+         *
+         * @param block The block to release
+         */
+        void releaseBlock(Block & block) const;
+    };
+}
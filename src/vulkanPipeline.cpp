@@ -2,9 +2,9 @@
 
 namespace siofraEngine::systems
 {
-    VulkanPipeline::VulkanPipeline(VkPipeline pipeline, VkPipelineLayout pipelineLayout, IVulkanDevice const * device) :
+    VulkanPipeline::VulkanPipeline(VkPipeline pipeline, std::shared_ptr<IVulkanPipelineLayout> pipelineLayout, IVulkanDevice const * device) :
         pipeline{pipeline},
-        pipelineLayout{pipelineLayout},
+        pipelineLayout{std::move(pipelineLayout)},
         device{device}
     {
 
@@ -12,28 +12,25 @@ namespace siofraEngine::systems
 
     VulkanPipeline::VulkanPipeline(VulkanPipeline &&other) noexcept :
         pipeline{other.pipeline},
-        pipelineLayout{other.pipelineLayout},
+        pipelineLayout{std::move(other.pipelineLayout)},
         device{other.device}
     {
         other.pipeline = VK_NULL_HANDLE;
-        other.pipelineLayout = VK_NULL_HANDLE;
         other.device = nullptr;
     }
 
     VulkanPipeline::~VulkanPipeline()
     {
-        auto logicalDevice = device->getLogicalDevice();
-        vkDestroyPipeline(logicalDevice, pipeline, nullptr);
-		vkDestroyPipelineLayout(logicalDevice, pipelineLayout, nullptr);
+        // The pipeline layout is released with the last pipeline referencing it
+        vkDestroyPipeline(device->getLogicalDevice(), pipeline, nullptr);
     }
 
     VulkanPipeline& VulkanPipeline::operator=(VulkanPipeline &&other) noexcept
     {
         pipeline = other.pipeline;
-        pipelineLayout = other.pipelineLayout;
+        pipelineLayout = std::move(other.pipelineLayout);
         device = other.device;
         other.pipeline = VK_NULL_HANDLE;
-        other.pipelineLayout = VK_NULL_HANDLE;
         other.device = nullptr;
         return *this;
     }
@@ -41,7 +38,8 @@ namespace siofraEngine::systems
     VulkanPipeline::operator bool() const noexcept
     {
         return pipeline != VK_NULL_HANDLE &&
-            pipelineLayout != VK_NULL_HANDLE;
+            pipelineLayout &&
+            *pipelineLayout;
     }
 
     VkPipeline VulkanPipeline::getPipeline() const noexcept
@@ -51,7 +49,7 @@ namespace siofraEngine::systems
 
     VkPipelineLayout VulkanPipeline::getPipelineLayout() const noexcept
     {
-        return pipelineLayout;
+        return pipelineLayout ? pipelineLayout->getPipelineLayout() : VK_NULL_HANDLE;
     }
 
     void VulkanPipeline::bind(IVulkanCommandBuffer const * commandBuffer, VkPipelineBindPoint pipelineBindPoint) const
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanPipeline.hpp"
+#include <memory>
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanPipelineLayout.hpp"
 
 namespace siofraEngine::systems
 {
@@ -20,10 +22,10 @@ namespace siofraEngine::systems
          * @brief VulkanPipeline constructor
          * 
          * @param pipeline Vulkan pipeline handle
-         * @param pipelineLayout Vulkan pipeline layout handle
+         * @param pipelineLayout The pipeline layout, which may be shared with other pipelines
          * @param device The Vulkan device used to create the pipeline
          */
-        VulkanPipeline(VkPipeline pipeline, VkPipelineLayout pipelineLayout, IVulkanDevice const * device);
+        VulkanPipeline(VkPipeline pipeline, std::shared_ptr<IVulkanPipelineLayout> pipelineLayout, IVulkanDevice const * device);
 
         /**
          * @brief VulkanPipeline copy constructor
@@ -94,9 +96,9 @@ namespace siofraEngine::systems
         VkPipeline pipeline{ VK_NULL_HANDLE };
 
         /**
-         * @brief Vulkan pipeline layout handle
+         * @brief The pipeline layout, which may be shared with other pipelines
          */
-        VkPipelineLayout pipelineLayout{ VK_NULL_HANDLE };
+        std::shared_ptr<IVulkanPipelineLayout> pipelineLayout{ nullptr };
 
         /**
          * @brief The Vulkan device used to create the pipeline
@@ -0,0 +1,116 @@
+#include "systems/renderer/vulkan/vulkanComponents/vulkanPipelineCache.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanPipelineCache::VulkanPipelineCache(VkPipelineCache pipelineCache, std::string filePath, IVulkanDevice const * device) :
+        pipelineCache{pipelineCache},
+        filePath{std::move(filePath)},
+        device{device}
+    {
+
+    }
+
+    VulkanPipelineCache::VulkanPipelineCache(VulkanPipelineCache &&other) noexcept :
+        pipelineCache{other.pipelineCache},
+        filePath{std::move(other.filePath)},
+        device{other.device}
+    {
+        other.pipelineCache = VK_NULL_HANDLE;
+        other.device = nullptr;
+    }
+
+    VulkanPipelineCache::~VulkanPipelineCache()
+    {
+        if (pipelineCache == VK_NULL_HANDLE)
+        {
+            return;
+        }
+
+        // Destructors must not throw, and a cache which fails to save is only a missed optimisation
+        try
+        {
+            save();
+        }
+        catch (...)
+        {
+        }
+
+        vkDestroyPipelineCache(device->getLogicalDevice(), pipelineCache, nullptr);
+    }
+
+    VulkanPipelineCache& VulkanPipelineCache::operator=(VulkanPipelineCache &&other) noexcept
+    {
+        pipelineCache = other.pipelineCache;
+        filePath = std::move(other.filePath);
+        device = other.device;
+        other.pipelineCache = VK_NULL_HANDLE;
+        other.device = nullptr;
+        return *this;
+    }
+
+    VulkanPipelineCache::operator bool() const noexcept
+    {
+        return pipelineCache != VK_NULL_HANDLE;
+    }
+
+    VkPipelineCache VulkanPipelineCache::getPipelineCache() const noexcept
+    {
+        return pipelineCache;
+    }
+
+    bool VulkanPipelineCache::save() const
+    {
+        if (pipelineCache == VK_NULL_HANDLE || filePath.empty())
+        {
+            return false;
+        }
+
+        size_t dataSize{ 0 };
+        if (vkGetPipelineCacheData(device->getLogicalDevice(), pipelineCache, &dataSize, nullptr) != VK_SUCCESS || dataSize == 0)
+        {
+            return false;
+        }
+
+        std::vector<char> data(dataSize);
+        if (vkGetPipelineCacheData(device->getLogicalDevice(), pipelineCache, &dataSize, data.data()) != VK_SUCCESS)
+        {
+            return false;
+        }
+
+        VkPhysicalDeviceProperties physicalDeviceProperties{ };
+        vkGetPhysicalDeviceProperties(device->getPhysicalDevice(), &physicalDeviceProperties);
+
+        FileHeader fileHeader{ };
+        fileHeader.magic = fileMagic;
+        fileHeader.driverVersion = physicalDeviceProperties.driverVersion;
+        fileHeader.dataSize = dataSize;
+
+        // Write alongside the destination then rename over it, so readers only ever see a complete file
+        std::string temporaryFilePath = filePath + ".tmp";
+        {
+            std::ofstream file(temporaryFilePath, std::ios::binary | std::ios::trunc);
+            if (!file)
+            {
+                return false;
+            }
+
+            file.write(reinterpret_cast<char const *>(&fileHeader), sizeof(FileHeader));
+            file.write(data.data(), static_cast<std::streamsize>(dataSize));
+            file.flush();
+            if (!file)
+            {
+                return false;
+            }
+        }
+
+        std::error_code errorCode{ };
+        std::filesystem::rename(temporaryFilePath, filePath, errorCode);
+        if (errorCode)
+        {
+            std::filesystem::remove(temporaryFilePath, errorCode);
+            return false;
+        }
+
+        return true;
+    }
+}
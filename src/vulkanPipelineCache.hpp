@@ -0,0 +1,133 @@
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanPipelineCache.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan pipeline cache, persisted to disk between runs
+     */
+    class VulkanPipelineCache : public IVulkanPipelineCache
+    {
+    public:
+        /**
+         * @brief VulkanPipelineCache builder
+         */
+        class Builder;
+
+        /**
+         * @brief VulkanPipelineCache constructor
+         * 
+         * @param pipelineCache Vulkan pipeline cache handle
+         * @param filePath Path of the file the pipeline cache is written to, or empty to never write the pipeline cache
+         * @param device Vulkan device used to create the pipeline cache
+         */
+        VulkanPipelineCache(VkPipelineCache pipelineCache, std::string filePath, IVulkanDevice const * device);
+
+        /**
+         * @brief VulkanPipelineCache copy constructor
+         * 
+         * @param other VulkanPipelineCache to copy
+         */
+        VulkanPipelineCache(VulkanPipelineCache const &other) = delete;
+
+        /**
+         * @brief VulkanPipelineCache move constructor
+         * 
+         * @param other VulkanPipelineCache to move
+         */
+        VulkanPipelineCache(VulkanPipelineCache &&other) noexcept;
+
+        /**
+         * @brief VulkanPipelineCache destructor. Writes the pipeline cache to disk, ignoring any failure. Call save beforehand to detect failures
+         */
+        ~VulkanPipelineCache();
+
+        /**
+         * @brief VulkanPipelineCache copy assignment
+         * 
+         * @param other VulkanPipelineCache to copy
+         */
+        VulkanPipelineCache& operator=(const VulkanPipelineCache &other) = delete;
+
+        /**
+         * @brief VulkanPipelineCache move assignment
+         * 
+         * @param other VulkanPipelineCache to move
+         */
+        VulkanPipelineCache& operator=(VulkanPipelineCache &&other) noexcept;
+
+        /**
+         * @brief Check if the wrapped handle is initialized
+         * 
+         * @returns True if the wrapped handle is intialized, otherwise false
+         */
+        operator bool() const noexcept override;
+
+        /**
+         * @brief Get the vulkan pipeline cache handle
+         * 
+         * @returns The vulkan pipeline cache handle
+         */
+        VkPipelineCache getPipelineCache() const noexcept override;
+
+        /**
+         * @brief Write the pipeline cache contents to disk. The file is replaced atomically so an interrupted write never leaves a partial cache behind
+         * 
+         * @returns True if the pipeline cache was written, otherwise false
+         */
+        bool save() const override;
+
+    private:
+        /**
+         * @brief Identifies files written by VulkanPipelineCache
+         */
+        static constexpr uint32_t fileMagic{ 0x48435056 };
+
+        /**
+         * @brief Largest driver provided data accepted from a file. Larger sizes are treated as corrupt rather than allocated
+         */
+        static constexpr uint64_t maxFileDataSize{ 256ull * 1024 * 1024 };
+
+        /**
+         * @brief Prefix written ahead of the driver provided pipeline cache data. The driver data carries the vendor, device and cache UUID but not the driver version
+         */
+        struct FileHeader
+        {
+            /**
+             * @brief Must equal fileMagic
+             */
+            uint32_t magic{ 0 };
+
+            /**
+             * @brief Driver version of the device which produced the data
+             */
+            uint32_t driverVersion{ 0 };
+
+            /**
+             * @brief Size of the driver provided data in bytes
+             */
+            uint64_t dataSize{ 0 };
+        };
+
+        /**
+         * @brief Vulkan pipeline cache handle
+         */
+        VkPipelineCache pipelineCache{ VK_NULL_HANDLE };
+
+        /**
+         * @brief Path of the file the pipeline cache is written to
+         */
+        std::string filePath{ };
+
+        /**
+         * @brief Vulkan device used to create the pipeline cache
+         */
+        IVulkanDevice const * device{ nullptr };
+    };
+}
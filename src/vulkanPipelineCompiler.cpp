@@ -0,0 +1,143 @@
+#include "systems/renderer/vulkan/vulkanComponents/vulkanPipelineCompiler.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanPipelineCompiler::VulkanPipelineCompiler(uint32_t threadCount, uint32_t batchSize) :
+        batchSize{batchSize}
+    {
+        for (uint32_t i = 0; i < threadCount; ++i)
+        {
+            workers.emplace_back(&VulkanPipelineCompiler::run, this);
+        }
+    }
+
+    VulkanPipelineCompiler::~VulkanPipelineCompiler()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        taskAvailable.notify_all();
+
+        for (auto & worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    VulkanPipelineCompiler::operator bool() const noexcept
+    {
+        return !workers.empty();
+    }
+
+    std::future<std::unique_ptr<IVulkanPipeline>> VulkanPipelineCompiler::compile(std::unique_ptr<IVulkanPipelineBuilder> pipelineBuilder)
+    {
+        auto batch = std::make_shared<Batch>();
+        batch->pipelineBuilders.push_back(std::move(pipelineBuilder));
+        batch->promises.resize(1);
+
+        std::future<std::unique_ptr<IVulkanPipeline>> future = batch->promises.front().get_future();
+        enqueue(std::move(batch));
+
+        return future;
+    }
+
+    std::vector<std::future<std::unique_ptr<IVulkanPipeline>>> VulkanPipelineCompiler::compile(std::vector<std::unique_ptr<IVulkanPipelineBuilder>> pipelineBuilders)
+    {
+        std::vector<std::future<std::unique_ptr<IVulkanPipeline>>> futures{ };
+        std::shared_ptr<Batch> batch{ nullptr };
+
+        for (auto & pipelineBuilder : pipelineBuilders)
+        {
+            // Only VulkanPipeline builders can share a creation call, anything else is compiled on its own
+            bool batchable = dynamic_cast<VulkanPipeline::Builder const *>(pipelineBuilder.get()) != nullptr;
+            if (batch && (!batchable || batch->pipelineBuilders.size() >= batchSize))
+            {
+                enqueue(std::move(batch));
+                batch = nullptr;
+            }
+
+            if (!batchable)
+            {
+                futures.push_back(compile(std::move(pipelineBuilder)));
+                continue;
+            }
+
+            if (!batch)
+            {
+                batch = std::make_shared<Batch>();
+            }
+            batch->pipelineBuilders.push_back(std::move(pipelineBuilder));
+            batch->promises.emplace_back();
+            futures.push_back(batch->promises.back().get_future());
+        }
+
+        if (batch)
+        {
+            enqueue(std::move(batch));
+        }
+
+        return futures;
+    }
+
+    void VulkanPipelineCompiler::run()
+    {
+        while (true)
+        {
+            std::function<void()> task{ };
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                taskAvailable.wait(lock, [this] { return stopping || !tasks.empty(); });
+                if (tasks.empty())
+                {
+                    return;
+                }
+
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+
+            task();
+        }
+    }
+
+    void VulkanPipelineCompiler::enqueue(std::shared_ptr<Batch> batch)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.push_back([batch] { compileBatch(*batch); });
+        }
+        taskAvailable.notify_one();
+    }
+
+    void VulkanPipelineCompiler::compileBatch(Batch & batch)
+    {
+        try
+        {
+            if (batch.pipelineBuilders.size() == 1)
+            {
+                batch.promises.front().set_value(batch.pipelineBuilders.front()->build());
+                return;
+            }
+
+            std::vector<VulkanPipeline::Builder const *> pipelineBuilders{ };
+            for (auto const & pipelineBuilder : batch.pipelineBuilders)
+            {
+                pipelineBuilders.push_back(static_cast<VulkanPipeline::Builder const *>(pipelineBuilder.get()));
+            }
+
+            std::vector<std::unique_ptr<IVulkanPipeline>> pipelines = VulkanPipeline::Builder::buildBatch(pipelineBuilders);
+            for (size_t i = 0; i < pipelines.size(); ++i)
+            {
+                batch.promises[i].set_value(std::move(pipelines[i]));
+            }
+        }
+        catch (...)
+        {
+            for (auto & promise : batch.promises)
+            {
+                promise.set_exception(std::current_exception());
+            }
+        }
+    }
+}
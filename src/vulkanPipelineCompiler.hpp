@@ -0,0 +1,157 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanPipelineCompiler.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/vulkanPipelineBuilder.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Compiles pipelines on a pool of worker threads
+     */
+    class VulkanPipelineCompiler : public IVulkanPipelineCompiler
+    {
+    public:
+        /**
+         * @brief VulkanPipelineCompiler builder
+         */
+        class Builder;
+
+        /**
+         * @brief VulkanPipelineCompiler constructor
+         * 
+         * @param threadCount Number of worker threads
+         * @param batchSize Maximum number of pipelines created by a single pipeline creation call
+         */
+        VulkanPipelineCompiler(uint32_t threadCount, uint32_t batchSize);
+
+        /**
+         * @brief VulkanPipelineCompiler copy constructor
+         * 
+         * @param other VulkanPipelineCompiler to copy
+         */
+        VulkanPipelineCompiler(VulkanPipelineCompiler const &other) = delete;
+
+        /**
+         * @brief VulkanPipelineCompiler move constructor
+         * 
+         * @param other VulkanPipelineCompiler to move
+         */
+        VulkanPipelineCompiler(VulkanPipelineCompiler &&other) = delete;
+
+        /**
+         * @brief VulkanPipelineCompiler destructor. Completes all queued compilations before returning
+         */
+        ~VulkanPipelineCompiler();
+
+        /**
+         * @brief VulkanPipelineCompiler copy assignment
+         * 
+         * @param other VulkanPipelineCompiler to copy
+         */
+        VulkanPipelineCompiler& operator=(const VulkanPipelineCompiler &other) = delete;
+
+        /**
+         * @brief VulkanPipelineCompiler move assignment
+         * 
+         * @param other VulkanPipelineCompiler to move
+         */
+        VulkanPipelineCompiler& operator=(VulkanPipelineCompiler &&other) = delete;
+
+        /**
+         * @brief Check if the worker threads are running
+         * 
+         * @returns True if the worker threads are running, otherwise false
+         */
+        operator bool() const noexcept override;
+
+        /**
+         * @brief Queue a configured pipeline builder for compilation
+         * 
+         * @param pipelineBuilder The configured pipeline builder
+         * @returns Future which receives the compiled pipeline, or the exception thrown while building it
+         */
+        std::future<std::unique_ptr<IVulkanPipeline>> compile(std::unique_ptr<IVulkanPipelineBuilder> pipelineBuilder) override;
+
+        /**
+         * @brief Queue several configured pipeline builders for compilation. Consecutive VulkanPipeline builders are grouped into
+         * batches of up to batchSize which are created by a single pipeline creation call, and must share a device and pipeline cache
+         * 
+         * @param pipelineBuilders The configured pipeline builders
+         * @returns Futures which receive the compiled pipelines, in the order of the builders
+         */
+        std::vector<std::future<std::unique_ptr<IVulkanPipeline>>> compile(std::vector<std::unique_ptr<IVulkanPipelineBuilder>> pipelineBuilders) override;
+
+    private:
+        /**
+         * @brief Pipeline builders compiled together by a single worker
+         */
+        struct Batch
+        {
+            /**
+             * @brief The configured pipeline builders
+             */
+            std::vector<std::unique_ptr<IVulkanPipelineBuilder>> pipelineBuilders{ };
+
+            /**
+             * @brief Promises for the compiled pipelines, one per builder
+             */
+            std::vector<std::promise<std::unique_ptr<IVulkanPipeline>>> promises{ };
+        };
+
+        /**
+         * @brief Maximum number of pipelines created by a single pipeline creation call
+         */
+        uint32_t batchSize{ 1 };
+
+        /**
+         * @brief Queued batches
+         */
+        std::deque<std::function<void()>> tasks{ };
+
+        /**
+         * @brief Guards the task queue
+         */
+        std::mutex mutex{ };
+
+        /**
+         * @brief Signaled when a task is queued or the compiler is shutting down
+         */
+        std::condition_variable taskAvailable{ };
+
+        /**
+         * @brief Indicates the workers should exit once the task queue is empty
+         */
+        bool stopping{ false };
+
+        /**
+         * @brief Worker threads
+         */
+        std::vector<std::thread> workers{ };
+
+        /**
+         * @brief Worker thread entry point
+         */
+        void run();
+
+        /**
+         * @brief Queue a batch for compilation
+         * 
+         * @param batch The batch to compile
+         */
+        void enqueue(std::shared_ptr<Batch> batch);
+
+        /**
+         * @brief Compile a batch, fulfilling its promises
+         * 
+         * @param batch The batch to compile
+         */
+        static void compileBatch(Batch & batch);
+    };
+}
@@ -0,0 +1,43 @@
+#include "systems/renderer/vulkan/vulkanComponents/vulkanPipelineLayout.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanPipelineLayout::VulkanPipelineLayout(VkPipelineLayout pipelineLayout, IVulkanDevice const * device) :
+        pipelineLayout{pipelineLayout},
+        device{device}
+    {
+
+    }
+
+    VulkanPipelineLayout::VulkanPipelineLayout(VulkanPipelineLayout &&other) noexcept :
+        pipelineLayout{other.pipelineLayout},
+        device{other.device}
+    {
+        other.pipelineLayout = VK_NULL_HANDLE;
+        other.device = nullptr;
+    }
+
+    VulkanPipelineLayout::~VulkanPipelineLayout()
+    {
+        vkDestroyPipelineLayout(device->getLogicalDevice(), pipelineLayout, nullptr);
+    }
+
+    VulkanPipelineLayout& VulkanPipelineLayout::operator=(VulkanPipelineLayout &&other) noexcept
+    {
+        pipelineLayout = other.pipelineLayout;
+        device = other.device;
+        other.pipelineLayout = VK_NULL_HANDLE;
+        other.device = nullptr;
+        return *this;
+    }
+
+    VulkanPipelineLayout::operator bool() const noexcept
+    {
+        return pipelineLayout != VK_NULL_HANDLE;
+    }
+
+    VkPipelineLayout VulkanPipelineLayout::getPipelineLayout() const noexcept
+    {
+        return pipelineLayout;
+    }
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanPipelineLayout.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan pipeline layout
+     */
+    class VulkanPipelineLayout : public IVulkanPipelineLayout
+    {
+    public:
+        /**
+         * @brief VulkanPipelineLayout builder
+         */
+        class Builder;
+
+        /**
+         * @brief VulkanPipelineLayout constructor
+         * 
+         * @param pipelineLayout Vulkan pipeline layout handle
+         * @param device Vulkan device used to create the pipeline layout
+         */
+        VulkanPipelineLayout(VkPipelineLayout pipelineLayout, IVulkanDevice const * device);
+
+        /**
+         * @brief VulkanPipelineLayout copy constructor
+         * 
+         * @param other VulkanPipelineLayout to copy
+         */
+        VulkanPipelineLayout(VulkanPipelineLayout const &other) = delete;
+
+        /**
+         * @brief VulkanPipelineLayout move constructor
+         * 
+         * @param other VulkanPipelineLayout to move
+         */
+        VulkanPipelineLayout(VulkanPipelineLayout &&other) noexcept;
+
+        /**
+         * @brief VulkanPipelineLayout destructor
+         */
+        ~VulkanPipelineLayout();
+
+        /**
+         * @brief VulkanPipelineLayout copy assignment
+         * 
+         * @param other VulkanPipelineLayout to copy
+         */
+        VulkanPipelineLayout& operator=(const VulkanPipelineLayout &other) = delete;
+
+        /**
+         * @brief VulkanPipelineLayout move assignment
+         * 
+         * @param other VulkanPipelineLayout to move
+         */
+        VulkanPipelineLayout& operator=(VulkanPipelineLayout &&other) noexcept;
+
+        /**
+         * @brief Check if the wrapped handle is initialized
+         * 
+         * @returns True if the wrapped handle is intialized, otherwise false
+         */
+        operator bool() const noexcept override;
+
+        /**
+         * @brief Get the Vulkan pipeline layout handle
+         * 
+         * @returns The Vulkan pipeline layout handle
+         */
+        VkPipelineLayout getPipelineLayout() const noexcept override;
+
+    private:
+        /**
+         * @brief Vulkan pipeline layout handle
+         */
+        VkPipelineLayout pipelineLayout{ VK_NULL_HANDLE };
+
+        /**
+         * @brief Vulkan device used to create the pipeline layout
+         */
+        IVulkanDevice const * device{ nullptr };
+    };
+}
@@ -0,0 +1,44 @@
+#include "systems/renderer/vulkan/vulkanComponents/vulkanPipelineLayoutCache.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanPipelineLayoutCache::operator bool() const noexcept
+    {
+        return true;
+    }
+
+    std::shared_ptr<IVulkanPipelineLayout> VulkanPipelineLayoutCache::getOrCreate(IVulkanPipelineLayoutBuilder const & pipelineLayoutBuilder)
+    {
+        std::string stateKey = pipelineLayoutBuilder.getStateKey();
+
+        // Layout creation is cheap, so it happens under the lock rather than risking two handles for one state
+        std::lock_guard<std::mutex> lock(mutex);
+        std::shared_ptr<IVulkanPipelineLayout> & pipelineLayout = pipelineLayouts[stateKey];
+        if (!pipelineLayout)
+        {
+            try
+            {
+                pipelineLayout = pipelineLayoutBuilder.build();
+            }
+            catch (...)
+            {
+                pipelineLayouts.erase(stateKey);
+                throw;
+            }
+        }
+
+        return pipelineLayout;
+    }
+
+    size_t VulkanPipelineLayoutCache::size() const noexcept
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return pipelineLayouts.size();
+    }
+
+    void VulkanPipelineLayoutCache::clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pipelineLayouts.clear();
+    }
+}
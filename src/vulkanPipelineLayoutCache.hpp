@@ -0,0 +1,93 @@
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanPipelineLayoutCache.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Shares one pipeline layout between all requests for identical descriptor set layouts and push constant ranges, so
+     * descriptor sets bound against one pipeline remain compatible with every other pipeline using the same layout
+     */
+    class VulkanPipelineLayoutCache : public IVulkanPipelineLayoutCache
+    {
+    public:
+        /**
+         * @brief VulkanPipelineLayoutCache constructor
+         */
+        VulkanPipelineLayoutCache() = default;
+
+        /**
+         * @brief VulkanPipelineLayoutCache copy constructor
+         * 
+         * @param other VulkanPipelineLayoutCache to copy
+         */
+        VulkanPipelineLayoutCache(VulkanPipelineLayoutCache const &other) = delete;
+
+        /**
+         * @brief VulkanPipelineLayoutCache move constructor
+         * 
+         * @param other VulkanPipelineLayoutCache to move
+         */
+        VulkanPipelineLayoutCache(VulkanPipelineLayoutCache &&other) = delete;
+
+        /**
+         * @brief VulkanPipelineLayoutCache destructor
+         */
+        ~VulkanPipelineLayoutCache() = default;
+
+        /**
+         * @brief VulkanPipelineLayoutCache copy assignment
+         * 
+         * @param other VulkanPipelineLayoutCache to copy
+         */
+        VulkanPipelineLayoutCache& operator=(const VulkanPipelineLayoutCache &other) = delete;
+
+        /**
+         * @brief VulkanPipelineLayoutCache move assignment
+         * 
+         * @param other VulkanPipelineLayoutCache to move
+         */
+        VulkanPipelineLayoutCache& operator=(VulkanPipelineLayoutCache &&other) = delete;
+
+        /**
+         * @brief Check if the cache is usable
+         * 
+         * @returns Always true
+         */
+        operator bool() const noexcept override;
+
+        /**
+         * @brief Get the pipeline layout matching the state of a pipeline layout builder, building it on first request
+         * 
+         * @param pipelineLayoutBuilder The configured pipeline layout builder
+         * @returns The shared pipeline layout
+         */
+        std::shared_ptr<IVulkanPipelineLayout> getOrCreate(IVulkanPipelineLayoutBuilder const & pipelineLayoutBuilder) override;
+
+        /**
+         * @brief Get the number of cached pipeline layouts
+         * 
+         * @returns The number of cached pipeline layouts
+         */
+        size_t size() const noexcept override;
+
+        /**
+         * @brief Release the cache's references to its pipeline layouts. Layouts still used by pipelines are destroyed with their last pipeline
+         */
+        void clear() override;
+
+    private:
+        /**
+         * @brief Cached pipeline layouts keyed by layout state key
+         */
+        std::unordered_map<std::string, std::shared_ptr<IVulkanPipelineLayout>> pipelineLayouts{ };
+
+        /**
+         * @brief Guards the cached pipeline layouts
+         */
+        mutable std::mutex mutex{ };
+    };
+}
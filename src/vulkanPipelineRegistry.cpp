@@ -0,0 +1,71 @@
+#include "systems/renderer/vulkan/vulkanComponents/vulkanPipelineRegistry.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanPipelineRegistry::operator bool() const noexcept
+    {
+        return true;
+    }
+
+    std::shared_ptr<IVulkanPipeline> VulkanPipelineRegistry::getOrCreate(IVulkanPipelineBuilder const & pipelineBuilder)
+    {
+        return getOrCreate(pipelineBuilder.getStateKey(), [&pipelineBuilder]() { return pipelineBuilder.build(); });
+    }
+
+    std::shared_ptr<IVulkanPipeline> VulkanPipelineRegistry::getOrCreate(IVulkanComputePipelineBuilder const & pipelineBuilder)
+    {
+        return getOrCreate(pipelineBuilder.getStateKey(), [&pipelineBuilder]() { return pipelineBuilder.build(); });
+    }
+
+    uint64_t VulkanPipelineRegistry::getHitCount() const noexcept
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return hitCount;
+    }
+
+    uint64_t VulkanPipelineRegistry::getMissCount() const noexcept
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return missCount;
+    }
+
+    void VulkanPipelineRegistry::purge()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto entry = pipelines.begin(); entry != pipelines.end();)
+        {
+            entry = entry->second.expired() ? pipelines.erase(entry) : std::next(entry);
+        }
+    }
+
+    std::shared_ptr<IVulkanPipeline> VulkanPipelineRegistry::getOrCreate(std::string const & stateKey, std::function<std::unique_ptr<IVulkanPipeline>()> const & build)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto entry = pipelines.find(stateKey);
+            if (entry != pipelines.end())
+            {
+                if (std::shared_ptr<IVulkanPipeline> pipeline = entry->second.lock())
+                {
+                    ++hitCount;
+                    return pipeline;
+                }
+            }
+        }
+
+        std::shared_ptr<IVulkanPipeline> pipeline = build();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        std::weak_ptr<IVulkanPipeline> & registered = pipelines[stateKey];
+        if (std::shared_ptr<IVulkanPipeline> existing = registered.lock())
+        {
+            // Another thread registered the same state while this one was building
+            ++hitCount;
+            return existing;
+        }
+
+        ++missCount;
+        registered = pipeline;
+        return pipeline;
+    }
+}
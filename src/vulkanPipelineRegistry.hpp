@@ -0,0 +1,129 @@
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanPipelineRegistry.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Shares pipelines between requests for identical pipeline state. Pipelines are reference counted and
+     * destroyed once the last reference is released, so the registry never extends their lifetime
+     */
+    class VulkanPipelineRegistry : public IVulkanPipelineRegistry
+    {
+    public:
+        /**
+         * @brief VulkanPipelineRegistry constructor
+         */
+        VulkanPipelineRegistry() = default;
+
+        /**
+         * @brief VulkanPipelineRegistry copy constructor
+         * 
+         * @param other VulkanPipelineRegistry to copy
+         */
+        VulkanPipelineRegistry(VulkanPipelineRegistry const &other) = delete;
+
+        /**
+         * @brief VulkanPipelineRegistry move constructor
+         * 
+         * @param other VulkanPipelineRegistry to move
+         */
+        VulkanPipelineRegistry(VulkanPipelineRegistry &&other) = delete;
+
+        /**
+         * @brief VulkanPipelineRegistry destructor
+         */
+        ~VulkanPipelineRegistry() = default;
+
+        /**
+         * @brief VulkanPipelineRegistry copy assignment
+         * 
+         * @param other VulkanPipelineRegistry to copy
+         */
+        VulkanPipelineRegistry& operator=(const VulkanPipelineRegistry &other) = delete;
+
+        /**
+         * @brief VulkanPipelineRegistry move assignment
+         * 
+         * @param other VulkanPipelineRegistry to move
+         */
+        VulkanPipelineRegistry& operator=(VulkanPipelineRegistry &&other) = delete;
+
+        /**
+         * @brief Check if the registry is usable
+         * 
+         * @returns Always true
+         */
+        operator bool() const noexcept override;
+
+        /**
+         * @brief Get the pipeline matching the state of a graphics pipeline builder, building it if no matching pipeline is alive
+         * 
+         * @param pipelineBuilder The configured pipeline builder
+         * @returns The shared pipeline
+         */
+        std::shared_ptr<IVulkanPipeline> getOrCreate(IVulkanPipelineBuilder const & pipelineBuilder) override;
+
+        /**
+         * @brief Get the pipeline matching the state of a compute pipeline builder, building it if no matching pipeline is alive
+         * 
+         * @param pipelineBuilder The configured compute pipeline builder
+         * @returns The shared pipeline
+         */
+        std::shared_ptr<IVulkanPipeline> getOrCreate(IVulkanComputePipelineBuilder const & pipelineBuilder) override;
+
+        /**
+         * @brief Get the number of requests served by an existing pipeline
+         * 
+         * @returns The number of hits
+         */
+        uint64_t getHitCount() const noexcept override;
+
+        /**
+         * @brief Get the number of requests which built a new pipeline
+         * 
+         * @returns The number of misses
+         */
+        uint64_t getMissCount() const noexcept override;
+
+        /**
+         * @brief Remove the entries of pipelines which are no longer referenced
+         */
+        void purge() override;
+
+    private:
+        /**
+         * @brief Registered pipelines keyed by pipeline state key
+         */
+        std::unordered_map<std::string, std::weak_ptr<IVulkanPipeline>> pipelines{ };
+
+        /**
+         * @brief Number of requests served by an existing pipeline
+         */
+        uint64_t hitCount{ 0 };
+
+        /**
+         * @brief Number of requests which built a new pipeline
+         */
+        uint64_t missCount{ 0 };
+
+        /**
+         * @brief Guards the registered pipelines and counters
+         */
+        mutable std::mutex mutex{ };
+
+        /**
+         * @brief Get the pipeline registered for a state key, building and registering it if no matching pipeline is alive.
+         * Building happens without holding the mutex so pipelines with different state build concurrently
+         * 
+         * @param stateKey The pipeline state key
+         * @param build Builds the pipeline
+         * @returns The shared pipeline
+         */
+        std::shared_ptr<IVulkanPipeline> getOrCreate(std::string const & stateKey, std::function<std::unique_ptr<IVulkanPipeline>()> const & build);
+    };
+}
@@ -0,0 +1,96 @@
+#include "systems/renderer/vulkan/vulkanComponents/vulkanQueryPool.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanQueryPool::VulkanQueryPool(VkQueryPool queryPool, VkQueryType queryType, uint32_t queryCount, IVulkanDevice const * device) :
+        queryPool{queryPool},
+        queryType{queryType},
+        queryCount{queryCount},
+        device{device}
+    {
+
+    }
+
+    VulkanQueryPool::VulkanQueryPool(VulkanQueryPool &&other) noexcept :
+        queryPool{other.queryPool},
+        queryType{other.queryType},
+        queryCount{other.queryCount},
+        device{other.device}
+    {
+        other.queryPool = VK_NULL_HANDLE;
+        other.queryCount = 0;
+        other.device = nullptr;
+    }
+
+    VulkanQueryPool::~VulkanQueryPool()
+    {
+        vkDestroyQueryPool(device->getLogicalDevice(), queryPool, nullptr);
+    }
+
+    VulkanQueryPool& VulkanQueryPool::operator=(VulkanQueryPool &&other) noexcept
+    {
+        queryPool = other.queryPool;
+        queryType = other.queryType;
+        queryCount = other.queryCount;
+        device = other.device;
+        other.queryPool = VK_NULL_HANDLE;
+        other.queryCount = 0;
+        other.device = nullptr;
+        return *this;
+    }
+
+    VulkanQueryPool::operator bool() const noexcept
+    {
+        return queryPool != VK_NULL_HANDLE;
+    }
+
+    VkQueryPool VulkanQueryPool::getQueryPool() const noexcept
+    {
+        return queryPool;
+    }
+
+    VkQueryType VulkanQueryPool::getQueryType() const noexcept
+    {
+        return queryType;
+    }
+
+    uint32_t VulkanQueryPool::getQueryCount() const noexcept
+    {
+        return queryCount;
+    }
+
+    void VulkanQueryPool::reset(IVulkanCommandBuffer const * commandBuffer, uint32_t firstQuery, uint32_t queryCount) const
+    {
+        vkCmdResetQueryPool(commandBuffer->getCommandBuffer(), queryPool, firstQuery, queryCount);
+    }
+
+    void VulkanQueryPool::writeTimestamp(IVulkanCommandBuffer const * commandBuffer, VkPipelineStageFlagBits pipelineStage, uint32_t query) const
+    {
+        vkCmdWriteTimestamp(commandBuffer->getCommandBuffer(), pipelineStage, queryPool, query);
+    }
+
+    bool VulkanQueryPool::getResults(uint32_t firstQuery, uint32_t queryCount, std::vector<uint64_t> & results) const
+    {
+        results.resize(queryCount);
+        if (queryCount == 0)
+        {
+            return true;
+        }
+
+        VkResult result = vkGetQueryPoolResults(
+            device->getLogicalDevice(),
+            queryPool,
+            firstQuery,
+            queryCount,
+            results.size() * sizeof(uint64_t),
+            results.data(),
+            sizeof(uint64_t),
+            VK_QUERY_RESULT_64_BIT);
+
+        if (result != VK_SUCCESS && result != VK_NOT_READY)
+        {
+            throw std::runtime_error("Failed to get query pool results");
+        }
+        return result == VK_SUCCESS;
+    }
+}
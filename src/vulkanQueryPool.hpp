@@ -0,0 +1,140 @@
+#pragma once
+
+#include <stdexcept>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanQueryPool.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Vulkan query pool
+     */
+    class VulkanQueryPool : public IVulkanQueryPool
+    {
+    public:
+        /**
+         * @brief VulkanQueryPool builder
+         */
+        class Builder;
+
+        /**
+         * @brief VulkanQueryPool constructor
+         * 
+         * @param queryPool Vulkan query pool handle
+         * @param queryType Type of the queries in the pool
+         * @param queryCount Number of queries in the pool
+         * @param device Vulkan device used to create the query pool
+         */
+        VulkanQueryPool(VkQueryPool queryPool, VkQueryType queryType, uint32_t queryCount, IVulkanDevice const * device);
+
+        /**
+         * @brief VulkanQueryPool copy constructor
+         * 
+         * @param other VulkanQueryPool to copy
+         */
+        VulkanQueryPool(VulkanQueryPool const &other) = delete;
+
+        /**
+         * @brief VulkanQueryPool move constructor
+         * 
+         * @param other VulkanQueryPool to move
+         */
+        VulkanQueryPool(VulkanQueryPool &&other) noexcept;
+
+        /**
+         * @brief VulkanQueryPool destructor
+         */
+        ~VulkanQueryPool();
+
+        /**
+         * @brief VulkanQueryPool copy assignment
+         * 
+         * @param other VulkanQueryPool to copy
+         */
+        VulkanQueryPool& operator=(const VulkanQueryPool &other) = delete;
+
+        /**
+         * @brief VulkanQueryPool move assignment
+         * 
+         * @param other VulkanQueryPool to move
+         */
+        VulkanQueryPool& operator=(VulkanQueryPool &&other) noexcept;
+
+        /**
+         * @brief Check if the wrapped handle is initialized
+         * 
+         * @returns True if the wrapped handle is intialized, otherwise false
+         */
+        operator bool() const noexcept override;
+
+        /**
+         * @brief Get the vulkan query pool handle
+         * 
+         * @returns The vulkan query pool handle
+         */
+        VkQueryPool getQueryPool() const noexcept override;
+
+        /**
+         * @brief Get the type of the queries in the pool
+         * 
+         * @returns The query type
+         */
+        VkQueryType getQueryType() const noexcept override;
+
+        /**
+         * @brief Get the number of queries in the pool
+         * 
+         * @returns The number of queries
+         */
+        uint32_t getQueryCount() const noexcept override;
+
+        /**
+         * @brief Record a reset of a range of queries. Must be recorded outside of a render pass
+         * 
+         * @param commandBuffer The command buffer in which to record the command
+         * @param firstQuery Index of the first query to reset
+         * @param queryCount Number of queries to reset
+         */
+        void reset(IVulkanCommandBuffer const * commandBuffer, uint32_t firstQuery, uint32_t queryCount) const override;
+
+        /**
+         * @brief Record a timestamp write once all previous commands have reached a pipeline stage
+         * 
+         * @param commandBuffer The command buffer in which to record the command
+         * @param pipelineStage The pipeline stage to wait for
+         * @param query Index of the query to write
+         */
+        void writeTimestamp(IVulkanCommandBuffer const * commandBuffer, VkPipelineStageFlagBits pipelineStage, uint32_t query) const override;
+
+        /**
+         * @brief Read back the 64 bit results of a range of queries without waiting for them to become available
+         * 
+         * @param firstQuery Index of the first query to read
+         * @param queryCount Number of queries to read
+         * @param results The results to populate
+         * @returns True if every result was available, otherwise false
+         */
+        bool getResults(uint32_t firstQuery, uint32_t queryCount, std::vector<uint64_t> & results) const override;
+
+    private:
+        /**
+         * @brief Vulkan query pool handle
+         */
+        VkQueryPool queryPool{ VK_NULL_HANDLE };
+
+        /**
+         * @brief Type of the queries in the pool
+         */
+        VkQueryType queryType{ VK_QUERY_TYPE_TIMESTAMP };
+
+        /**
+         * @brief Number of queries in the pool
+         */
+        uint32_t queryCount{ 0 };
+
+        /**
+         * @brief Vulkan device used to create the query pool
+         */
+        IVulkanDevice const * device{ nullptr };
+    };
+}
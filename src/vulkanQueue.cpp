@@ -2,16 +2,18 @@
 
 namespace siofraEngine::systems
 {
-    VulkanQueue::VulkanQueue(VkQueue queue, uint32_t familyIndex) :
+    VulkanQueue::VulkanQueue(VkQueue queue, uint32_t familyIndex, bool synchronization2) :
         queue(queue),
-        familyIndex(familyIndex)
+        familyIndex(familyIndex),
+        synchronization2(synchronization2)
     {
 
     }
 
     VulkanQueue::VulkanQueue(VulkanQueue &&other) noexcept :
         queue(other.queue),
-        familyIndex(other.familyIndex)
+        familyIndex(other.familyIndex),
+        synchronization2(other.synchronization2)
     {
         other.queue = VK_NULL_HANDLE;
     }
@@ -20,6 +22,7 @@ namespace siofraEngine::systems
     {
         queue = other.queue;
         familyIndex = other.familyIndex;
+        synchronization2 = other.synchronization2;
         other.queue = VK_NULL_HANDLE;
         other.familyIndex = -1;
         return *this;
@@ -83,7 +86,104 @@ namespace siofraEngine::systems
         }
     }
 
-    void VulkanQueue::present(IVulkanSemaphore const * waitSemaphore, IVulkanSwapchain const * swapchain, uint32_t imageIndex) const
+    void VulkanQueue::submit(IVulkanSemaphore const * waitSemaphore, VkPipelineStageFlags2 waitStage, IVulkanSemaphore const * signalSemaphore, IVulkanFence const * fence, IVulkanCommandBuffer const * commandBuffer) const
+    {
+        submit(waitSemaphore, 0, waitStage, signalSemaphore, 0, fence, commandBuffer);
+    }
+
+    void VulkanQueue::submit(IVulkanSemaphore const * waitSemaphore, uint64_t waitValue, VkPipelineStageFlags2 waitStage, IVulkanSemaphore const * signalSemaphore, uint64_t signalValue, IVulkanFence const * fence, IVulkanCommandBuffer const * commandBuffer) const
+    {
+        VkSemaphore waitSemaphoreHandle = waitSemaphore ? waitSemaphore->getSemaphore() : VK_NULL_HANDLE;
+        VkSemaphore signalSemaphoreHandle = signalSemaphore ? signalSemaphore->getSemaphore() : VK_NULL_HANDLE;
+        VkCommandBuffer commandBufferHandle = commandBuffer->getCommandBuffer();
+        VkFence fenceHandle = fence ? fence->getFence() : VK_NULL_HANDLE;
+
+        if (synchronization2)
+        {
+            VkSemaphoreSubmitInfo waitSemaphoreInfo{ };
+            waitSemaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+            waitSemaphoreInfo.semaphore = waitSemaphoreHandle;
+            waitSemaphoreInfo.value = waitValue;
+            waitSemaphoreInfo.stageMask = waitStage;
+
+            VkCommandBufferSubmitInfo commandBufferInfo{ };
+            commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+            commandBufferInfo.commandBuffer = commandBufferHandle;
+
+            VkSemaphoreSubmitInfo signalSemaphoreInfo{ };
+            signalSemaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+            signalSemaphoreInfo.semaphore = signalSemaphoreHandle;
+            signalSemaphoreInfo.value = signalValue;
+            signalSemaphoreInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+
+            VkSubmitInfo2 submitInfo{ };
+            submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
+            submitInfo.pWaitSemaphoreInfos = &waitSemaphoreInfo;
+            submitInfo.waitSemaphoreInfoCount = waitSemaphore ? 1 : 0;
+            submitInfo.pCommandBufferInfos = &commandBufferInfo;
+            submitInfo.commandBufferInfoCount = 1;
+            submitInfo.pSignalSemaphoreInfos = &signalSemaphoreInfo;
+            submitInfo.signalSemaphoreInfoCount = signalSemaphore ? 1 : 0;
+
+            if (vkQueueSubmit2(queue, 1, &submitInfo, fenceHandle) != VK_SUCCESS)
+            {
+                throw std::runtime_error("Failed to submit command buffer to queue");
+            }
+            return;
+        }
+
+        VkPipelineStageFlags legacyWaitStage = VulkanBarrierBatch::toLegacyStageMask(waitStage);
+
+        // Semaphore values are only consumed for timeline semaphores, binary semaphores ignore them
+        VkTimelineSemaphoreSubmitInfo timelineSemaphoreSubmitInfo{ };
+        timelineSemaphoreSubmitInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timelineSemaphoreSubmitInfo.pWaitSemaphoreValues = &waitValue;
+        timelineSemaphoreSubmitInfo.waitSemaphoreValueCount = waitSemaphore ? 1 : 0;
+        timelineSemaphoreSubmitInfo.pSignalSemaphoreValues = &signalValue;
+        timelineSemaphoreSubmitInfo.signalSemaphoreValueCount = signalSemaphore ? 1 : 0;
+
+        bool timeline = (waitSemaphore && waitSemaphore->getType() == VK_SEMAPHORE_TYPE_TIMELINE) ||
+            (signalSemaphore && signalSemaphore->getType() == VK_SEMAPHORE_TYPE_TIMELINE);
+
+        VkSubmitInfo submitInfo{ };
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext = timeline ? &timelineSemaphoreSubmitInfo : nullptr;
+        submitInfo.pWaitSemaphores = &waitSemaphoreHandle;
+        submitInfo.waitSemaphoreCount = waitSemaphore ? 1 : 0;
+        submitInfo.pWaitDstStageMask = &legacyWaitStage;
+        submitInfo.pCommandBuffers = &commandBufferHandle;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pSignalSemaphores = &signalSemaphoreHandle;
+        submitInfo.signalSemaphoreCount = signalSemaphore ? 1 : 0;
+
+        if (vkQueueSubmit(queue, 1, &submitInfo, fenceHandle) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to submit command buffer to queue");
+        }
+    }
+
+    void VulkanQueue::submit(VulkanSubmitBatch const & submitBatch, IVulkanFence const * fence) const
+    {
+        VkFence fenceHandle = fence ? fence->getFence() : VK_NULL_HANDLE;
+
+        if (synchronization2)
+        {
+            std::vector<VkSubmitInfo2> const & submitInfos = submitBatch.getSubmitInfos2();
+            if (vkQueueSubmit2(queue, static_cast<uint32_t>(submitInfos.size()), submitInfos.data(), fenceHandle) != VK_SUCCESS)
+            {
+                throw std::runtime_error("Failed to submit command buffers to queue");
+            }
+            return;
+        }
+
+        std::vector<VkSubmitInfo> const & submitInfos = submitBatch.getSubmitInfos();
+        if (vkQueueSubmit(queue, static_cast<uint32_t>(submitInfos.size()), submitInfos.data(), fenceHandle) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to submit command buffers to queue");
+        }
+    }
+
+    VkResult VulkanQueue::present(IVulkanSemaphore const * waitSemaphore, IVulkanSwapchain const * swapchain, uint32_t imageIndex) const
     {
         VkSemaphore waitSemaphoreHandle = waitSemaphore->getSemaphore();
         VkSwapchainKHR swapchainHandle = swapchain->getSwapchain();
@@ -96,10 +196,12 @@ namespace siofraEngine::systems
         presentInfo.swapchainCount = 1;
         presentInfo.pImageIndices = &imageIndex;
 
-        if (vkQueuePresentKHR(queue, &presentInfo) != VK_SUCCESS)
+        VkResult result = vkQueuePresentKHR(queue, &presentInfo);
+        if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR && result != VK_ERROR_OUT_OF_DATE_KHR)
         {
             throw std::runtime_error("Failed to present image");
         }
+        return result;
     }
 
     void VulkanQueue::waitIdle() const
@@ -2,12 +2,14 @@
 
 namespace siofraEngine::systems
 {
-    VulkanRenderPass::VulkanRenderPass(VkRenderPass renderPass, VkOffset2D renderAreaOffset, VkExtent2D renderAreaExtents, std::vector<VkClearValue> clearValues, std::vector<std::unique_ptr<IVulkanFramebuffer>> framebuffers, IVulkanDevice const * device) :
+    VulkanRenderPass::VulkanRenderPass(VkRenderPass renderPass, VkOffset2D renderAreaOffset, VkExtent2D renderAreaExtents, std::vector<VkClearValue> clearValues, std::vector<std::unique_ptr<IVulkanFramebuffer>> framebuffers, uint32_t swapchainImageCount, std::string stateKey, IVulkanDevice const * device) :
         renderPass{renderPass},
         renderAreaOffset{renderAreaOffset},
         renderAreaExtents{renderAreaExtents},
         clearValues{std::move(clearValues)},
         framebuffers{std::move(framebuffers)},
+        swapchainImageCount{swapchainImageCount},
+        stateKey{std::move(stateKey)},
         device{device}
     {
 
@@ -19,11 +21,14 @@ namespace siofraEngine::systems
         renderAreaExtents{other.renderAreaExtents},
         clearValues{std::move(other.clearValues)},
         framebuffers{std::move(other.framebuffers)},
+        swapchainImageCount{other.swapchainImageCount},
+        stateKey{std::move(other.stateKey)},
         device{other.device}
     {
         other.renderPass = VK_NULL_HANDLE;
         other.renderAreaOffset = { 0, 0 };
         other.renderAreaExtents = { 0, 0 };
+        other.swapchainImageCount = 0;
         other.device = nullptr;
     }
 
@@ -39,10 +44,13 @@ namespace siofraEngine::systems
         renderAreaExtents = other.renderAreaExtents;
         clearValues = std::move(other.clearValues);
         framebuffers = std::move(other.framebuffers);
+        swapchainImageCount = other.swapchainImageCount;
+        stateKey = std::move(other.stateKey);
         device = other.device;
         other.renderPass = VK_NULL_HANDLE;
         other.renderAreaOffset = { 0, 0 };
         other.renderAreaExtents = { 0, 0 };
+        other.swapchainImageCount = 0;
         other.device = nullptr;
         return *this;
     }
@@ -57,12 +65,32 @@ namespace siofraEngine::systems
         return renderPass;
     }
 
+    std::string const & VulkanRenderPass::getStateKey() const noexcept
+    {
+        return stateKey;
+    }
+
     std::vector<std::unique_ptr<IVulkanFramebuffer>> const & VulkanRenderPass::getFramebuffers() const noexcept
     {
         return framebuffers;
     }
 
-    void VulkanRenderPass::begin(IVulkanCommandBuffer const * commandBuffer, uint32_t framebufferIndex) const
+    void VulkanRenderPass::begin(IVulkanCommandBuffer const * commandBuffer, uint32_t imageIndex) const
+    {
+        begin(commandBuffer, imageIndex, 0, VK_SUBPASS_CONTENTS_INLINE);
+    }
+
+    void VulkanRenderPass::begin(IVulkanCommandBuffer const * commandBuffer, uint32_t imageIndex, VkSubpassContents contents) const
+    {
+        begin(commandBuffer, imageIndex, 0, contents);
+    }
+
+    void VulkanRenderPass::begin(IVulkanCommandBuffer const * commandBuffer, uint32_t imageIndex, uint32_t frameIndex) const
+    {
+        begin(commandBuffer, imageIndex, frameIndex, VK_SUBPASS_CONTENTS_INLINE);
+    }
+
+    void VulkanRenderPass::begin(IVulkanCommandBuffer const * commandBuffer, uint32_t imageIndex, uint32_t frameIndex, VkSubpassContents contents) const
     {
         VkRenderPassBeginInfo renderPassBeginInfo = {};
         renderPassBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
@@ -71,9 +99,38 @@ namespace siofraEngine::systems
         renderPassBeginInfo.renderArea.extent = renderAreaExtents;
         renderPassBeginInfo.pClearValues = clearValues.data();
         renderPassBeginInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
-        renderPassBeginInfo.framebuffer = framebuffers[framebufferIndex]->getFramebuffer();
+        renderPassBeginInfo.framebuffer = framebuffers[frameIndex * swapchainImageCount + imageIndex]->getFramebuffer();
+
+        commandBuffer->flushBarriers();
+        vkCmdBeginRenderPass(commandBuffer->getCommandBuffer(), &renderPassBeginInfo, contents);
+    }
+
+    void VulkanRenderPass::recreateFramebuffers(IVulkanSwapchain const * swapchain, IVulkanFramebufferBuilder & vulkanFramebufferBuilder)
+    {
+        for (auto & framebuffer : framebuffers)
+        {
+            swapchain->retire(std::move(framebuffer));
+        }
+
+        renderAreaExtents = swapchain->getExtents();
 
-        vkCmdBeginRenderPass(commandBuffer->getCommandBuffer(), &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
+        std::vector<std::unique_ptr<IVulkanImage>> const & swapchainImages = swapchain->getSwapchainImages();
+        std::vector<std::unique_ptr<IVulkanImage>> const & depthAttachments = swapchain->getDepthAttachments();
+        swapchainImageCount = static_cast<uint32_t>(swapchainImages.size());
+        framebuffers.resize(depthAttachments.size() * swapchainImages.size());
+        for(size_t frame = 0; frame < depthAttachments.size(); frame++)
+        {
+            for(size_t i = 0; i < swapchainImages.size(); i++)
+            {
+                framebuffers[frame * swapchainImages.size() + i] = vulkanFramebufferBuilder
+                    .withAttachment(swapchainImages[i].get(), FrameBufferAttachmentTypes::COLOUR_ATTACHMENT)
+                    .withAttachment(depthAttachments[frame].get(), FrameBufferAttachmentTypes::DEPTH_ATTACHMENT)
+                    .withExtents(renderAreaExtents.width, renderAreaExtents.height)
+                    .withDevice(device)
+                    .withRenderPassHandle(renderPass)
+                    .build();
+            }
+        }
     }
 
      void VulkanRenderPass::end(IVulkanCommandBuffer const * commandBuffer) const
@@ -3,6 +3,8 @@
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanRenderPass.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanFramebuffer.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanSwapchain.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanFramebufferBuilder.hpp"
 
 namespace siofraEngine::systems
 {
@@ -24,10 +26,12 @@ namespace siofraEngine::systems
          * @param renderAreaOffset Vulkan render pass area offset
          * @param renderAreaExtents Vulkan render pass area extents
          * @param clearValues Vulkan render pass clear colours
-         * @param framebuffers Vulkan render pass framebuffers
+         * @param framebuffers Vulkan render pass framebuffers, grouped by frame in flight
+         * @param swapchainImageCount Number of swapchain images, and so framebuffers, per frame in flight
+         * @param stateKey Key identifying the attachments and subpasses which determine render pass compatibility
          * @param device Vulkan device used to create the render pass
          */
-        VulkanRenderPass(VkRenderPass renderPass, VkOffset2D renderAreaOffset, VkExtent2D renderAreaExtents, std::vector<VkClearValue> clearValues, std::vector<std::unique_ptr<IVulkanFramebuffer>> framebuffers, IVulkanDevice const * device);
+        VulkanRenderPass(VkRenderPass renderPass, VkOffset2D renderAreaOffset, VkExtent2D renderAreaExtents, std::vector<VkClearValue> clearValues, std::vector<std::unique_ptr<IVulkanFramebuffer>> framebuffers, uint32_t swapchainImageCount, std::string stateKey, IVulkanDevice const * device);
 
         /**
          * @brief VulkanRenderPass copy constructor
@@ -77,19 +81,68 @@ namespace siofraEngine::systems
         VkRenderPass getRenderPass() const noexcept override;
 
         /**
-         * @brief Get the vulkan render pass framebuffers
+         * @brief Get a key identifying the attachments and subpasses which determine render pass compatibility. Equal keys identify compatible render passes, regardless of handle values
+         * 
+         * @returns The state key
+         */
+        std::string const & getStateKey() const noexcept override;
+
+        /**
+         * @brief Get the vulkan render pass framebuffers. Framebuffers are grouped by frame in flight, each group holding one framebuffer per swapchain image
          * 
          * @returns The vulkan render pass framebuffers
          */
         std::vector<std::unique_ptr<IVulkanFramebuffer>> const & getFramebuffers() const noexcept override;
 
         /**
-         * @brief Begin the render pass
+         * @brief Begin the render pass using the framebuffer pairing a swapchain image with the depth attachment of frame in flight 0.
+         * Deprecated, as every frame in flight then shares one depth attachment. Use the overload taking a frame index instead
          * 
          * @param commandBuffer The command buffer in which to record the command
-         * @param framebufferIndex The framebuffer containing the attachments that are used with the render pass
+         * @param imageIndex Index of the acquired swapchain image
          */
-        void begin(IVulkanCommandBuffer const * commandBuffer, uint32_t framebufferIndex) const override;
+        [[deprecated("Use begin(commandBuffer, imageIndex, frameIndex)")]]
+        void begin(IVulkanCommandBuffer const * commandBuffer, uint32_t imageIndex) const override;
+
+        /**
+         * @brief Begin the render pass using the framebuffer pairing a swapchain image with the depth attachment of frame in flight 0,
+         * specifying how the commands of the first subpass are provided. Deprecated, as every frame in flight then shares one depth attachment.
+         * Use the overload taking a frame index instead
+         * 
+         * @param commandBuffer The command buffer in which to record the command
+         * @param imageIndex Index of the acquired swapchain image
+         * @param contents VK_SUBPASS_CONTENTS_INLINE, or VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS if the subpass is recorded into secondary command buffers
+         */
+        [[deprecated("Use begin(commandBuffer, imageIndex, frameIndex, contents)")]]
+        void begin(IVulkanCommandBuffer const * commandBuffer, uint32_t imageIndex, VkSubpassContents contents) const override;
+
+        /**
+         * @brief Recreate the framebuffers from the images of a recreated swapchain. The previous framebuffers are retired to the swapchain
+         * 
+         * @param swapchain The recreated swapchain
+         * @param vulkanFramebufferBuilder Builder used to create the framebuffers
+         */
+        void recreateFramebuffers(IVulkanSwapchain const * swapchain, IVulkanFramebufferBuilder & vulkanFramebufferBuilder) override;
+
+        /**
+         * @brief Begin the render pass using the framebuffer pairing a swapchain image with the depth attachment of a frame in flight
+         * 
+         * @param commandBuffer The command buffer in which to record the command
+         * @param imageIndex Index of the acquired swapchain image
+         * @param frameIndex Index of the frame in flight being recorded
+         */
+        void begin(IVulkanCommandBuffer const * commandBuffer, uint32_t imageIndex, uint32_t frameIndex) const override;
+
+        /**
+         * @brief Begin the render pass using the framebuffer pairing a swapchain image with the depth attachment of a frame in flight,
+         * specifying how the commands of the first subpass are provided
+         * 
+         * @param commandBuffer The command buffer in which to record the command
+         * @param imageIndex Index of the acquired swapchain image
+         * @param frameIndex Index of the frame in flight being recorded
+         * @param contents VK_SUBPASS_CONTENTS_INLINE, or VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS if the subpass is recorded into secondary command buffers
+         */
+        void begin(IVulkanCommandBuffer const * commandBuffer, uint32_t imageIndex, uint32_t frameIndex, VkSubpassContents contents) const override;
 
         /**
          * @brief End the render pass
@@ -124,6 +177,16 @@ namespace siofraEngine::systems
          */
         std::vector<std::unique_ptr<IVulkanFramebuffer>> framebuffers;
 
+        /**
+         * @brief Number of swapchain images, and so framebuffers, per frame in flight
+         */
+        uint32_t swapchainImageCount{ 0 };
+
+        /**
+         * @brief Key identifying the attachments and subpasses which determine render pass compatibility
+         */
+        std::string stateKey{ };
+
         /**
          * @brief Vulkan device used to create the render pass
          */
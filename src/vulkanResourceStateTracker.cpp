@@ -0,0 +1,247 @@
+#include "systems/renderer/vulkan/vulkanComponents/vulkanResourceStateTracker.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanResourceState VulkanResourceStateTracker::getImageLayoutState(VkImageLayout layout) noexcept
+    {
+        VulkanResourceState state{ };
+        state.layout = layout;
+
+        switch (layout)
+        {
+        case VK_IMAGE_LAYOUT_UNDEFINED:
+            state.accessMask = 0;
+            state.stageMask = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+            break;
+        case VK_IMAGE_LAYOUT_PREINITIALIZED:
+            state.accessMask = VK_ACCESS_HOST_WRITE_BIT;
+            state.stageMask = VK_PIPELINE_STAGE_HOST_BIT;
+            break;
+        case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
+            state.accessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            state.stageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+            break;
+        case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
+            state.accessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            state.stageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+            break;
+        case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
+            state.accessMask = VK_ACCESS_SHADER_READ_BIT;
+            state.stageMask = VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+            break;
+        case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
+            state.accessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+            state.stageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+            break;
+        case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
+            state.accessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+            state.stageMask = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+            break;
+        case VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL:
+            state.accessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+            state.stageMask = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+            break;
+        case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR:
+            state.accessMask = 0;
+            state.stageMask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+            break;
+        default:
+            state.accessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+            state.stageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+            break;
+        }
+
+        return state;
+    }
+
+    void VulkanResourceStateTracker::registerImage(IVulkanImage const * image, VkImageAspectFlags aspectMask, VulkanResourceState const & state)
+    {
+        ImageState & imageState = images[image->getImage()];
+        imageState.aspectMask = aspectMask;
+        imageState.state = toTrackedState(state);
+    }
+
+    void VulkanResourceStateTracker::registerBuffer(IVulkanBuffer const * buffer, VulkanResourceState const & state)
+    {
+        buffers[buffer->getBuffer()] = toTrackedState(state);
+    }
+
+    void VulkanResourceStateTracker::forget(IVulkanImage const * image)
+    {
+        images.erase(image->getImage());
+    }
+
+    void VulkanResourceStateTracker::forget(IVulkanBuffer const * buffer)
+    {
+        buffers.erase(buffer->getBuffer());
+    }
+
+    void VulkanResourceStateTracker::useImage(IVulkanImage const * image, VulkanResourceState const & state)
+    {
+        ImageState & imageState = images[image->getImage()];
+        TrackedState previous = imageState.state;
+
+        Transition barrier{ };
+        if (!transition(imageState.state, state, previous.layout != state.layout, barrier))
+        {
+            return;
+        }
+
+        bool ownershipTransfer = previous.queueFamilyIndex != VK_QUEUE_FAMILY_IGNORED && previous.queueFamilyIndex != imageState.state.queueFamilyIndex;
+
+        VkImageMemoryBarrier2 imageMemoryBarrier{ };
+        imageMemoryBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+        imageMemoryBarrier.srcStageMask = barrier.srcStageMask;
+        imageMemoryBarrier.dstStageMask = state.stageMask;
+        imageMemoryBarrier.srcAccessMask = barrier.srcAccessMask;
+        imageMemoryBarrier.dstAccessMask = barrier.dstAccessMask;
+        imageMemoryBarrier.oldLayout = previous.layout;
+        imageMemoryBarrier.newLayout = state.layout;
+        imageMemoryBarrier.srcQueueFamilyIndex = ownershipTransfer ? previous.queueFamilyIndex : VK_QUEUE_FAMILY_IGNORED;
+        imageMemoryBarrier.dstQueueFamilyIndex = ownershipTransfer ? state.queueFamilyIndex : VK_QUEUE_FAMILY_IGNORED;
+        imageMemoryBarrier.image = image->getImage();
+        imageMemoryBarrier.subresourceRange.aspectMask = imageState.aspectMask;
+        imageMemoryBarrier.subresourceRange.baseMipLevel = 0;
+        imageMemoryBarrier.subresourceRange.levelCount = VK_REMAINING_MIP_LEVELS;
+        imageMemoryBarrier.subresourceRange.baseArrayLayer = 0;
+        imageMemoryBarrier.subresourceRange.layerCount = VK_REMAINING_ARRAY_LAYERS;
+        imageBarriers.push_back(imageMemoryBarrier);
+    }
+
+    void VulkanResourceStateTracker::useBuffer(IVulkanBuffer const * buffer, VulkanResourceState const & state)
+    {
+        auto trackedBuffer = buffers.find(buffer->getBuffer());
+        if (trackedBuffer == buffers.end())
+        {
+            buffers.emplace(buffer->getBuffer(), toTrackedState(state));
+            return;
+        }
+
+        TrackedState previous = trackedBuffer->second;
+
+        Transition barrier{ };
+        if (!transition(trackedBuffer->second, state, false, barrier))
+        {
+            return;
+        }
+
+        bool ownershipTransfer = previous.queueFamilyIndex != VK_QUEUE_FAMILY_IGNORED && previous.queueFamilyIndex != trackedBuffer->second.queueFamilyIndex;
+
+        VkBufferMemoryBarrier2 bufferMemoryBarrier{ };
+        bufferMemoryBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2;
+        bufferMemoryBarrier.srcStageMask = barrier.srcStageMask;
+        bufferMemoryBarrier.dstStageMask = state.stageMask;
+        bufferMemoryBarrier.srcAccessMask = barrier.srcAccessMask;
+        bufferMemoryBarrier.dstAccessMask = barrier.dstAccessMask;
+        bufferMemoryBarrier.srcQueueFamilyIndex = ownershipTransfer ? previous.queueFamilyIndex : VK_QUEUE_FAMILY_IGNORED;
+        bufferMemoryBarrier.dstQueueFamilyIndex = ownershipTransfer ? state.queueFamilyIndex : VK_QUEUE_FAMILY_IGNORED;
+        bufferMemoryBarrier.buffer = buffer->getBuffer();
+        bufferMemoryBarrier.offset = 0;
+        bufferMemoryBarrier.size = VK_WHOLE_SIZE;
+        bufferBarriers.push_back(bufferMemoryBarrier);
+    }
+
+    bool VulkanResourceStateTracker::hasPendingBarriers() const noexcept
+    {
+        return srcStageMask != 0 || !imageBarriers.empty() || !bufferBarriers.empty();
+    }
+
+    void VulkanResourceStateTracker::flush(IVulkanCommandBuffer const * commandBuffer)
+    {
+        if (!hasPendingBarriers())
+        {
+            return;
+        }
+
+        VulkanBarrierBatch & barrierBatch = commandBuffer->getBarrierBatch();
+        if (srcStageMask != 0)
+        {
+            barrierBatch.addExecutionDependency(srcStageMask, dstStageMask);
+        }
+        for (auto const & bufferBarrier : bufferBarriers)
+        {
+            barrierBatch.addBufferBarrier(bufferBarrier);
+        }
+        for (auto const & imageBarrier : imageBarriers)
+        {
+            barrierBatch.addImageBarrier(imageBarrier);
+        }
+
+        imageBarriers.clear();
+        bufferBarriers.clear();
+        srcStageMask = 0;
+        dstStageMask = 0;
+
+        // Record now rather than at the next boundary, copies and clears are often recorded on the raw handle
+        commandBuffer->flushBarriers();
+    }
+
+    VulkanResourceStateTracker::TrackedState VulkanResourceStateTracker::toTrackedState(VulkanResourceState const & state) noexcept
+    {
+        VkAccessFlags writes = state.accessMask & writeAccessMask;
+
+        TrackedState trackedState{ };
+        trackedState.layout = state.layout;
+        trackedState.writeStageMask = state.stageMask;
+        trackedState.writeAccessMask = writes;
+        trackedState.visibleStageMask = writes == 0 ? state.stageMask : 0;
+        trackedState.visibleAccessMask = writes == 0 ? state.accessMask : 0;
+        trackedState.readStageMask = writes == 0 ? state.stageMask : 0;
+        trackedState.queueFamilyIndex = state.queueFamilyIndex;
+        return trackedState;
+    }
+
+    bool VulkanResourceStateTracker::transition(TrackedState & current, VulkanResourceState const & next, bool layoutChange, Transition & barrier)
+    {
+        bool ownershipTransfer = current.queueFamilyIndex != VK_QUEUE_FAMILY_IGNORED && next.queueFamilyIndex != VK_QUEUE_FAMILY_IGNORED && current.queueFamilyIndex != next.queueFamilyIndex;
+        VkAccessFlags nextWrites = next.accessMask & writeAccessMask;
+        VkAccessFlags nextReads = next.accessMask & ~writeAccessMask;
+
+        if (!layoutChange && !ownershipTransfer && nextWrites == 0)
+        {
+            bool covered = (next.stageMask & ~current.visibleStageMask) == 0 && (nextReads & ~current.visibleAccessMask) == 0;
+            current.readStageMask |= next.stageMask;
+            if (nextReads == 0 || covered)
+            {
+                // The last write is already visible to this read, and reads need no ordering between each other
+                return false;
+            }
+
+            // Make the last write visible to the new reader
+            barrier.srcStageMask = current.writeStageMask;
+            barrier.srcAccessMask = current.writeAccessMask;
+            barrier.dstAccessMask = nextReads;
+            current.visibleStageMask |= next.stageMask;
+            current.visibleAccessMask |= nextReads;
+            return true;
+        }
+
+        // Write after read without a layout or ownership change only needs an execution dependency on the readers
+        bool memoryBarrier = layoutChange || ownershipTransfer || current.writeAccessMask != 0;
+        if (memoryBarrier)
+        {
+            barrier.srcStageMask = current.writeStageMask | current.readStageMask;
+            barrier.srcAccessMask = current.writeAccessMask;
+            barrier.dstAccessMask = next.accessMask;
+        }
+        else
+        {
+            srcStageMask |= current.writeStageMask | current.readStageMask;
+            dstStageMask |= next.stageMask;
+        }
+
+        // The new use becomes the last write. A layout transition or ownership transfer is ordered before it and visible to it
+        current.layout = next.layout;
+        current.writeStageMask = next.stageMask;
+        current.writeAccessMask = nextWrites;
+        current.visibleStageMask = nextWrites == 0 ? next.stageMask : 0;
+        current.visibleAccessMask = nextWrites == 0 ? nextReads : 0;
+        current.readStageMask = nextWrites == 0 ? next.stageMask : 0;
+        if (next.queueFamilyIndex != VK_QUEUE_FAMILY_IGNORED)
+        {
+            current.queueFamilyIndex = next.queueFamilyIndex;
+        }
+
+        return memoryBarrier;
+    }
+}
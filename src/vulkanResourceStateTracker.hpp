@@ -0,0 +1,254 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanBuffer.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanImage.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanCommandBuffer.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/vulkanBarrierBatch.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief The way a resource was last used, or is about to be used
+     */
+    struct VulkanResourceState
+    {
+        /**
+         * @brief The image layout. Ignored for buffers
+         */
+        VkImageLayout layout{ VK_IMAGE_LAYOUT_UNDEFINED };
+
+        /**
+         * @brief The memory accesses performed
+         */
+        VkAccessFlags accessMask{ 0 };
+
+        /**
+         * @brief The pipeline stages performing the accesses
+         */
+        VkPipelineStageFlags stageMask{ VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT };
+
+        /**
+         * @brief The queue family owning the resource, or VK_QUEUE_FAMILY_IGNORED if ownership is not tracked
+         */
+        uint32_t queueFamilyIndex{ VK_QUEUE_FAMILY_IGNORED };
+    };
+
+    /**
+     * @brief Tracks the state of images and buffers and generates the minimal barriers required when they are used for a new purpose.
+     * The last write to each resource is tracked along with the stages and accesses it has been made visible to, so a read only
+     * skips its barrier when an earlier barrier already covers it. The barriers are collected until flushed into the barrier batch
+     * of a command buffer. Uses of the same resource must be separated by a flush
+     */
+    class VulkanResourceStateTracker
+    {
+    public:
+        /**
+         * @brief Get the accesses and stages typically associated with an image layout
+         *
+         * @param layout The image layout
+         * @returns The image state
+         */
+        static VulkanResourceState getImageLayoutState(VkImageLayout layout) noexcept;
+
+        /**
+         * @brief Start tracking an image in a known state. Untracked images are assumed to be color images in an undefined layout
+         *
+         * @param image The image to track
+         * @param aspectMask The image aspects covered by barriers
+         * @param state The current image state
+         */
+        void registerImage(IVulkanImage const * image, VkImageAspectFlags aspectMask, VulkanResourceState const & state);
+
+        /**
+         * @brief Start tracking a buffer in a known state. The first use of an untracked buffer requires no barrier
+         *
+         * @param buffer The buffer to track
+         * @param state The current buffer state
+         */
+        void registerBuffer(IVulkanBuffer const * buffer, VulkanResourceState const & state);
+
+        /**
+         * @brief Stop tracking a resource, for example before it is destroyed
+         *
+         * @param image The image to stop tracking
+         */
+        void forget(IVulkanImage const * image);
+
+        /**
+         * @brief Stop tracking a resource, for example before it is destroyed
+         *
+         * @param buffer The buffer to stop tracking
+         */
+        void forget(IVulkanBuffer const * buffer);
+
+        /**
+         * @brief Declare the next use of an image, collecting any barrier it requires
+         *
+         * @param image The image
+         * @param state The state the image is used in. A queue family differing from the owning queue family records the acquire half of an ownership transfer
+         */
+        void useImage(IVulkanImage const * image, VulkanResourceState const & state);
+
+        /**
+         * @brief Declare the next use of a buffer, collecting any barrier it requires
+         *
+         * @param buffer The buffer
+         * @param state The state the buffer is used in. The layout is ignored. A queue family differing from the owning queue family records the acquire half of an ownership transfer
+         */
+        void useBuffer(IVulkanBuffer const * buffer, VulkanResourceState const & state);
+
+        /**
+         * @brief Check if any barriers are waiting to be flushed
+         *
+         * @returns True if there are pending barriers, otherwise false
+         */
+        bool hasPendingBarriers() const noexcept;
+
+        /**
+         * @brief Record the pending barriers into a command buffer with a single pipeline barrier command, together with any barriers
+         * already waiting in its barrier batch. Commands recorded directly on the command buffer handle afterwards are ordered after
+         * the barriers. Does nothing if there are none. Must be called outside of a render pass instance
+         *
+         * @param commandBuffer The command buffer to record into
+         */
+        void flush(IVulkanCommandBuffer const * commandBuffer);
+
+    private:
+        /**
+         * @brief Access flags which write memory
+         */
+        static constexpr VkAccessFlags writeAccessMask{
+            VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
+            VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_HOST_WRITE_BIT | VK_ACCESS_MEMORY_WRITE_BIT };
+
+        /**
+         * @brief Tracked resource state
+         */
+        struct TrackedState
+        {
+            /**
+             * @brief The image layout. Ignored for buffers
+             */
+            VkImageLayout layout{ VK_IMAGE_LAYOUT_UNDEFINED };
+
+            /**
+             * @brief The stages of the last write, or of the last use a layout transition or ownership transfer was ordered before
+             */
+            VkPipelineStageFlags writeStageMask{ VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT };
+
+            /**
+             * @brief The accesses of the last write
+             */
+            VkAccessFlags writeAccessMask{ 0 };
+
+            /**
+             * @brief The stages the last write has been made visible to
+             */
+            VkPipelineStageFlags visibleStageMask{ 0 };
+
+            /**
+             * @brief The accesses the last write has been made visible to
+             */
+            VkAccessFlags visibleAccessMask{ 0 };
+
+            /**
+             * @brief The stages which have read the resource since the last write
+             */
+            VkPipelineStageFlags readStageMask{ 0 };
+
+            /**
+             * @brief The queue family owning the resource, or VK_QUEUE_FAMILY_IGNORED if ownership is not tracked
+             */
+            uint32_t queueFamilyIndex{ VK_QUEUE_FAMILY_IGNORED };
+        };
+
+        /**
+         * @brief A barrier required by a new use of a resource
+         */
+        struct Transition
+        {
+            /**
+             * @brief The stages which must complete before the barrier
+             */
+            VkPipelineStageFlags srcStageMask{ 0 };
+
+            /**
+             * @brief The accesses made available by the barrier
+             */
+            VkAccessFlags srcAccessMask{ 0 };
+
+            /**
+             * @brief The accesses made visible by the barrier
+             */
+            VkAccessFlags dstAccessMask{ 0 };
+        };
+
+        /**
+         * @brief Tracked image state
+         */
+        struct ImageState
+        {
+            /**
+             * @brief The image aspects covered by barriers
+             */
+            VkImageAspectFlags aspectMask{ VK_IMAGE_ASPECT_COLOR_BIT };
+
+            /**
+             * @brief The current image state
+             */
+            TrackedState state{ };
+        };
+
+        /**
+         * @brief Tracked images
+         */
+        std::unordered_map<VkImage, ImageState> images{ };
+
+        /**
+         * @brief Tracked buffers
+         */
+        std::unordered_map<VkBuffer, TrackedState> buffers{ };
+
+        /**
+         * @brief Pending image barriers
+         */
+        std::vector<VkImageMemoryBarrier2> imageBarriers{ };
+
+        /**
+         * @brief Pending buffer barriers
+         */
+        std::vector<VkBufferMemoryBarrier2> bufferBarriers{ };
+
+        /**
+         * @brief Union of the source stages of the pending execution dependencies
+         */
+        VkPipelineStageFlags srcStageMask{ 0 };
+
+        /**
+         * @brief Union of the destination stages of the pending execution dependencies
+         */
+        VkPipelineStageFlags dstStageMask{ 0 };
+
+        /**
+         * @brief Convert a known resource state to a tracked state. Writes in the state are treated as not yet visible to any stage,
+         * reads are treated as having the previous writes visible to them
+         *
+         * @param state The known resource state
+         * @returns The tracked state
+         */
+        static TrackedState toTrackedState(VulkanResourceState const & state) noexcept;
+
+        /**
+         * @brief Update a tracked state for a new use and determine the barrier it requires
+         *
+         * @param current The tracked state, updated to reflect the new use
+         * @param next The state of the new use
+         * @param layoutChange Indicates if the use changes the image layout
+         * @param barrier The memory barrier to be populated
+         * @returns True if a memory barrier is required, otherwise false. Execution dependencies are accumulated by the tracker
+         */
+        bool transition(TrackedState & current, VulkanResourceState const & next, bool layoutChange, Transition & barrier);
+    };
+}
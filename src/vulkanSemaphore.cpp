@@ -2,8 +2,9 @@
 
 namespace siofraEngine::systems
 {
-    VulkanSemaphore::VulkanSemaphore(VkSemaphore semaphore, IVulkanDevice const * device) :
+    VulkanSemaphore::VulkanSemaphore(VkSemaphore semaphore, VkSemaphoreType type, IVulkanDevice const * device) :
         semaphore{semaphore},
+        type{type},
         device{device}
     {
         
@@ -11,6 +12,7 @@ namespace siofraEngine::systems
 
     VulkanSemaphore::VulkanSemaphore(VulkanSemaphore &&other) noexcept :
         semaphore{other.semaphore},
+        type{other.type},
         device{other.device}
     {
         other.semaphore = VK_NULL_HANDLE;
@@ -25,6 +27,7 @@ namespace siofraEngine::systems
     VulkanSemaphore& VulkanSemaphore::operator=(VulkanSemaphore &&other) noexcept
     {
         semaphore = other.semaphore;
+        type = other.type;
         device = other.device;
         other.semaphore = VK_NULL_HANDLE;
         other.device = nullptr;
@@ -40,4 +43,47 @@ namespace siofraEngine::systems
     {
         return semaphore;
     }
+
+    VkSemaphoreType VulkanSemaphore::getType() const noexcept
+    {
+        return type;
+    }
+
+    void VulkanSemaphore::signal(uint64_t value) const
+    {
+        VkSemaphoreSignalInfo semaphoreSignalInfo{ };
+        semaphoreSignalInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO;
+        semaphoreSignalInfo.semaphore = semaphore;
+        semaphoreSignalInfo.value = value;
+
+        if (type != VK_SEMAPHORE_TYPE_TIMELINE || vkSignalSemaphore(device->getLogicalDevice(), &semaphoreSignalInfo) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to signal semaphore");
+        }
+    }
+
+    void VulkanSemaphore::wait(uint64_t value) const
+    {
+        VkSemaphoreWaitInfo semaphoreWaitInfo{ };
+        semaphoreWaitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+        semaphoreWaitInfo.pSemaphores = &semaphore;
+        semaphoreWaitInfo.pValues = &value;
+        semaphoreWaitInfo.semaphoreCount = 1;
+
+        if (type != VK_SEMAPHORE_TYPE_TIMELINE || vkWaitSemaphores(device->getLogicalDevice(), &semaphoreWaitInfo, std::numeric_limits<uint64_t>::max()) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to wait for semaphore");
+        }
+    }
+
+    uint64_t VulkanSemaphore::getCounterValue() const
+    {
+        uint64_t value{ 0 };
+        if (type != VK_SEMAPHORE_TYPE_TIMELINE || vkGetSemaphoreCounterValue(device->getLogicalDevice(), semaphore, &value) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to get semaphore counter value");
+        }
+
+        return value;
+    }
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <limits>
+#include <stdexcept>
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanSemaphore.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
 
@@ -20,9 +22,10 @@ namespace siofraEngine::systems
          * @brief VulkanSemaphore constructor
          * 
          * @param semaphore Vulkan semaphore handle
+         * @param type The semaphore type
          * @param device Vulkan device used to create the semaphore
          */
-        VulkanSemaphore(VkSemaphore semaphore, IVulkanDevice const * device);
+        VulkanSemaphore(VkSemaphore semaphore, VkSemaphoreType type, IVulkanDevice const * device);
 
         /**
          * @brief VulkanSemaphore copy constructor
@@ -71,12 +74,45 @@ namespace siofraEngine::systems
          */
         VkSemaphore getSemaphore() const noexcept override;
 
+        /**
+         * @brief Get the semaphore type
+         * 
+         * @returns The semaphore type
+         */
+        VkSemaphoreType getType() const noexcept override;
+
+        /**
+         * @brief Set the counter of a timeline semaphore from the host
+         * 
+         * @param value The new counter value, which must be greater than the current value
+         */
+        void signal(uint64_t value) const override;
+
+        /**
+         * @brief Block until the counter of a timeline semaphore reaches a value
+         * 
+         * @param value The counter value to wait for
+         */
+        void wait(uint64_t value) const override;
+
+        /**
+         * @brief Get the current counter value of a timeline semaphore
+         * 
+         * @returns The current counter value
+         */
+        uint64_t getCounterValue() const override;
+
     private:
         /**
          * @brief Vulkan semaphore handle
          */
         VkSemaphore semaphore{ VK_NULL_HANDLE };
 
+        /**
+         * @brief The semaphore type
+         */
+        VkSemaphoreType type{ VK_SEMAPHORE_TYPE_BINARY };
+
         /**
          * @brief Vulkan device used to create the semaphore
          */
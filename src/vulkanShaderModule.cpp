@@ -2,8 +2,9 @@
 
 namespace siofraEngine::systems
 {
-    VulkanShaderModule::VulkanShaderModule(VkShaderModule shaderModule, IVulkanDevice const * device) :
+    VulkanShaderModule::VulkanShaderModule(VkShaderModule shaderModule, std::string stateKey, IVulkanDevice const * device) :
         shaderModule{shaderModule},
+        stateKey{std::move(stateKey)},
         device{device}
     {
 
@@ -11,6 +12,7 @@ namespace siofraEngine::systems
 
     VulkanShaderModule::VulkanShaderModule(VulkanShaderModule &&other) noexcept :
         shaderModule{other.shaderModule},
+        stateKey{std::move(other.stateKey)},
         device{other.device}
     {
         other.shaderModule = VK_NULL_HANDLE;
@@ -25,6 +27,7 @@ namespace siofraEngine::systems
     VulkanShaderModule& VulkanShaderModule::operator=(VulkanShaderModule &&other) noexcept
     {
         shaderModule = other.shaderModule;
+        stateKey = std::move(other.stateKey);
         device = other.device;
         other.shaderModule = VK_NULL_HANDLE;
         other.device = nullptr;
@@ -40,4 +43,9 @@ namespace siofraEngine::systems
     {
         return shaderModule;
     }
+
+    std::string const & VulkanShaderModule::getStateKey() const noexcept
+    {
+        return stateKey;
+    }
 }
@@ -20,9 +20,10 @@ namespace siofraEngine::systems
          * @brief VulkanShaderModule constructor
          * 
          * @param shaderModule Vulkan shader module handle
+         * @param stateKey Key identifying the shader code
          * @param device Vulkan device used to create the shader module
          */
-        VulkanShaderModule(VkShaderModule shaderModule, IVulkanDevice const * device);
+        VulkanShaderModule(VkShaderModule shaderModule, std::string stateKey, IVulkanDevice const * device);
 
         /**
          * @brief VulkanShaderModule copy constructor
@@ -71,12 +72,24 @@ namespace siofraEngine::systems
          */
         VkShaderModule getShaderModule() const noexcept override;
 
+        /**
+         * @brief Get a key identifying the shader code, made of its bytes. Equal keys identify interchangeable shader modules, regardless of handle values
+         * 
+         * @returns The state key
+         */
+        std::string const & getStateKey() const noexcept override;
+
     private:
         /**
          * @brief Vulkan shader module handle
          */
         VkShaderModule shaderModule{ VK_NULL_HANDLE };
 
+        /**
+         * @brief Key identifying the shader code
+         */
+        std::string stateKey{ };
+
         /**
          * @brief Vulkan device used to create the shader module
          */
@@ -0,0 +1,44 @@
+#include "systems/renderer/vulkan/vulkanComponents/vulkanSpecializationConstants.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanSpecializationConstants& VulkanSpecializationConstants::add(uint32_t constantId, void const * value, size_t size)
+    {
+        VkSpecializationMapEntry mapEntry{ };
+        mapEntry.constantID = constantId;
+        mapEntry.offset = static_cast<uint32_t>(data.size());
+        mapEntry.size = size;
+        mapEntries.push_back(mapEntry);
+
+        data.resize(data.size() + size);
+        std::memcpy(data.data() + mapEntry.offset, value, size);
+        return *this;
+    }
+
+    bool VulkanSpecializationConstants::empty() const noexcept
+    {
+        return mapEntries.empty();
+    }
+
+    VkSpecializationInfo VulkanSpecializationConstants::getSpecializationInfo() const noexcept
+    {
+        VkSpecializationInfo specializationInfo{ };
+        specializationInfo.mapEntryCount = static_cast<uint32_t>(mapEntries.size());
+        specializationInfo.pMapEntries = mapEntries.data();
+        specializationInfo.dataSize = data.size();
+        specializationInfo.pData = data.data();
+        return specializationInfo;
+    }
+
+    void VulkanSpecializationConstants::appendStateKey(std::string & stateKey) const
+    {
+        uint32_t mapEntryCount = static_cast<uint32_t>(mapEntries.size());
+        stateKey.append(reinterpret_cast<char const *>(&mapEntryCount), sizeof(mapEntryCount));
+        for (auto const & mapEntry : mapEntries)
+        {
+            stateKey.append(reinterpret_cast<char const *>(&mapEntry.constantID), sizeof(mapEntry.constantID));
+            stateKey.append(reinterpret_cast<char const *>(&mapEntry.size), sizeof(mapEntry.size));
+        }
+        stateKey.append(reinterpret_cast<char const *>(data.data()), data.size());
+    }
+}
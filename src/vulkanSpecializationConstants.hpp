@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanComponent.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Collects shader specialization constant values for a pipeline shader stage
+     */
+    class VulkanSpecializationConstants
+    {
+    public:
+        /**
+         * @brief Add a specialization constant value
+         * 
+         * @param constantId The specialization constant ID declared in the shader
+         * @param value Pointer to the constant value
+         * @param size Size of the constant value in bytes. Boolean constants are 4 byte VkBool32 values
+         * @returns Reference to the specialization constants
+         */
+        VulkanSpecializationConstants& add(uint32_t constantId, void const * value, size_t size);
+
+        /**
+         * @brief Add a specialization constant value
+         * 
+         * @param constantId The specialization constant ID declared in the shader
+         * @param value The constant value. Boolean constants must be passed as VkBool32
+         * @returns Reference to the specialization constants
+         */
+        template<typename T>
+        VulkanSpecializationConstants& add(uint32_t constantId, T const & value)
+        {
+            return add(constantId, &value, sizeof(T));
+        }
+
+        /**
+         * @brief Check if any constants have been added
+         * 
+         * @returns True if no constants have been added, otherwise false
+         */
+        bool empty() const noexcept;
+
+        /**
+         * @brief Get the specialization info describing the constants. It references storage owned by this object
+         * and is invalidated when constants are added
+         * 
+         * @returns The specialization info
+         */
+        VkSpecializationInfo getSpecializationInfo() const noexcept;
+
+        /**
+         * @brief Append the constant IDs, sizes and values to a pipeline state key
+         * 
+         * @param stateKey The state key to append to
+         */
+        void appendStateKey(std::string & stateKey) const;
+
+    private:
+        /**
+         * @brief Location of each constant within the data
+         */
+        std::vector<VkSpecializationMapEntry> mapEntries{ };
+
+        /**
+         * @brief The packed constant values
+         */
+        std::vector<uint8_t> data{ };
+    };
+}
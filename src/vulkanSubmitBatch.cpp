@@ -0,0 +1,156 @@
+#include "systems/renderer/vulkan/vulkanComponents/vulkanSubmitBatch.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanSubmitBatch& VulkanSubmitBatch::addSubmission()
+    {
+        if (submissionCount == submissions.size())
+        {
+            submissions.emplace_back();
+        }
+
+        Submission & submission = submissions[submissionCount++];
+        submission.waitSemaphores.clear();
+        submission.waitStages.clear();
+        submission.waitValues.clear();
+        submission.commandBuffers.clear();
+        submission.signalSemaphores.clear();
+        submission.signalValues.clear();
+        submission.timeline = false;
+
+        return *this;
+    }
+
+    VulkanSubmitBatch& VulkanSubmitBatch::addWaitSemaphore(IVulkanSemaphore const * semaphore, VkPipelineStageFlags2 waitStage, uint64_t value)
+    {
+        Submission & submission = currentSubmission();
+        submission.waitSemaphores.push_back(semaphore->getSemaphore());
+        submission.waitStages.push_back(waitStage);
+        submission.waitValues.push_back(value);
+        submission.timeline |= semaphore->getType() == VK_SEMAPHORE_TYPE_TIMELINE;
+        return *this;
+    }
+
+    VulkanSubmitBatch& VulkanSubmitBatch::addCommandBuffer(IVulkanCommandBuffer const * commandBuffer)
+    {
+        currentSubmission().commandBuffers.push_back(commandBuffer->getCommandBuffer());
+        return *this;
+    }
+
+    VulkanSubmitBatch& VulkanSubmitBatch::addSignalSemaphore(IVulkanSemaphore const * semaphore, uint64_t value)
+    {
+        Submission & submission = currentSubmission();
+        submission.signalSemaphores.push_back(semaphore->getSemaphore());
+        submission.signalValues.push_back(value);
+        submission.timeline |= semaphore->getType() == VK_SEMAPHORE_TYPE_TIMELINE;
+        return *this;
+    }
+
+    void VulkanSubmitBatch::clear() noexcept
+    {
+        submissionCount = 0;
+    }
+
+    bool VulkanSubmitBatch::empty() const noexcept
+    {
+        return submissionCount == 0;
+    }
+
+    std::vector<VkSubmitInfo> const & VulkanSubmitBatch::getSubmitInfos() const
+    {
+        submitInfos.resize(submissionCount);
+        for (size_t i = 0; i < submissionCount; ++i)
+        {
+            // The timeline info lives in the batch so its address stays valid after this returns
+            Submission const & submission = submissions[i];
+            VkTimelineSemaphoreSubmitInfo & timelineSemaphoreSubmitInfo = submission.timelineSemaphoreSubmitInfo;
+            timelineSemaphoreSubmitInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+            timelineSemaphoreSubmitInfo.pWaitSemaphoreValues = submission.waitValues.data();
+            timelineSemaphoreSubmitInfo.waitSemaphoreValueCount = static_cast<uint32_t>(submission.waitValues.size());
+            timelineSemaphoreSubmitInfo.pSignalSemaphoreValues = submission.signalValues.data();
+            timelineSemaphoreSubmitInfo.signalSemaphoreValueCount = static_cast<uint32_t>(submission.signalValues.size());
+
+            submission.legacyWaitStages.clear();
+            for (auto waitStage : submission.waitStages)
+            {
+                submission.legacyWaitStages.push_back(VulkanBarrierBatch::toLegacyStageMask(waitStage));
+            }
+
+            VkSubmitInfo & submitInfo = submitInfos[i];
+            submitInfo = { };
+            submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.pNext = submission.timeline ? &submission.timelineSemaphoreSubmitInfo : nullptr;
+            submitInfo.pWaitSemaphores = submission.waitSemaphores.data();
+            submitInfo.pWaitDstStageMask = submission.legacyWaitStages.data();
+            submitInfo.waitSemaphoreCount = static_cast<uint32_t>(submission.waitSemaphores.size());
+            submitInfo.pCommandBuffers = submission.commandBuffers.data();
+            submitInfo.commandBufferCount = static_cast<uint32_t>(submission.commandBuffers.size());
+            submitInfo.pSignalSemaphores = submission.signalSemaphores.data();
+            submitInfo.signalSemaphoreCount = static_cast<uint32_t>(submission.signalSemaphores.size());
+        }
+
+        return submitInfos;
+    }
+
+    std::vector<VkSubmitInfo2> const & VulkanSubmitBatch::getSubmitInfos2() const
+    {
+        submitInfos2.resize(submissionCount);
+        for (size_t i = 0; i < submissionCount; ++i)
+        {
+            // Semaphore values and stages are carried per semaphore, so no timeline info is chained
+            Submission const & submission = submissions[i];
+            submission.waitSemaphoreInfos.resize(submission.waitSemaphores.size());
+            for (size_t j = 0; j < submission.waitSemaphores.size(); ++j)
+            {
+                VkSemaphoreSubmitInfo & waitSemaphoreInfo = submission.waitSemaphoreInfos[j];
+                waitSemaphoreInfo = { };
+                waitSemaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+                waitSemaphoreInfo.semaphore = submission.waitSemaphores[j];
+                waitSemaphoreInfo.value = submission.waitValues[j];
+                waitSemaphoreInfo.stageMask = submission.waitStages[j];
+            }
+
+            submission.commandBufferInfos.resize(submission.commandBuffers.size());
+            for (size_t j = 0; j < submission.commandBuffers.size(); ++j)
+            {
+                VkCommandBufferSubmitInfo & commandBufferInfo = submission.commandBufferInfos[j];
+                commandBufferInfo = { };
+                commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+                commandBufferInfo.commandBuffer = submission.commandBuffers[j];
+            }
+
+            submission.signalSemaphoreInfos.resize(submission.signalSemaphores.size());
+            for (size_t j = 0; j < submission.signalSemaphores.size(); ++j)
+            {
+                VkSemaphoreSubmitInfo & signalSemaphoreInfo = submission.signalSemaphoreInfos[j];
+                signalSemaphoreInfo = { };
+                signalSemaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+                signalSemaphoreInfo.semaphore = submission.signalSemaphores[j];
+                signalSemaphoreInfo.value = submission.signalValues[j];
+                signalSemaphoreInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+            }
+
+            VkSubmitInfo2 & submitInfo = submitInfos2[i];
+            submitInfo = { };
+            submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
+            submitInfo.pWaitSemaphoreInfos = submission.waitSemaphoreInfos.data();
+            submitInfo.waitSemaphoreInfoCount = static_cast<uint32_t>(submission.waitSemaphoreInfos.size());
+            submitInfo.pCommandBufferInfos = submission.commandBufferInfos.data();
+            submitInfo.commandBufferInfoCount = static_cast<uint32_t>(submission.commandBufferInfos.size());
+            submitInfo.pSignalSemaphoreInfos = submission.signalSemaphoreInfos.data();
+            submitInfo.signalSemaphoreInfoCount = static_cast<uint32_t>(submission.signalSemaphoreInfos.size());
+        }
+
+        return submitInfos2;
+    }
+
+    VulkanSubmitBatch::Submission & VulkanSubmitBatch::currentSubmission()
+    {
+        if (submissionCount == 0)
+        {
+            addSubmission();
+        }
+
+        return submissions[submissionCount - 1];
+    }
+}
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <vector>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanSemaphore.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanCommandBuffer.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/vulkanBarrierBatch.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Accumulates queue submissions so they can be flushed with a single queue submit call
+     */
+    class VulkanSubmitBatch
+    {
+    public:
+        /**
+         * @brief Begin a new submission. Subsequent waits, command buffers and signals are added to it
+         * 
+         * @returns Reference to the batch
+         */
+        VulkanSubmitBatch& addSubmission();
+
+        /**
+         * @brief Add a semaphore for the current submission to wait on
+         * 
+         * @param semaphore The semaphore to wait on
+         * @param waitStage Pipeline stages at which the wait occurs. Stages without a legacy equivalent are widened for legacy submit infos
+         * @param value Counter value to wait for if the semaphore is a timeline semaphore, otherwise ignored
+         * @returns Reference to the batch
+         */
+        VulkanSubmitBatch& addWaitSemaphore(IVulkanSemaphore const * semaphore, VkPipelineStageFlags2 waitStage, uint64_t value);
+
+        /**
+         * @brief Add a command buffer to the current submission
+         * 
+         * @param commandBuffer The command buffer to execute
+         * @returns Reference to the batch
+         */
+        VulkanSubmitBatch& addCommandBuffer(IVulkanCommandBuffer const * commandBuffer);
+
+        /**
+         * @brief Add a semaphore for the current submission to signal once its command buffers complete
+         * 
+         * @param semaphore The semaphore to signal
+         * @param value Counter value to signal if the semaphore is a timeline semaphore, otherwise ignored
+         * @returns Reference to the batch
+         */
+        VulkanSubmitBatch& addSignalSemaphore(IVulkanSemaphore const * semaphore, uint64_t value);
+
+        /**
+         * @brief Remove all submissions. Allocated storage is kept for reuse
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Check if the batch contains any submissions
+         * 
+         * @returns True if the batch contains no submissions, otherwise false
+         */
+        bool empty() const noexcept;
+
+        /**
+         * @brief Get the submit infos describing the batch. They are resolved into storage owned by the batch,
+         * which is reused between calls, and are invalidated when the batch is modified
+         * 
+         * @returns The submit infos, one per submission
+         */
+        std::vector<VkSubmitInfo> const & getSubmitInfos() const;
+
+        /**
+         * @brief Get the synchronization2 submit infos describing the batch. They are resolved into storage owned by the batch,
+         * which is reused between calls, and are invalidated when the batch is modified
+         * 
+         * @returns The submit infos, one per submission
+         */
+        std::vector<VkSubmitInfo2> const & getSubmitInfos2() const;
+
+    private:
+        /**
+         * @brief The contents of a single submit info
+         */
+        struct Submission
+        {
+            /**
+             * @brief Semaphores to wait on
+             */
+            std::vector<VkSemaphore> waitSemaphores{ };
+
+            /**
+             * @brief Pipeline stages at which each wait occurs
+             */
+            std::vector<VkPipelineStageFlags2> waitStages{ };
+
+            /**
+             * @brief Wait stages converted for legacy submit infos
+             */
+            mutable std::vector<VkPipelineStageFlags> legacyWaitStages{ };
+
+            /**
+             * @brief Timeline counter values to wait for
+             */
+            std::vector<uint64_t> waitValues{ };
+
+            /**
+             * @brief Command buffers to execute
+             */
+            std::vector<VkCommandBuffer> commandBuffers{ };
+
+            /**
+             * @brief Semaphores to signal
+             */
+            std::vector<VkSemaphore> signalSemaphores{ };
+
+            /**
+             * @brief Timeline counter values to signal
+             */
+            std::vector<uint64_t> signalValues{ };
+
+            /**
+             * @brief Indicates if any of the semaphores are timeline semaphores
+             */
+            bool timeline{ false };
+
+            /**
+             * @brief Timeline values chained to the submit info when required
+             */
+            mutable VkTimelineSemaphoreSubmitInfo timelineSemaphoreSubmitInfo{ };
+
+            /**
+             * @brief Wait semaphore infos for synchronization2 submit infos
+             */
+            mutable std::vector<VkSemaphoreSubmitInfo> waitSemaphoreInfos{ };
+
+            /**
+             * @brief Command buffer infos for synchronization2 submit infos
+             */
+            mutable std::vector<VkCommandBufferSubmitInfo> commandBufferInfos{ };
+
+            /**
+             * @brief Signal semaphore infos for synchronization2 submit infos
+             */
+            mutable std::vector<VkSemaphoreSubmitInfo> signalSemaphoreInfos{ };
+        };
+
+        /**
+         * @brief Submission storage. Only the first submissionCount entries are in use
+         */
+        std::vector<Submission> submissions{ };
+
+        /**
+         * @brief Number of submissions in use
+         */
+        size_t submissionCount{ 0 };
+
+        /**
+         * @brief Submit infos resolved by the last call to getSubmitInfos
+         */
+        mutable std::vector<VkSubmitInfo> submitInfos{ };
+
+        /**
+         * @brief Synchronization2 submit infos resolved by the last call to getSubmitInfos2
+         */
+        mutable std::vector<VkSubmitInfo2> submitInfos2{ };
+
+        /**
+         * @brief Get the current submission, beginning one if there is none
+         * 
+         * @returns The current submission
+         */
+        Submission & currentSubmission();
+    };
+}
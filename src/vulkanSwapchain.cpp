@@ -2,13 +2,14 @@
 
 namespace siofraEngine::systems
 {
-    VulkanSwapchain::VulkanSwapchain(VkSwapchainKHR swapchain, VkFormat swapchainImageFormat, VkFormat depthAttachmentFormat, VkExtent2D swapchainExtents, std::vector<std::unique_ptr<IVulkanImage>> swapChainImages, std::unique_ptr<IVulkanImage> depthAttachment, IVulkanDevice const * device) :
+    VulkanSwapchain::VulkanSwapchain(VkSwapchainKHR swapchain, VkFormat swapchainImageFormat, VkFormat depthAttachmentFormat, VkExtent2D swapchainExtents, std::vector<std::unique_ptr<IVulkanImage>> swapChainImages, std::vector<std::unique_ptr<IVulkanImage>> depthAttachments, IVulkanSurface const * surface, IVulkanDevice const * device) :
         swapchain{swapchain},
         swapchainImageFormat{swapchainImageFormat},
         depthAttachmentFormat{depthAttachmentFormat},
         swapchainExtents{swapchainExtents},
         swapChainImages{std::move(swapChainImages)},
-        depthAttachment{std::move(depthAttachment)},
+        depthAttachments{std::move(depthAttachments)},
+        surface{surface},
         device{device}
     {
 
@@ -20,18 +21,27 @@ namespace siofraEngine::systems
         depthAttachmentFormat{other.depthAttachmentFormat},
         swapchainExtents{other.swapchainExtents},
         swapChainImages{std::move(other.swapChainImages)},
-        depthAttachment{std::move(other.depthAttachment)},
-        device{other.device}
+        depthAttachments{std::move(other.depthAttachments)},
+        surface{other.surface},
+        device{other.device},
+        retirementFence{other.retirementFence},
+        retirementTimelineSemaphore{other.retirementTimelineSemaphore},
+        retirementValue{other.retirementValue},
+        retirements{std::move(other.retirements)}
     {
         other.swapchain = VK_NULL_HANDLE;
         other.swapchainImageFormat = VK_FORMAT_UNDEFINED;
         other.depthAttachmentFormat = VK_FORMAT_UNDEFINED;
         other.swapchainExtents = {0, 0};
+        other.surface = nullptr;
         other.device = nullptr;
+        other.retirementFence = nullptr;
+        other.retirementTimelineSemaphore = nullptr;
     }
 
     VulkanSwapchain::~VulkanSwapchain()
     {
+        releaseRetirements(true);
         vkDestroySwapchainKHR(device->getLogicalDevice(), swapchain, nullptr);
     }
 
@@ -41,14 +51,22 @@ namespace siofraEngine::systems
         swapchainImageFormat = other.swapchainImageFormat;
         depthAttachmentFormat = other.depthAttachmentFormat;
         swapchainExtents = other.swapchainExtents;
+        surface = other.surface;
         device = other.device;
         swapChainImages = std::move(other.swapChainImages);
-        depthAttachment = std::move(other.depthAttachment);
+        depthAttachments = std::move(other.depthAttachments);
+        retirementFence = other.retirementFence;
+        retirementTimelineSemaphore = other.retirementTimelineSemaphore;
+        retirementValue = other.retirementValue;
+        retirements = std::move(other.retirements);
         other.swapchain = VK_NULL_HANDLE;
         other.swapchainImageFormat = VK_FORMAT_UNDEFINED;
         other.depthAttachmentFormat = VK_FORMAT_UNDEFINED;
         other.swapchainExtents = {0, 0};
+        other.surface = nullptr;
         other.device = nullptr;
+        other.retirementFence = nullptr;
+        other.retirementTimelineSemaphore = nullptr;
         return *this;
     }
 
@@ -60,7 +78,7 @@ namespace siofraEngine::systems
             swapchainExtents.width > 0 &&
             swapchainExtents.height > 0 &&
             swapChainImages.size() > 0 &&
-            depthAttachment;
+            depthAttachments.size() > 0;
     }
 
     VkSwapchainKHR VulkanSwapchain::getSwapchain() const noexcept
@@ -88,9 +106,9 @@ namespace siofraEngine::systems
         return swapChainImages;
     }
 
-    std::unique_ptr<IVulkanImage> const & VulkanSwapchain::getDepthAttachment() const noexcept
+    std::vector<std::unique_ptr<IVulkanImage>> const & VulkanSwapchain::getDepthAttachments() const noexcept
     {
-        return depthAttachment;
+        return depthAttachments;
     }
 
     uint32_t VulkanSwapchain::getMaxFramesInFlight() const noexcept
@@ -100,13 +118,132 @@ namespace siofraEngine::systems
 
     uint32_t VulkanSwapchain::acquireNextImage(IVulkanSemaphore const * semaphore) const
     {
-        VkSemaphore semaphoreHandle = semaphore->getSemaphore();
-
         uint32_t imageIndex{ };
-        if(vkAcquireNextImageKHR(device->getLogicalDevice(), swapchain, std::numeric_limits<uint64_t>::max(), semaphoreHandle, VK_NULL_HANDLE, &imageIndex) != VK_SUCCESS)
+        if(acquireNextImage(semaphore, imageIndex) == VK_ERROR_OUT_OF_DATE_KHR)
         {
             throw std::runtime_error("Failed to acquire next swapchain image");
         }
         return imageIndex;
     }
+
+    VkResult VulkanSwapchain::acquireNextImage(IVulkanSemaphore const * semaphore, uint32_t & imageIndex) const
+    {
+        releaseRetirements(false);
+
+        VkSemaphore semaphoreHandle = semaphore->getSemaphore();
+
+        VkResult result = vkAcquireNextImageKHR(device->getLogicalDevice(), swapchain, std::numeric_limits<uint64_t>::max(), semaphoreHandle, VK_NULL_HANDLE, &imageIndex);
+        if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR && result != VK_ERROR_OUT_OF_DATE_KHR)
+        {
+            throw std::runtime_error("Failed to acquire next swapchain image");
+        }
+
+        return result;
+    }
+
+    bool VulkanSwapchain::recreate(uint32_t width, uint32_t height, IVulkanSwapchainBuilder & vulkanSwapchainBuilder, IVulkanFence const * fence)
+    {
+        if (fence == nullptr)
+        {
+            throw std::runtime_error("Failed to recreate swapchain, no fence specified");
+        }
+
+        retirementFence = fence;
+        retirementTimelineSemaphore = nullptr;
+        return replace(width, height, vulkanSwapchainBuilder);
+    }
+
+    bool VulkanSwapchain::recreate(uint32_t width, uint32_t height, IVulkanSwapchainBuilder & vulkanSwapchainBuilder, IVulkanSemaphore const * timelineSemaphore, uint64_t value)
+    {
+        if (timelineSemaphore == nullptr)
+        {
+            throw std::runtime_error("Failed to recreate swapchain, no timeline semaphore specified");
+        }
+
+        retirementFence = nullptr;
+        retirementTimelineSemaphore = timelineSemaphore;
+        retirementValue = value;
+        return replace(width, height, vulkanSwapchainBuilder);
+    }
+
+    void VulkanSwapchain::retire(std::unique_ptr<IVulkanComponent> resource) const
+    {
+        if (retirementFence == nullptr && retirementTimelineSemaphore == nullptr)
+        {
+            throw std::runtime_error("Failed to retire resource, the swapchain has not been recreated");
+        }
+
+        Retirement retirement{ };
+        retirement.fence = retirementFence;
+        retirement.timelineSemaphore = retirementTimelineSemaphore;
+        retirement.value = retirementValue;
+        retirement.resources.push_back(std::move(resource));
+        retirements.push_back(std::move(retirement));
+    }
+
+    bool VulkanSwapchain::replace(uint32_t width, uint32_t height, IVulkanSwapchainBuilder & vulkanSwapchainBuilder)
+    {
+        VkSwapchainKHR newSwapchain{ VK_NULL_HANDLE };
+        VkFormat newImageFormat{ VK_FORMAT_UNDEFINED };
+        VkFormat newDepthAttachmentFormat{ VK_FORMAT_UNDEFINED };
+        VkExtent2D newExtents{ 0, 0 };
+        std::vector<std::unique_ptr<IVulkanImage>> newSwapChainImages{ };
+        std::vector<std::unique_ptr<IVulkanImage>> newDepthAttachments{ };
+        bool built = vulkanSwapchainBuilder
+            .withDevice(device)
+            .withSurface(surface)
+            .withExtents(width, height)
+            .withOldSwapchain(this)
+            .buildHandles(newSwapchain, newImageFormat, newDepthAttachmentFormat, newExtents, newSwapChainImages, newDepthAttachments);
+        if (!built)
+        {
+            return false;
+        }
+
+        Retirement retirement{ };
+        retirement.fence = retirementFence;
+        retirement.timelineSemaphore = retirementTimelineSemaphore;
+        retirement.value = retirementValue;
+        retirement.swapchain = swapchain;
+        for (auto & swapChainImage : swapChainImages)
+        {
+            retirement.resources.push_back(std::move(swapChainImage));
+        }
+        for (auto & depthAttachment : depthAttachments)
+        {
+            retirement.resources.push_back(std::move(depthAttachment));
+        }
+        retirements.push_back(std::move(retirement));
+
+        swapchain = newSwapchain;
+        swapchainImageFormat = newImageFormat;
+        depthAttachmentFormat = newDepthAttachmentFormat;
+        swapchainExtents = newExtents;
+        swapChainImages = std::move(newSwapChainImages);
+        depthAttachments = std::move(newDepthAttachments);
+        return true;
+    }
+
+    void VulkanSwapchain::releaseRetirements(bool force) const
+    {
+        while (!retirements.empty())
+        {
+            Retirement const & retirement = retirements.front();
+            if (!force)
+            {
+                bool complete = retirement.fence != nullptr ?
+                    retirement.fence->isSignaled() :
+                    retirement.timelineSemaphore->getCounterValue() >= retirement.value;
+                if (!complete)
+                {
+                    break;
+                }
+            }
+
+            // Image views must be destroyed before the swapchain which owns their images
+            retirements.front().resources.clear();
+            vkDestroySwapchainKHR(device->getLogicalDevice(), retirements.front().swapchain, nullptr);
+            retirements.pop_front();
+        }
+    }
 }
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <algorithm>
+#include <deque>
+#include <limits>
 #include <stdexcept>
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanSwapchain.hpp"
 #include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanSurface.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/builders/ivulkanSwapchainBuilder.hpp"
 
 namespace siofraEngine::systems
 {
@@ -25,10 +30,11 @@ namespace siofraEngine::systems
          * @param depthAttachmentFormat Swapchain depth attachment format
          * @param swapchainExtents Swapchain extents
          * @param swapChainImages Swapchain images
-         * @param depthAttachment Swapchain depth attachment
+         * @param depthAttachments Swapchain depth attachments, one per frame in flight
+         * @param surface Surface the swapchain presents to
          * @param device Device used to create the swapchain
          */
-        VulkanSwapchain(VkSwapchainKHR swapchain, VkFormat swapchainImageFormat, VkFormat depthAttachmentFormat, VkExtent2D swapchainExtents, std::vector<std::unique_ptr<IVulkanImage>> swapChainImages, std::unique_ptr<IVulkanImage> depthAttachment, IVulkanDevice const * device);
+        VulkanSwapchain(VkSwapchainKHR swapchain, VkFormat swapchainImageFormat, VkFormat depthAttachmentFormat, VkExtent2D swapchainExtents, std::vector<std::unique_ptr<IVulkanImage>> swapChainImages, std::vector<std::unique_ptr<IVulkanImage>> depthAttachments, IVulkanSurface const * surface, IVulkanDevice const * device);
 
         /**
          * @brief VulkanSwapchain copy constructor
@@ -100,9 +106,11 @@ namespace siofraEngine::systems
         std::vector<std::unique_ptr<IVulkanImage>> const & getSwapchainImages() const noexcept override;
 
         /**
-         * @brief Get swapchain depth attahcment
+         * @brief Get swapchain depth attachments, one per frame in flight
+         * 
+         * @returns The swapchain depth attachments
          */
-        std::unique_ptr<IVulkanImage> const & getDepthAttachment() const noexcept override;
+        std::vector<std::unique_ptr<IVulkanImage>> const & getDepthAttachments() const noexcept override;
 
         /**
          * @brief Get maximum number of frames which can be rendered to
@@ -119,7 +127,80 @@ namespace siofraEngine::systems
          */
         uint32_t acquireNextImage(IVulkanSemaphore const * semaphore) const override;
 
+        /**
+         * @brief Retrieve the index of the next available presentable image without throwing when the swapchain no longer matches the surface
+         * 
+         * @param semaphore A semaphore to signal
+         * @param imageIndex The index of the next available presentable image
+         * @returns VK_SUCCESS, VK_SUBOPTIMAL_KHR if the image can be used but the swapchain should be recreated, or VK_ERROR_OUT_OF_DATE_KHR if no image was acquired and the swapchain must be recreated
+         */
+        VkResult acquireNextImage(IVulkanSemaphore const * semaphore, uint32_t & imageIndex) const override;
+
+        /**
+         * @brief Recreate the swapchain in place, handing the current swapchain to the driver as the old swapchain.
+         * The replaced swapchain, images and depth attachments are retired until a fence signals
+         * 
+         * @param width The requested swapchain width
+         * @param height The requested swapchain height
+         * @param vulkanSwapchainBuilder Builder used to create the replacement swapchain
+         * @param fence The fence signalled by the latest submission which may use the current swapchain
+         * @returns True if the swapchain was recreated, false if the surface has a zero extent, such as when the window is minimised
+         */
+        bool recreate(uint32_t width, uint32_t height, IVulkanSwapchainBuilder & vulkanSwapchainBuilder, IVulkanFence const * fence) override;
+
+        /**
+         * @brief Recreate the swapchain in place, handing the current swapchain to the driver as the old swapchain.
+         * The replaced swapchain, images and depth attachments are retired until a timeline semaphore reaches a value
+         * 
+         * @param width The requested swapchain width
+         * @param height The requested swapchain height
+         * @param vulkanSwapchainBuilder Builder used to create the replacement swapchain
+         * @param timelineSemaphore The timeline semaphore signalled by the latest submission which may use the current swapchain
+         * @param value The value signalled by the latest submission which may use the current swapchain
+         * @returns True if the swapchain was recreated, false if the surface has a zero extent, such as when the window is minimised
+         */
+        bool recreate(uint32_t width, uint32_t height, IVulkanSwapchainBuilder & vulkanSwapchainBuilder, IVulkanSemaphore const * timelineSemaphore, uint64_t value) override;
+
+        /**
+         * @brief Defer destruction of a resource replaced alongside the latest recreation of the swapchain, such as a framebuffer,
+         * until the submission that recreation waits on has completed
+         * 
+         * @param resource The resource to retire
+         */
+        void retire(std::unique_ptr<IVulkanComponent> resource) const override;
+
     private:
+        /**
+         * @brief Resources replaced by a recreation, awaiting the completion of the frames which may still use them
+         */
+        struct Retirement
+        {
+            /**
+             * @brief Fence signalled once the resources are no longer in use, or nullptr if a timeline semaphore is waited on
+             */
+            IVulkanFence const * fence{ nullptr };
+
+            /**
+             * @brief Timeline semaphore signalled once the resources are no longer in use, or nullptr if a fence is waited on
+             */
+            IVulkanSemaphore const * timelineSemaphore{ nullptr };
+
+            /**
+             * @brief The timeline semaphore value at which the resources are no longer in use
+             */
+            uint64_t value{ 0 };
+
+            /**
+             * @brief The replaced swapchain handle, destroyed after the resources
+             */
+            VkSwapchainKHR swapchain{ VK_NULL_HANDLE };
+
+            /**
+             * @brief The retired resources
+             */
+            std::vector<std::unique_ptr<IVulkanComponent>> resources{ };
+        };
+
         /**
          * @brief Vulkan swapchain handle
          */
@@ -146,13 +227,56 @@ namespace siofraEngine::systems
         std::vector<std::unique_ptr<IVulkanImage>> swapChainImages{ };
 
         /**
-         * @brief swapchain depth attachment
+         * @brief swapchain depth attachments, one per frame in flight so frames in flight do not serialize on a shared depth buffer
+         */
+        std::vector<std::unique_ptr<IVulkanImage>> depthAttachments{ };
+
+        /**
+         * @brief Surface the swapchain presents to
          */
-        std::unique_ptr<IVulkanImage> depthAttachment{ nullptr };
+        IVulkanSurface const * surface{ nullptr };
 
         /**
          * @brief Device used to create the swapchain
          */
         IVulkanDevice const * device{ nullptr };
+
+        /**
+         * @brief Fence waited on by the latest recreation, or nullptr if it waits on a timeline semaphore
+         */
+        IVulkanFence const * retirementFence{ nullptr };
+
+        /**
+         * @brief Timeline semaphore waited on by the latest recreation, or nullptr if it waits on a fence
+         */
+        IVulkanSemaphore const * retirementTimelineSemaphore{ nullptr };
+
+        /**
+         * @brief Timeline semaphore value waited on by the latest recreation
+         */
+        uint64_t retirementValue{ 0 };
+
+        /**
+         * @brief Retired resources, in the order they were retired
+         */
+        mutable std::deque<Retirement> retirements{ };
+
+        /**
+         * @brief Replace the swapchain with one built by a builder, retiring the current swapchain and its attachments
+         * until the latest recreation's fence or timeline semaphore signals
+         * 
+         * @param width The requested swapchain width
+         * @param height The requested swapchain height
+         * @param vulkanSwapchainBuilder Builder used to create the replacement swapchain
+         * @returns True if the swapchain was recreated, false if the surface has a zero extent
+         */
+        bool replace(uint32_t width, uint32_t height, IVulkanSwapchainBuilder & vulkanSwapchainBuilder);
+
+        /**
+         * @brief Destroy retired resources which are no longer in use
+         * 
+         * @param force Destroy all retired resources regardless of whether their fence or timeline semaphore has signalled
+         */
+        void releaseRetirements(bool force) const;
     };
 }
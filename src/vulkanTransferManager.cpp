@@ -0,0 +1,273 @@
+#include "systems/renderer/vulkan/vulkanComponents/vulkanTransferManager.hpp"
+
+namespace siofraEngine::systems
+{
+    VulkanTransferManager::VulkanTransferManager(
+        std::unique_ptr<IVulkanCommandPool> transferCommandPool,
+        std::vector<std::unique_ptr<IVulkanCommandBuffer>> transferCommandBuffers,
+        std::unique_ptr<IVulkanCommandPool> acquireCommandPool,
+        std::vector<std::unique_ptr<IVulkanCommandBuffer>> acquireCommandBuffers,
+        std::vector<std::unique_ptr<IVulkanSemaphore>> semaphores,
+        std::vector<std::unique_ptr<IVulkanFence>> fences,
+        std::mutex * queueMutex,
+        IVulkanDevice const * device) :
+
+        transferCommandPool{std::move(transferCommandPool)},
+        acquireCommandPool{std::move(acquireCommandPool)},
+        batches(transferCommandBuffers.size()),
+        queueMutex{queueMutex},
+        device{device}
+    {
+        for (size_t i = 0; i < batches.size(); ++i)
+        {
+            batches[i].transferCommandBuffer = std::move(transferCommandBuffers[i]);
+            if (i < acquireCommandBuffers.size())
+            {
+                batches[i].acquireCommandBuffer = std::move(acquireCommandBuffers[i]);
+            }
+            batches[i].semaphore = std::move(semaphores[i]);
+            batches[i].fence = std::move(fences[i]);
+        }
+    }
+
+    VulkanTransferManager::~VulkanTransferManager()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        // Copies still recording would otherwise be dropped, leaving their destinations undefined or unowned
+        submitRecordingBatch();
+
+        for (auto & batch : batches)
+        {
+            if (batch.ticket != 0)
+            {
+                batch.fence->wait();
+            }
+        }
+    }
+
+    VulkanTransferManager::operator bool() const noexcept
+    {
+        return transferCommandPool && !batches.empty();
+    }
+
+    uint64_t VulkanTransferManager::copyBufferToBuffer(IVulkanBuffer const * sourceBuffer, IVulkanBuffer const * destinationBuffer, VkDeviceSize bytes)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        Batch & batch = recordingBatch();
+        VkCommandBuffer commandBufferHandle = batch.transferCommandBuffer->getCommandBuffer();
+
+        VkBufferCopy bufferCopyRegion{ };
+        bufferCopyRegion.srcOffset = 0;
+        bufferCopyRegion.dstOffset = 0;
+        bufferCopyRegion.size = bytes;
+
+        vkCmdCopyBuffer(commandBufferHandle, sourceBuffer->getBuffer(), destinationBuffer->getBuffer(), 1, &bufferCopyRegion);
+
+        VkBufferMemoryBarrier bufferMemoryBarrier{ };
+        bufferMemoryBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        bufferMemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        bufferMemoryBarrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT | VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+        bufferMemoryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        bufferMemoryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        bufferMemoryBarrier.buffer = destinationBuffer->getBuffer();
+        bufferMemoryBarrier.offset = 0;
+        bufferMemoryBarrier.size = bytes;
+
+        if (!requiresOwnershipTransfer())
+        {
+            vkCmdPipelineBarrier(commandBufferHandle, VK_PIPELINE_STAGE_TRANSFER_BIT, consumerStages, 0, 0, nullptr, 1, &bufferMemoryBarrier, 0, nullptr);
+            return batch.ticket;
+        }
+
+        // Release on the transfer queue, the matching acquire is recorded on the graphics queue at submission
+        bufferMemoryBarrier.srcQueueFamilyIndex = device->getTransferQueue()->getFamilyIndex();
+        bufferMemoryBarrier.dstQueueFamilyIndex = device->getGraphicsQueue()->getFamilyIndex();
+
+        VkBufferMemoryBarrier releaseBarrier = bufferMemoryBarrier;
+        releaseBarrier.dstAccessMask = 0;
+        vkCmdPipelineBarrier(commandBufferHandle, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 1, &releaseBarrier, 0, nullptr);
+
+        bufferMemoryBarrier.srcAccessMask = 0;
+        batch.bufferAcquireBarriers.push_back(bufferMemoryBarrier);
+
+        return batch.ticket;
+    }
+
+    uint64_t VulkanTransferManager::copyBufferToImage(IVulkanBuffer const * sourceBuffer, IVulkanImage const * destinationImage, uint32_t width, uint32_t height)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        Batch & batch = recordingBatch();
+        VkCommandBuffer commandBufferHandle = batch.transferCommandBuffer->getCommandBuffer();
+
+        VkImageMemoryBarrier imageMemoryBarrier{ };
+        imageMemoryBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        imageMemoryBarrier.srcAccessMask = 0;
+        imageMemoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        imageMemoryBarrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        imageMemoryBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        imageMemoryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        imageMemoryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        imageMemoryBarrier.image = destinationImage->getImage();
+        imageMemoryBarrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        imageMemoryBarrier.subresourceRange.baseMipLevel = 0;
+        imageMemoryBarrier.subresourceRange.levelCount = 1;
+        imageMemoryBarrier.subresourceRange.baseArrayLayer = 0;
+        imageMemoryBarrier.subresourceRange.layerCount = 1;
+
+        vkCmdPipelineBarrier(commandBufferHandle, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageMemoryBarrier);
+
+        VkBufferImageCopy imageRegion{ };
+        imageRegion.bufferOffset = 0;
+        imageRegion.bufferRowLength = 0;
+        imageRegion.bufferImageHeight = 0;
+        imageRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        imageRegion.imageSubresource.mipLevel = 0;
+        imageRegion.imageSubresource.baseArrayLayer = 0;
+        imageRegion.imageSubresource.layerCount = 1;
+        imageRegion.imageOffset = { 0, 0, 0 };
+        imageRegion.imageExtent = { width, height, 1 };
+
+        vkCmdCopyBufferToImage(commandBufferHandle, sourceBuffer->getBuffer(), destinationImage->getImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &imageRegion);
+
+        imageMemoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        imageMemoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        imageMemoryBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        imageMemoryBarrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+        if (!requiresOwnershipTransfer())
+        {
+            vkCmdPipelineBarrier(commandBufferHandle, VK_PIPELINE_STAGE_TRANSFER_BIT, consumerStages, 0, 0, nullptr, 0, nullptr, 1, &imageMemoryBarrier);
+            return batch.ticket;
+        }
+
+        // The layout transition is specified identically on release and acquire and only executes once
+        imageMemoryBarrier.srcQueueFamilyIndex = device->getTransferQueue()->getFamilyIndex();
+        imageMemoryBarrier.dstQueueFamilyIndex = device->getGraphicsQueue()->getFamilyIndex();
+
+        VkImageMemoryBarrier releaseBarrier = imageMemoryBarrier;
+        releaseBarrier.dstAccessMask = 0;
+        vkCmdPipelineBarrier(commandBufferHandle, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &releaseBarrier);
+
+        imageMemoryBarrier.srcAccessMask = 0;
+        batch.imageAcquireBarriers.push_back(imageMemoryBarrier);
+
+        return batch.ticket;
+    }
+
+    uint64_t VulkanTransferManager::submit()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return submitRecordingBatch();
+    }
+
+    bool VulkanTransferManager::isComplete(uint64_t ticket) const
+    {
+        // Ticket 0 is returned by submit when nothing has been recorded, so there is no batch to check
+        if (ticket == 0)
+        {
+            return true;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (ticket > lastSubmittedTicket)
+        {
+            return false;
+        }
+
+        // Batches are only reused once their previous submission has completed
+        Batch const & batch = batches[(ticket - 1) % batches.size()];
+        return batch.ticket != ticket || batch.fence->isSignaled();
+    }
+
+    void VulkanTransferManager::wait(uint64_t ticket)
+    {
+        if (ticket == 0)
+        {
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+
+        if (ticket > lastSubmittedTicket)
+        {
+            submitRecordingBatch();
+        }
+
+        Batch const & batch = batches[(ticket - 1) % batches.size()];
+        if (batch.ticket == ticket)
+        {
+            batch.fence->wait();
+        }
+    }
+
+    bool VulkanTransferManager::requiresOwnershipTransfer() const noexcept
+    {
+        return device->getTransferQueue()->getFamilyIndex() != device->getGraphicsQueue()->getFamilyIndex();
+    }
+
+    VulkanTransferManager::Batch & VulkanTransferManager::recordingBatch()
+    {
+        Batch & batch = batches[currentBatch];
+        if (batch.recording)
+        {
+            return batch;
+        }
+
+        batch.fence->wait();
+        batch.ticket = nextTicket;
+        batch.recording = true;
+        batch.transferCommandBuffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+
+        return batch;
+    }
+
+    uint64_t VulkanTransferManager::submitRecordingBatch()
+    {
+        Batch & batch = batches[currentBatch];
+        if (!batch.recording)
+        {
+            return lastSubmittedTicket;
+        }
+
+        batch.transferCommandBuffer->end();
+        batch.fence->reset();
+
+        if (!requiresOwnershipTransfer())
+        {
+            std::lock_guard<std::mutex> queueLock(*queueMutex);
+            device->getTransferQueue()->submit(nullptr, 0, nullptr, batch.fence.get(), batch.transferCommandBuffer.get());
+        }
+        else
+        {
+            batch.acquireCommandBuffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+            // The first scope must include the semaphore wait stages so the acquire is ordered after the transfer submission
+            vkCmdPipelineBarrier(
+                batch.acquireCommandBuffer->getCommandBuffer(),
+                consumerStages,
+                consumerStages,
+                0,
+                0, nullptr,
+                static_cast<uint32_t>(batch.bufferAcquireBarriers.size()), batch.bufferAcquireBarriers.data(),
+                static_cast<uint32_t>(batch.imageAcquireBarriers.size()), batch.imageAcquireBarriers.data());
+            batch.acquireCommandBuffer->end();
+
+            std::lock_guard<std::mutex> queueLock(*queueMutex);
+            device->getTransferQueue()->submit(nullptr, 0, batch.semaphore.get(), nullptr, batch.transferCommandBuffer.get());
+            device->getGraphicsQueue()->submit(batch.semaphore.get(), consumerStages, nullptr, batch.fence.get(), batch.acquireCommandBuffer.get());
+        }
+
+        batch.bufferAcquireBarriers.clear();
+        batch.imageAcquireBarriers.clear();
+        batch.recording = false;
+
+        lastSubmittedTicket = batch.ticket;
+        ++nextTicket;
+        currentBatch = (currentBatch + 1) % batches.size();
+
+        return lastSubmittedTicket;
+    }
+}
@@ -0,0 +1,252 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanTransferManager.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanDevice.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanCommandPool.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanCommandBuffer.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanSemaphore.hpp"
+#include "systems/renderer/vulkan/vulkanComponents/ivulkanFence.hpp"
+
+namespace siofraEngine::systems
+{
+    /**
+     * @brief Records uploads into a ring of batches submitted to the device transfer queue. Vulkan requires submissions to a queue to be
+     * externally synchronized, so every submission the transfer manager makes, including ownership acquires on the graphics queue, holds a
+     * queue mutex shared with the renderer. The renderer must hold the same mutex while submitting or presenting, and must not call the
+     * transfer manager while holding it
+     */
+    class VulkanTransferManager : public IVulkanTransferManager
+    {
+    public:
+        /**
+         * @brief VulkanTransferManager builder
+         */
+        class Builder;
+
+        /**
+         * @brief VulkanTransferManager constructor
+         *
+         * @param transferCommandPool Command pool on the transfer queue family
+         * @param transferCommandBuffers One transfer command buffer per batch
+         * @param acquireCommandPool Command pool on the graphics queue family, or nullptr if the transfer and graphics queue families are the same
+         * @param acquireCommandBuffers One ownership acquire command buffer per batch, or none if the transfer and graphics queue families are the same
+         * @param semaphores One semaphore per batch, signaled by the transfer submission and waited on by the acquire submission
+         * @param fences One fence per batch, signaled when the batch completes
+         * @param queueMutex Mutex guarding submission to the device queues, shared with every other thread which submits to them
+         * @param device The device the transfers are performed on
+         */
+        VulkanTransferManager(
+            std::unique_ptr<IVulkanCommandPool> transferCommandPool,
+            std::vector<std::unique_ptr<IVulkanCommandBuffer>> transferCommandBuffers,
+            std::unique_ptr<IVulkanCommandPool> acquireCommandPool,
+            std::vector<std::unique_ptr<IVulkanCommandBuffer>> acquireCommandBuffers,
+            std::vector<std::unique_ptr<IVulkanSemaphore>> semaphores,
+            std::vector<std::unique_ptr<IVulkanFence>> fences,
+            std::mutex * queueMutex,
+            IVulkanDevice const * device);
+
+        /**
+         * @brief VulkanTransferManager copy constructor
+         *
+         * @param other VulkanTransferManager to copy
+         */
+        VulkanTransferManager(VulkanTransferManager const &other) = delete;
+
+        /**
+         * @brief VulkanTransferManager move constructor
+         *
+         * @param other VulkanTransferManager to move
+         */
+        VulkanTransferManager(VulkanTransferManager &&other) = delete;
+
+        /**
+         * @brief VulkanTransferManager destructor. Submits any batch still recording and waits for every batch to complete
+         */
+        ~VulkanTransferManager();
+
+        /**
+         * @brief VulkanTransferManager copy assignment
+         *
+         * @param other VulkanTransferManager to copy
+         */
+        VulkanTransferManager& operator=(const VulkanTransferManager &other) = delete;
+
+        /**
+         * @brief VulkanTransferManager move assignment
+         *
+         * @param other VulkanTransferManager to move
+         */
+        VulkanTransferManager& operator=(VulkanTransferManager &&other) = delete;
+
+        /**
+         * @brief Check if the wrapped handles are initialized
+         *
+         * @returns True if the wrapped handles are intialized, otherwise false
+         */
+        operator bool() const noexcept override;
+
+        /**
+         * @brief Record a copy between buffers into the current batch. The destination is made available to the graphics queue
+         *
+         * @param sourceBuffer The source buffer, which must remain alive until the returned ticket completes
+         * @param destinationBuffer The destination buffer
+         * @param bytes The number of bytes to copy
+         * @returns Ticket of the batch the copy was recorded into
+         */
+        uint64_t copyBufferToBuffer(IVulkanBuffer const * sourceBuffer, IVulkanBuffer const * destinationBuffer, VkDeviceSize bytes) override;
+
+        /**
+         * @brief Record a copy from a buffer to an image into the current batch. The image is transitioned to shader read only layout on the graphics queue
+         *
+         * @param sourceBuffer The source buffer, which must remain alive until the returned ticket completes
+         * @param destinationImage The destination image, whose contents are discarded
+         * @param width The image width
+         * @param height The image height
+         * @returns Ticket of the batch the copy was recorded into
+         */
+        uint64_t copyBufferToImage(IVulkanBuffer const * sourceBuffer, IVulkanImage const * destinationImage, uint32_t width, uint32_t height) override;
+
+        /**
+         * @brief Submit the current batch
+         *
+         * @returns Ticket of the submitted batch, or of the last submitted batch if nothing was recorded
+         */
+        uint64_t submit() override;
+
+        /**
+         * @brief Check if a batch has completed without blocking
+         *
+         * @param ticket The batch ticket. Ticket 0 identifies no batch and is always complete
+         * @returns True if the batch has completed, otherwise false
+         */
+        bool isComplete(uint64_t ticket) const override;
+
+        /**
+         * @brief Block until a batch has completed, submitting it first if required
+         *
+         * @param ticket The batch ticket. Ticket 0 identifies no batch and returns immediately
+         */
+        void wait(uint64_t ticket) override;
+
+    private:
+        /**
+         * @brief Pipeline stages on the graphics queue which consume transferred resources, including indirect command reads and compute dispatches
+         */
+        static constexpr VkPipelineStageFlags consumerStages{ VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT };
+
+        /**
+         * @brief A set of transfers submitted together
+         */
+        struct Batch
+        {
+            /**
+             * @brief Command buffer recording the transfers and ownership releases
+             */
+            std::unique_ptr<IVulkanCommandBuffer> transferCommandBuffer{ nullptr };
+
+            /**
+             * @brief Command buffer recording the ownership acquires on the graphics queue
+             */
+            std::unique_ptr<IVulkanCommandBuffer> acquireCommandBuffer{ nullptr };
+
+            /**
+             * @brief Orders the acquire submission after the transfer submission
+             */
+            std::unique_ptr<IVulkanSemaphore> semaphore{ nullptr };
+
+            /**
+             * @brief Signaled when the batch completes
+             */
+            std::unique_ptr<IVulkanFence> fence{ nullptr };
+
+            /**
+             * @brief Ticket of the most recent use of the batch
+             */
+            uint64_t ticket{ 0 };
+
+            /**
+             * @brief Indicates if the batch is currently recording
+             */
+            bool recording{ false };
+
+            /**
+             * @brief Buffer ownership acquire barriers to record on the graphics queue
+             */
+            std::vector<VkBufferMemoryBarrier> bufferAcquireBarriers{ };
+
+            /**
+             * @brief Image ownership acquire barriers to record on the graphics queue
+             */
+            std::vector<VkImageMemoryBarrier> imageAcquireBarriers{ };
+        };
+
+        /**
+         * @brief Command pool on the transfer queue family
+         */
+        std::unique_ptr<IVulkanCommandPool> transferCommandPool{ nullptr };
+
+        /**
+         * @brief Command pool on the graphics queue family
+         */
+        std::unique_ptr<IVulkanCommandPool> acquireCommandPool{ nullptr };
+
+        /**
+         * @brief Ring of batches
+         */
+        std::vector<Batch> batches{ };
+
+        /**
+         * @brief Index of the batch currently recording, or next to record
+         */
+        size_t currentBatch{ 0 };
+
+        /**
+         * @brief Ticket assigned to the next batch to begin recording
+         */
+        uint64_t nextTicket{ 1 };
+
+        /**
+         * @brief Ticket of the most recently submitted batch
+         */
+        uint64_t lastSubmittedTicket{ 0 };
+
+        /**
+         * @brief Guards the batches and tickets
+         */
+        mutable std::mutex mutex{ };
+
+        /**
+         * @brief Guards submission to the device queues, shared with every other thread which submits to them. Always acquired after mutex
+         */
+        std::mutex * queueMutex{ nullptr };
+
+        /**
+         * @brief The device the transfers are performed on
+         */
+        IVulkanDevice const * device{ nullptr };
+
+        /**
+         * @brief Check if transferred resources need a queue family ownership transfer to the graphics queue
+         *
+         * @returns True if the transfer and graphics queue families differ, otherwise false
+         */
+        bool requiresOwnershipTransfer() const noexcept;
+
+        /**
+         * @brief Get the batch currently recording, beginning a new batch if required
+         *
+         * @returns The recording batch
+         */
+        Batch & recordingBatch();
+
+        /**
+         * @brief Submit the batch currently recording. The mutex must be held
+         *
+         * @returns Ticket of the submitted batch, or of the last submitted batch if nothing was recorded
+         */
+        uint64_t submitRecordingBatch();
+    };
+}